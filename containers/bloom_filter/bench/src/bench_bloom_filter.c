@@ -0,0 +1,186 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Benchmarks hash map lookups dominated by absent keys with and without a bloom filter in front of the map.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "bloom_filter.h"
+#include "hash_map.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Default number of entries in the benchmarked map, override with the first program argument.
+ **********************************************************************************************************************/
+#define BENCH_DEFAULT_ENTRIES (1UL << 20)
+
+/***********************************************************************************************************************
+ * @brief: Default percentage of lookups for absent keys, override with the second program argument.
+ **********************************************************************************************************************/
+#define BENCH_DEFAULT_MISS_PERCENT 90
+
+/***********************************************************************************************************************
+ * @brief: Number of timed lookups per run.
+ **********************************************************************************************************************/
+#define BENCH_LOOKUPS (1UL << 22)
+
+/*
+========================================================================================================================
+- - BENCH HELPERS - -
+========================================================================================================================
+*/
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static u64 xorshift(u64* state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+// Even keys are in the map, odd keys never are. Scrambled by an odd multiplier, which keeps them distinct, since plain
+// integers hash to themselves and absent odd keys would otherwise only ever land in the empty odd buckets.
+static u64 key_for(u64 const i, bool const present)
+{
+    return ((i << 1) | (present ? 0UL : 1UL)) * 0x9E3779B97F4A7C15UL;
+}
+
+static ERR_59_e run_lookups(hash_map_59* const map,
+                            size_t const entries,
+                            size_t const miss_percent,
+                            double* ns_per_lookup,
+                            size_t* found)
+{
+    u64 rng = 59;
+    void* val = (void*)0;
+    *found = 0;
+    double const start = now_ns();
+    for (size_t i = 0; i < BENCH_LOOKUPS; i++)
+    {
+        u64 const r = xorshift(&rng);
+        u64 key = key_for(r % entries, (r >> 32) % 100 >= miss_percent);
+        ERR_59_e err = get_from_hash_map_59(map, &key, &val);
+        if (ERR_NONE == err)
+            (*found)++;
+        else if (ERR_OBJ_NOT_FOUND != err)
+            return err;
+    }
+    *ns_per_lookup = (now_ns() - start) / (double)BENCH_LOOKUPS;
+
+    return ERR_NONE;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    size_t const entries = (1 < argc) ? strtoul(argv[1], (void*)0, 10) : BENCH_DEFAULT_ENTRIES;
+    size_t const miss_percent = (2 < argc) ? strtoul(argv[2], (void*)0, 10) : BENCH_DEFAULT_MISS_PERCENT;
+    if (0 == entries || 100 < miss_percent)
+        return ERR_INV_PARAM;
+
+    hash_map_59* map = (void*)0;
+    ERR_59_e err = init_copy_hash_map_59(&map, U64_PTR, U64_PTR, 0, 0, 0);
+    if (ERR_NONE != err)
+        return err;
+    for (u64 i = 0; i < entries; i++)
+    {
+        u64 key = key_for(i, true);
+        err = upsert_into_hash_map_59(map, &key, &i);
+        if (ERR_NONE != err)
+            return err;
+    }
+
+    double plain_ns = 0;
+    size_t plain_found = 0;
+    err = run_lookups(map, entries, miss_percent, &plain_ns, &plain_found);
+    if (ERR_NONE != err)
+        return err;
+
+    err = enable_filter_hash_map_59(map, 0);
+    if (ERR_NONE != err)
+        return err;
+
+    double filtered_ns = 0;
+    size_t filtered_found = 0;
+    err = run_lookups(map, entries, miss_percent, &filtered_ns, &filtered_found);
+    if (ERR_NONE != err)
+        return err;
+
+    // Odd keys are never in the map, so every one the filter lets through is a false positive.
+    size_t false_positives = 0;
+    bool maybe_present = false;
+    for (u64 i = 0; i < entries; i++)
+    {
+        u64 key = key_for(i, false);
+        err = query_bloom_filter_59(map->filter, key, &maybe_present);
+        if (ERR_NONE != err)
+            return err;
+        false_positives += maybe_present;
+    }
+
+    printf("entries: %zu, misses: %zu%%, lookups: %lu\n", entries, miss_percent, BENCH_LOOKUPS);
+    printf("get, no filter:   %8.2f ns/key  found %zu\n", plain_ns, plain_found);
+    printf("get, bloom filter:%8.2f ns/key  found %zu\n", filtered_ns, filtered_found);
+    printf("filter: %zu bytes, %zu hashes per key, false positive rate %.3f%%\n",
+           sizeof(bloom_filter_59) + map->filter->counter_count / 2, map->filter->hash_count,
+           100.0 * (double)false_positives / (double)entries);
+
+    deinit_hash_map_59(&map);
+
+    return (plain_found == filtered_found) ? ERR_NONE : ERR_INTRNL;
+}
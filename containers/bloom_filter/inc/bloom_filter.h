@@ -0,0 +1,192 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: This file contains all the declarations for the counting bloom filter, a probabilistic set of 64 bit hashes
+ * that supports removal.
+ **********************************************************************************************************************/
+
+#pragma once
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "containers_common.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Default number of counters per expected key, 10 gives a false positive rate of about 1%.
+ **********************************************************************************************************************/
+#define DEFAULT_BLOOM_FILTER_COUNTERS_PER_KEY 10
+
+/***********************************************************************************************************************
+ * @brief: Largest value of a 4 bit counter, a counter that reaches it sticks there and is never decremented.
+ **********************************************************************************************************************/
+#define BLOOM_FILTER_COUNTER_MAX 15
+
+/***********************************************************************************************************************
+ * @brief: Upper bound on the number of counters a hash is spread over, each takes 7 bits of a 64 bit mixed hash.
+ **********************************************************************************************************************/
+#define BLOOM_FILTER_MAX_HASHES 8
+
+/***********************************************************************************************************************
+ * @brief: Size in bytes of a block of counters, every counter of a hash lands in the same block so a query touches a
+ * single cache line.
+ **********************************************************************************************************************/
+#define BLOOM_FILTER_BLOCK_SIZE 64
+
+/***********************************************************************************************************************
+ * @brief: Number of 4 bit counters in a block.
+ **********************************************************************************************************************/
+#define BLOOM_FILTER_BLOCK_COUNTERS (BLOOM_FILTER_BLOCK_SIZE * 2)
+
+/***********************************************************************************************************************
+ * @brief: Seed mixed into hashes before they are spread over the counters.
+ **********************************************************************************************************************/
+#define BLOOM_FILTER_SEED 59UL
+
+/*
+========================================================================================================================
+- - TYPEDEFS - -
+========================================================================================================================
+*/
+
+typedef struct bloom_filter_59 bloom_filter_59;
+
+/*
+========================================================================================================================
+- - STRUCTS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @bloom_filter_59
+ * @brief: A blocked counting bloom filter over 64 bit hashes, held in a single allocation. Each hash bumps
+ * @hash_count 4 bit counters within one @BLOOM_FILTER_BLOCK_SIZE block so removing it again only decrements them, a
+ * query answering false means the hash was never added.
+ *
+ * @capacity: Number of hashes the filter was sized for, past it the false positive rate climbs.
+ * @counters_per_key: Counters allocated per hash of @capacity.
+ * @counter_count: Number of counters, a multiple of @BLOOM_FILTER_BLOCK_COUNTERS.
+ * @hash_count: Number of counters each hash is spread over.
+ * @size: Number of hashes currently added.
+ * @counters: Counters packed two to a byte, low nibble first.
+ *
+ * @note Works on hashes rather than keys so any container can front itself with a filter, hash keys with
+ * @hash_node_obj_59 or reuse a hash the container already keeps. The filter is position independent so it can be
+ * written out and read back as is.
+ **********************************************************************************************************************/
+struct bloom_filter_59
+{
+    size_t capacity;
+    size_t counters_per_key;
+    size_t counter_count;
+    size_t hash_count;
+    size_t size;
+    _Alignas(BLOOM_FILTER_BLOCK_SIZE) u8 counters[];
+};
+
+/*
+========================================================================================================================
+- - MODULE FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Initializes an empty counting bloom filter sized for @capacity hashes.
+ *
+ * @param[out] filter: Pointer to a @bloom_filter_59 pointer to initialize the filter in.
+ * @param[in] capacity: Number of hashes the filter is expected to hold, must not be 0.
+ * @param[in] counters_per_key: Counters per expected hash, 0 for @DEFAULT_BLOOM_FILTER_COUNTERS_PER_KEY. More
+ * counters lower the false positive rate at the cost of memory, each counter is half a byte.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @warning This will need to be freed with @deinit_bloom_filter_59 when its lifetime has expired.
+ **********************************************************************************************************************/
+ERR_59_e init_bloom_filter_59(bloom_filter_59** filter, size_t const capacity, size_t const counters_per_key);
+
+/***********************************************************************************************************************
+ * @brief: Deallocates the passed filter.
+ *
+ * @param[out] filter: Pointer to a @bloom_filter_59 pointer that will be freed.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note The pointer to the filter will be (void*)0 on return.
+ **********************************************************************************************************************/
+ERR_59_e deinit_bloom_filter_59(bloom_filter_59** filter);
+
+/***********************************************************************************************************************
+ * @brief: Adds a hash to the filter.
+ *
+ * @param[in] filter: Filter to add the hash to.
+ * @param[in] hash: Hash to add, adding the same hash twice needs two removes to take it back out.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e add_to_bloom_filter_59(bloom_filter_59* const filter, u64 const hash);
+
+/***********************************************************************************************************************
+ * @brief: Removes a hash that was previously added to the filter.
+ *
+ * @param[in] filter: Filter to remove the hash from.
+ * @param[in] hash: Hash to remove.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note ERR_OBJ_NOT_FOUND is returned, and the filter left unchanged, when the hash cannot have been added.
+ * @warning Removing a hash that was never added, but happens to test positive, corrupts the filter into false
+ * negatives. Only remove hashes known to have been added.
+ **********************************************************************************************************************/
+ERR_59_e remove_from_bloom_filter_59(bloom_filter_59* const filter, u64 const hash);
+
+/***********************************************************************************************************************
+ * @brief: Tests whether a hash may have been added to the filter.
+ *
+ * @param[in] filter: Filter to query.
+ * @param[in] hash: Hash to test.
+ * @param[out] maybe_present: Set false when the hash was definitely never added, true when it probably was.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e query_bloom_filter_59(bloom_filter_59 const* const filter, u64 const hash, bool* maybe_present);
@@ -0,0 +1,224 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Contains all the definitions for the counting bloom filter.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "bloom_filter.h"
+
+/*
+========================================================================================================================
+- - INTERNAL FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Spreads a hash over the counters of one block. The hash is mixed first so hashes that are not well mixed
+ * themselves (ie. identity hashes of integers) still land on unrelated counters, its high half picks the block and a
+ * second mix supplies 7 bits per counter within the block.
+ *
+ * @param[in] filter: Filter to spread the hash over.
+ * @param[in] hash: Hash to spread.
+ * @param[out] idxs: Array of @BLOOM_FILTER_MAX_HASHES to place the @hash_count counter indexes in.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _spread_hash_bloom_filter_59(bloom_filter_59 const* const filter, u64 const hash, size_t* idxs)
+{
+    u64 block_hash = 0;
+    ERR_59_e err = hash_node_obj_59(U64_PTR, &hash, BLOOM_FILTER_SEED, &block_hash);
+    if (ERR_NONE != err)
+        return err;
+    u64 slot_hash = 0;
+    err = hash_node_obj_59(U64_PTR, &hash, BLOOM_FILTER_SEED + 1, &slot_hash);
+    if (ERR_NONE != err)
+        return err;
+
+    // Multiply and shift maps the high half onto the block count without a division.
+    u64 const block_count = filter->counter_count / BLOOM_FILTER_BLOCK_COUNTERS;
+    size_t const block = (size_t)(((block_hash >> 32) * block_count) >> 32) * BLOOM_FILTER_BLOCK_COUNTERS;
+    for (size_t i = 0; i < filter->hash_count; i++)
+        idxs[i] = block + (size_t)((slot_hash >> (7 * i)) & (BLOOM_FILTER_BLOCK_COUNTERS - 1));
+
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Reads a 4 bit counter.
+ *
+ * @param[in] filter: Filter holding the counter.
+ * @param[in] idx: Index of the counter.
+ *
+ * @retval u8: Value of the counter.
+ **********************************************************************************************************************/
+static u8 _get_counter_bloom_filter_59(bloom_filter_59 const* const filter, size_t const idx)
+{
+    return (u8)((filter->counters[idx >> 1] >> ((idx & 1) << 2)) & 0x0F);
+}
+
+/*
+========================================================================================================================
+- - FUNCTION DEFINITIONS - -
+========================================================================================================================
+*/
+
+ERR_59_e init_bloom_filter_59(bloom_filter_59** filter, size_t const capacity, size_t const counters_per_key)
+{
+    if (!filter || 0 == capacity)
+        return ERR_INV_PARAM;
+
+    size_t const per_key = (0 != counters_per_key) ? counters_per_key : DEFAULT_BLOOM_FILTER_COUNTERS_PER_KEY;
+    if (SIZE_MAX / per_key < capacity)
+        return ERR_INV_PARAM;
+
+    // Whole blocks only, and no more than the 32 bit block hash can address.
+    size_t const block_count = (capacity * per_key + BLOOM_FILTER_BLOCK_COUNTERS - 1) / BLOOM_FILTER_BLOCK_COUNTERS;
+    if (0 == block_count || UINT32_MAX < block_count)
+        return ERR_INV_PARAM;
+    size_t const counter_count = block_count * BLOOM_FILTER_BLOCK_COUNTERS;
+
+    // The header is padded to a block, so the size is a multiple of the alignment as aligned_alloc requires.
+    size_t const filter_size = sizeof(bloom_filter_59) + block_count * BLOOM_FILTER_BLOCK_SIZE;
+    bloom_filter_59* new_filter = aligned_alloc(BLOOM_FILTER_BLOCK_SIZE, filter_size);
+    if (!new_filter)
+        return ERR_NO_MEM;
+    memset(new_filter, 0, filter_size);
+
+    // ln(2) counters per key minimizes the false positive rate, 693 / 1000 keeps it in integers.
+    size_t hash_count = (per_key * 693 + 500) / 1000;
+    if (0 == hash_count)
+        hash_count = 1;
+    else if (BLOOM_FILTER_MAX_HASHES < hash_count)
+        hash_count = BLOOM_FILTER_MAX_HASHES;
+
+    new_filter->capacity = capacity;
+    new_filter->counters_per_key = per_key;
+    new_filter->counter_count = counter_count;
+    new_filter->hash_count = hash_count;
+    new_filter->size = 0;
+
+    *filter = new_filter;
+
+    return ERR_NONE;
+}
+
+ERR_59_e deinit_bloom_filter_59(bloom_filter_59** filter)
+{
+    if (!filter || !(*filter))
+        return ERR_INV_PARAM;
+
+    free(*filter);
+    *filter = (void*)0;
+
+    return ERR_NONE;
+}
+
+ERR_59_e add_to_bloom_filter_59(bloom_filter_59* const filter, u64 const hash)
+{
+    if (!filter)
+        return ERR_INV_PARAM;
+
+    size_t idxs[BLOOM_FILTER_MAX_HASHES];
+    ERR_59_e err = _spread_hash_bloom_filter_59(filter, hash, idxs);
+    if (ERR_NONE != err)
+        return err;
+
+    for (size_t i = 0; i < filter->hash_count; i++)
+    {
+        if (BLOOM_FILTER_COUNTER_MAX != _get_counter_bloom_filter_59(filter, idxs[i]))
+            filter->counters[idxs[i] >> 1] = (u8)(filter->counters[idxs[i] >> 1] + (1U << ((idxs[i] & 1) << 2)));
+    }
+    filter->size++;
+
+    return ERR_NONE;
+}
+
+ERR_59_e remove_from_bloom_filter_59(bloom_filter_59* const filter, u64 const hash)
+{
+    if (!filter)
+        return ERR_INV_PARAM;
+
+    size_t idxs[BLOOM_FILTER_MAX_HASHES];
+    ERR_59_e err = _spread_hash_bloom_filter_59(filter, hash, idxs);
+    if (ERR_NONE != err)
+        return err;
+
+    // Checked up front so a hash that was never added leaves the filter untouched.
+    for (size_t i = 0; i < filter->hash_count; i++)
+    {
+        if (0 == _get_counter_bloom_filter_59(filter, idxs[i]))
+            return ERR_OBJ_NOT_FOUND;
+    }
+
+    // Saturated counters may be shared by more hashes than they can count, they are never decremented.
+    for (size_t i = 0; i < filter->hash_count; i++)
+    {
+        if (BLOOM_FILTER_COUNTER_MAX != _get_counter_bloom_filter_59(filter, idxs[i]))
+            filter->counters[idxs[i] >> 1] = (u8)(filter->counters[idxs[i] >> 1] - (1U << ((idxs[i] & 1) << 2)));
+    }
+    filter->size--;
+
+    return ERR_NONE;
+}
+
+ERR_59_e query_bloom_filter_59(bloom_filter_59 const* const filter, u64 const hash, bool* maybe_present)
+{
+    if (!filter || !maybe_present)
+        return ERR_INV_PARAM;
+
+    size_t idxs[BLOOM_FILTER_MAX_HASHES];
+    ERR_59_e err = _spread_hash_bloom_filter_59(filter, hash, idxs);
+    if (ERR_NONE != err)
+        return err;
+
+    *maybe_present = true;
+    for (size_t i = 0; i < filter->hash_count; i++)
+    {
+        if (0 == _get_counter_bloom_filter_59(filter, idxs[i]))
+        {
+            *maybe_present = false;
+            break;
+        }
+    }
+
+    return ERR_NONE;
+}
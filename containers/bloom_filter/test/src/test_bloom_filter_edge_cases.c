@@ -0,0 +1,177 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Test cases for counting bloom filters that cover edge cases and invalid parameters.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "bloom_filter.h"
+
+/*
+========================================================================================================================
+- - UNIT TESTS - -
+========================================================================================================================
+*/
+
+ERR_59_e test_bloom_filter_59_edge_cases(void)
+{
+    ERR_59_e err = ERR_NONE;
+
+    // Init bloom_filter
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Initializing bloom_filter...");
+
+    bloom_filter_59* filter = (void*)0;
+    err = init_bloom_filter_59(&filter, 64, 0);
+    if (ERR_NONE != err)
+        return err;
+
+    bloom_filter_59* filter_dummy = (void*)0;
+    bool maybe = true;
+
+    // Test init_bloom_filter edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test init_bloom_filter...");
+
+    err = init_bloom_filter_59((void*)0, 64, 0);
+    printf("Assert: ERR_INV_PARAM == %d = init_bloom_filter()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = init_bloom_filter_59(&filter_dummy, 0, 0);
+    printf("Assert: ERR_INV_PARAM == %d = init_bloom_filter() 0 capacity\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = init_bloom_filter_59(&filter_dummy, SIZE_MAX / 2, 0);
+    printf("Assert: ERR_INV_PARAM == %d = init_bloom_filter() overflowing capacity\n", err);
+    assert(ERR_INV_PARAM == err && !filter_dummy);
+
+    err = init_bloom_filter_59(&filter_dummy, 1, 1);
+    printf("Assert: ERR_NONE == %d = init_bloom_filter() one counter per key\n", err);
+    assert(ERR_NONE == err && 1 == filter_dummy->hash_count);
+    assert(BLOOM_FILTER_BLOCK_COUNTERS == filter_dummy->counter_count);
+    err = deinit_bloom_filter_59(&filter_dummy);
+    assert(ERR_NONE == err);
+
+    // Test deinit_bloom_filter edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test deinit_bloom_filter...");
+
+    err = deinit_bloom_filter_59((void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = deinit_bloom_filter()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = deinit_bloom_filter_59(&filter_dummy);
+    printf("Assert: ERR_INV_PARAM == %d = deinit_bloom_filter() NULL filter\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    // Test add, remove and query edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test add_to_bloom_filter, remove_from_bloom_filter and query_bloom_filter...");
+
+    err = add_to_bloom_filter_59(filter_dummy, 59);
+    printf("Assert: ERR_INV_PARAM == %d = add_to_bloom_filter()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = remove_from_bloom_filter_59(filter_dummy, 59);
+    printf("Assert: ERR_INV_PARAM == %d = remove_from_bloom_filter()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = query_bloom_filter_59(filter_dummy, 59, &maybe);
+    printf("Assert: ERR_INV_PARAM == %d = query_bloom_filter()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = query_bloom_filter_59(filter, 59, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = query_bloom_filter() NULL out\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = query_bloom_filter_59(filter, 59, &maybe);
+    printf("Assert: ERR_NONE == %d = query_bloom_filter() empty filter\n", err);
+    assert(ERR_NONE == err && !maybe);
+
+    err = remove_from_bloom_filter_59(filter, 59);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = remove_from_bloom_filter() never added\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err && 0 == filter->size);
+
+    puts("Test saturated counters...");
+    for (size_t i = 0; i < 2 * BLOOM_FILTER_COUNTER_MAX; i++)
+    {
+        err = add_to_bloom_filter_59(filter, 59);
+        assert(ERR_NONE == err);
+    }
+    for (size_t i = 0; i < 2 * BLOOM_FILTER_COUNTER_MAX; i++)
+    {
+        err = remove_from_bloom_filter_59(filter, 59);
+        assert(ERR_NONE == err);
+    }
+    err = query_bloom_filter_59(filter, 59, &maybe);
+    printf("Assert: 1 == %d = saturated counters are never decremented\n", maybe);
+    assert(ERR_NONE == err && maybe && 0 == filter->size);
+
+    // Test clean up
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test clean up...");
+    err = deinit_bloom_filter_59(&filter);
+
+    return err;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    puts("- - -  START OF BLOOM FILTER TEST  - - -");
+    puts("- - - BLOOM FILTER EDGE CASES - - -");
+
+    ERR_59_e err = test_bloom_filter_59_edge_cases();
+    printf("ERROR CODE: %d\n", err);
+    assert(ERR_NONE == err);
+
+    puts("- - - - END OF BLOOM FILTER TEST - - - -");
+    return err;
+}
@@ -0,0 +1,178 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Test cases for counting bloom filters that cover the basic interface interactions.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "bloom_filter.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+#define TEST_KEYS 10000UL
+
+/*
+========================================================================================================================
+- - UNIT TESTS - -
+========================================================================================================================
+*/
+
+ERR_59_e test_bloom_filter_59_interface(void)
+{
+    ERR_59_e err = ERR_NONE;
+
+    // Init bloom_filter
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Initializing bloom_filter...");
+
+    bloom_filter_59* filter = (void*)0;
+    err = init_bloom_filter_59(&filter, TEST_KEYS, 0);
+    printf("Assert: ERR_NONE == %d = init_bloom_filter()\n", err);
+    assert(ERR_NONE == err);
+    printf("Assert: 7 == %zu = hash_count for the default counters per key\n", filter->hash_count);
+    assert(7 == filter->hash_count && TEST_KEYS * DEFAULT_BLOOM_FILTER_COUNTERS_PER_KEY <= filter->counter_count);
+
+    // Test add and query
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("add_to_bloom_filter() and query_bloom_filter()...");
+
+    for (u64 i = 0; i < TEST_KEYS; i++)
+    {
+        err = add_to_bloom_filter_59(filter, i);
+        assert(ERR_NONE == err);
+    }
+    printf("Assert: %lu == %zu = filter size\n", TEST_KEYS, filter->size);
+    assert(TEST_KEYS == filter->size);
+
+    bool maybe = false;
+    size_t hits = 0;
+    for (u64 i = 0; i < TEST_KEYS; i++)
+    {
+        err = query_bloom_filter_59(filter, i, &maybe);
+        assert(ERR_NONE == err);
+        hits += maybe;
+    }
+    printf("Assert: %lu == %zu = added hashes all test positive\n", TEST_KEYS, hits);
+    assert(TEST_KEYS == hits);
+
+    size_t false_positives = 0;
+    for (u64 i = TEST_KEYS; i < 11 * TEST_KEYS; i++)
+    {
+        err = query_bloom_filter_59(filter, i, &maybe);
+        assert(ERR_NONE == err);
+        false_positives += maybe;
+    }
+    printf("Assert: 2000 > %zu = false positives in %lu absent hashes\n", false_positives, 10 * TEST_KEYS);
+    assert(2000 > false_positives);
+
+    // Test remove
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("remove_from_bloom_filter()...");
+
+    for (u64 i = 0; i < TEST_KEYS / 2; i++)
+    {
+        err = remove_from_bloom_filter_59(filter, i);
+        assert(ERR_NONE == err);
+    }
+    printf("Assert: %lu == %zu = filter size after removing half\n", TEST_KEYS / 2, filter->size);
+    assert(TEST_KEYS / 2 == filter->size);
+
+    hits = 0;
+    false_positives = 0;
+    for (u64 i = 0; i < TEST_KEYS; i++)
+    {
+        err = query_bloom_filter_59(filter, i, &maybe);
+        assert(ERR_NONE == err);
+        if (i < TEST_KEYS / 2)
+            false_positives += maybe;
+        else
+            hits += maybe;
+    }
+    printf("Assert: %lu == %zu = kept hashes all test positive\n", TEST_KEYS / 2, hits);
+    assert(TEST_KEYS / 2 == hits);
+    printf("Assert: 100 > %zu = removed hashes still testing positive\n", false_positives);
+    assert(100 > false_positives);
+
+    puts("remove_from_bloom_filter() hash added twice...");
+    u64 const twice = 11 * TEST_KEYS;
+    err = add_to_bloom_filter_59(filter, twice);
+    assert(ERR_NONE == err);
+    err = add_to_bloom_filter_59(filter, twice);
+    assert(ERR_NONE == err);
+    err = remove_from_bloom_filter_59(filter, twice);
+    assert(ERR_NONE == err);
+    err = query_bloom_filter_59(filter, twice, &maybe);
+    printf("Assert: 1 == %d = hash added twice present after one remove\n", maybe);
+    assert(ERR_NONE == err && maybe);
+
+    // Test clean up
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test clean up...");
+    err = deinit_bloom_filter_59(&filter);
+
+    return err;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    puts("- - -  START OF BLOOM FILTER TEST  - - -");
+    puts("- - - INTERFACE TESTS - - -");
+
+    ERR_59_e err = test_bloom_filter_59_interface();
+    printf("ERROR CODE: %d\n", err);
+    assert(ERR_NONE == err);
+
+    puts("- - - - END OF BLOOM FILTER TEST - - - -");
+    return err;
+}
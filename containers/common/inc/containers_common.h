@@ -36,6 +36,7 @@
 */
 
 #include <stdbool.h>
+#include <stddef.h>
 
 /*
 ========================================================================================================================
@@ -45,6 +46,18 @@
 
 #include "common.h"
 
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Gets the struct of @type that embeds @member at the address @ptr, used to get from a link embedded in a user
+ * struct, such as the node of an intrusive list, back to the struct holding it.
+ **********************************************************************************************************************/
+#define CONTAINER_OF_59(ptr, type, member) ((type*)(void*)((char*)(ptr) - offsetof(type, member)))
+
 /*
 ========================================================================================================================
 - - FUNCTION DECLARATIONS - -
@@ -71,3 +84,62 @@
  **********************************************************************************************************************/
 ERR_59_e
 compare_node_obj_59(TYPE_59_e const type, void const* const obj_A, void const* const obj_B, i64* const diff_out);
+
+/***********************************************************************************************************************
+ * @brief: Gets the size in bytes of a single object of the passed @TYPE_59_e, used by containers that copy objects
+ * into their own storage rather than holding the caller's pointer.
+ *
+ * @param[in] type: @TYPE_59_e to get the object size of.
+ * @param[out] size_out: Size in bytes of one object of @type.
+ *
+ * @note Only fixed size pointer types (signed, unsigned, size, char and bool) are supported, ERR_NOT_SUPPORTED will be
+ * returned for others. Strings are variable in size and are also not supported by this function.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e get_type_size_59(TYPE_59_e const type, size_t* const size_out);
+
+/***********************************************************************************************************************
+ * @brief: Hashes a node object into a well mixed 64 bit hash, suitable for power of two tables and for deriving several
+ * independent hashes from one object by changing the @seed.
+ *
+ * @param[in] type: @TYPE_59_e used to produce the hashing path.
+ * @param[in] obj: Obj to hash.
+ * @param[in] seed: Seed mixed into the hash, the same obj hashed with different seeds produces unrelated hashes.
+ * @param[out] hash_out: Hash of the obj.
+ *
+ * @note Supports the same types as @compare_node_obj_59 plus size and bool, ERR_NOT_SUPPORTED is returned for others.
+ * Signed values are sign extended so equal values hash equally regardless of width.
+ * @warning Strings must be null terminated.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e hash_node_obj_59(TYPE_59_e const type, void const* const obj, u64 const seed, u64* const hash_out);
+
+/***********************************************************************************************************************
+ * @brief: Hashes a run of bytes into a well mixed 64 bit hash, 32 bytes at a time. Uses AVX2 or SSE2 when the cpu
+ * running it supports them and a scalar loop otherwise, every path produces the same hash.
+ *
+ * @param[in] bytes: Bytes to hash, may be NULL when @len is 0.
+ * @param[in] len: Number of bytes to hash.
+ * @param[in] seed: Seed mixed into the hash, the same bytes hashed with different seeds produce unrelated hashes.
+ * @param[out] hash_out: Hash of the bytes.
+ *
+ * @note Hashes are stable across cpus, so they may be written to files and compared on other machines.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e hash_bytes_59(void const* const bytes, size_t const len, u64 const seed, u64* const hash_out);
+
+/***********************************************************************************************************************
+ * @brief: Checks two runs of bytes of the same length for equality, 32 bytes at a time with AVX2 or 16 with SSE2 when
+ * the cpu running it supports them.
+ *
+ * @param[in] bytes_A: Bytes to compare, may be NULL when @len is 0.
+ * @param[in] bytes_B: Other bytes to compare, may be NULL when @len is 0.
+ * @param[in] len: Number of bytes held by both @bytes_A and @bytes_B.
+ * @param[out] equal: Set when every byte matches.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e equal_bytes_59(void const* const bytes_A, void const* const bytes_B, size_t const len, bool* const equal);
@@ -38,6 +38,11 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define CONTAINERS_COMMON_X86_SIMD 1
+#endif
+
 /*
 ========================================================================================================================
 - - MODULE INCLUDES - -
@@ -45,6 +50,199 @@
 */
 #include "containers_common.h"
 
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Bytes consumed per step of @hash_bytes_59, four u64 lanes.
+ **********************************************************************************************************************/
+#define HASH_BYTES_STRIPE 32
+
+/***********************************************************************************************************************
+ * @brief: Amount the per lane secrets of @hash_bytes_59 advance by each stripe, so equal stripes at different offsets
+ * contribute differently and reordering them changes the hash.
+ **********************************************************************************************************************/
+#define HASH_BYTES_SECRET_STEP 0x9E3779B97F4A7C15ULL
+
+/*
+========================================================================================================================
+- - INTERNAL FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Finalizes a 64 bit value so every input bit affects every output bit (murmur3 fmix64).
+ *
+ * @param[in] x: Value to mix.
+ *
+ * @retval u64: The mixed value.
+ **********************************************************************************************************************/
+static u64 _mix_u64_containers_common_59(u64 x)
+{
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+/***********************************************************************************************************************
+ * @brief: Starting secrets of the four lanes of @hash_bytes_59.
+ **********************************************************************************************************************/
+static u64 const _hash_bytes_secrets_containers_common_59[4] = {
+    0x87C37B91114253D5ULL, 0x4CF5AD432745937FULL, 0x52DCE729DA3ED7B5ULL, 0x38495AB5C2B2AE35ULL};
+
+/***********************************************************************************************************************
+ * @brief: Accumulates whole stripes into the four lanes one u64 at a time. Each lane adds its data word plus the
+ * product of the two 32 bit halves of the word xored with the lane's secret, the same step the vector paths take two or
+ * four lanes at a time.
+ *
+ * @param[in] bytes: Start of the stripes.
+ * @param[in] stripes: Number of @HASH_BYTES_STRIPE byte stripes to accumulate.
+ * @param[in] first: Index of the first stripe, advances the secrets.
+ * @param[in,out] acc: The four lanes.
+ **********************************************************************************************************************/
+static void
+_accumulate_scalar_containers_common_59(u8 const* bytes, size_t const stripes, size_t const first, u64* const acc)
+{
+    for (size_t i = 0; i < stripes; i++, bytes += HASH_BYTES_STRIPE)
+    {
+        for (size_t lane = 0; lane < 4; lane++)
+        {
+            u64 data = 0;
+            memcpy(&data, bytes + lane * sizeof(u64), sizeof(u64));
+            u64 const key =
+                data ^ (_hash_bytes_secrets_containers_common_59[lane] + (first + i) * HASH_BYTES_SECRET_STEP);
+            acc[lane] += data + (key & 0xFFFFFFFFULL) * (key >> 32);
+        }
+    }
+}
+
+#ifdef CONTAINERS_COMMON_X86_SIMD
+/***********************************************************************************************************************
+ * @brief: SSE2 version of @_accumulate_scalar_containers_common_59, two lanes per register.
+ **********************************************************************************************************************/
+static void
+_accumulate_sse2_containers_common_59(u8 const* bytes, size_t const stripes, size_t const first, u64* const acc)
+{
+    u64 const* secrets = _hash_bytes_secrets_containers_common_59;
+    u64 const offset = first * HASH_BYTES_SECRET_STEP;
+    __m128i acc_lo = _mm_loadu_si128((__m128i const*)acc);
+    __m128i acc_hi = _mm_loadu_si128((__m128i const*)(acc + 2));
+    __m128i secret_lo = _mm_set_epi64x((long long)(secrets[1] + offset), (long long)(secrets[0] + offset));
+    __m128i secret_hi = _mm_set_epi64x((long long)(secrets[3] + offset), (long long)(secrets[2] + offset));
+    __m128i const step = _mm_set1_epi64x((long long)HASH_BYTES_SECRET_STEP);
+
+    for (size_t i = 0; i < stripes; i++, bytes += HASH_BYTES_STRIPE)
+    {
+        __m128i const data_lo = _mm_loadu_si128((__m128i const*)bytes);
+        __m128i const data_hi = _mm_loadu_si128((__m128i const*)(bytes + 16));
+        __m128i const key_lo = _mm_xor_si128(data_lo, secret_lo);
+        __m128i const key_hi = _mm_xor_si128(data_hi, secret_hi);
+        // Swapping the 32 bit halves lines each lane's high half up with its low half for the 32x32 multiply.
+        __m128i const prod_lo = _mm_mul_epu32(key_lo, _mm_shuffle_epi32(key_lo, _MM_SHUFFLE(2, 3, 0, 1)));
+        __m128i const prod_hi = _mm_mul_epu32(key_hi, _mm_shuffle_epi32(key_hi, _MM_SHUFFLE(2, 3, 0, 1)));
+        acc_lo = _mm_add_epi64(acc_lo, _mm_add_epi64(data_lo, prod_lo));
+        acc_hi = _mm_add_epi64(acc_hi, _mm_add_epi64(data_hi, prod_hi));
+        secret_lo = _mm_add_epi64(secret_lo, step);
+        secret_hi = _mm_add_epi64(secret_hi, step);
+    }
+
+    _mm_storeu_si128((__m128i*)acc, acc_lo);
+    _mm_storeu_si128((__m128i*)(acc + 2), acc_hi);
+}
+
+/***********************************************************************************************************************
+ * @brief: AVX2 version of @_accumulate_scalar_containers_common_59, all four lanes in one register.
+ **********************************************************************************************************************/
+__attribute__((target("avx2"))) static void
+_accumulate_avx2_containers_common_59(u8 const* bytes, size_t const stripes, size_t const first, u64* const acc)
+{
+    u64 const* secrets = _hash_bytes_secrets_containers_common_59;
+    u64 const offset = first * HASH_BYTES_SECRET_STEP;
+    __m256i lanes = _mm256_loadu_si256((__m256i const*)acc);
+    __m256i secret = _mm256_set_epi64x((long long)(secrets[3] + offset),
+                                       (long long)(secrets[2] + offset),
+                                       (long long)(secrets[1] + offset),
+                                       (long long)(secrets[0] + offset));
+    __m256i const step = _mm256_set1_epi64x((long long)HASH_BYTES_SECRET_STEP);
+
+    for (size_t i = 0; i < stripes; i++, bytes += HASH_BYTES_STRIPE)
+    {
+        __m256i const data = _mm256_loadu_si256((__m256i const*)bytes);
+        __m256i const key = _mm256_xor_si256(data, secret);
+        __m256i const prod = _mm256_mul_epu32(key, _mm256_shuffle_epi32(key, _MM_SHUFFLE(2, 3, 0, 1)));
+        lanes = _mm256_add_epi64(lanes, _mm256_add_epi64(data, prod));
+        secret = _mm256_add_epi64(secret, step);
+    }
+
+    _mm256_storeu_si256((__m256i*)acc, lanes);
+}
+
+/***********************************************************************************************************************
+ * @brief: SSE2 equality of @len bytes, @len must be at least 16. The last compare overlaps the one before it rather
+ * than falling back to bytes.
+ **********************************************************************************************************************/
+static bool _equal_sse2_containers_common_59(u8 const* const a, u8 const* const b, size_t const len)
+{
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16)
+    {
+        __m128i const eq = _mm_cmpeq_epi8(_mm_loadu_si128((__m128i const*)(a + i)),
+                                          _mm_loadu_si128((__m128i const*)(b + i)));
+        if (0xFFFF != _mm_movemask_epi8(eq))
+            return false;
+    }
+    if (i == len)
+        return true;
+
+    __m128i const eq = _mm_cmpeq_epi8(_mm_loadu_si128((__m128i const*)(a + len - 16)),
+                                      _mm_loadu_si128((__m128i const*)(b + len - 16)));
+    return 0xFFFF == _mm_movemask_epi8(eq);
+}
+
+/***********************************************************************************************************************
+ * @brief: AVX2 equality of @len bytes, @len must be at least 32.
+ **********************************************************************************************************************/
+__attribute__((target("avx2"))) static bool
+_equal_avx2_containers_common_59(u8 const* const a, u8 const* const b, size_t const len)
+{
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32)
+    {
+        __m256i const eq = _mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i const*)(a + i)),
+                                             _mm256_loadu_si256((__m256i const*)(b + i)));
+        if (-1 != _mm256_movemask_epi8(eq))
+            return false;
+    }
+    if (i == len)
+        return true;
+
+    __m256i const eq = _mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i const*)(a + len - 32)),
+                                         _mm256_loadu_si256((__m256i const*)(b + len - 32)));
+    return -1 == _mm256_movemask_epi8(eq);
+}
+#endif
+
+/***********************************************************************************************************************
+ * @brief: Accumulates whole stripes with the widest path the running cpu supports.
+ **********************************************************************************************************************/
+static void _accumulate_containers_common_59(u8 const* bytes, size_t const stripes, size_t const first, u64* const acc)
+{
+#ifdef CONTAINERS_COMMON_X86_SIMD
+    if (__builtin_cpu_supports("avx2"))
+        _accumulate_avx2_containers_common_59(bytes, stripes, first, acc);
+    else
+        _accumulate_sse2_containers_common_59(bytes, stripes, first, acc); // Always present on x86_64.
+#else
+    _accumulate_scalar_containers_common_59(bytes, stripes, first, acc);
+#endif
+}
+
 /*
 ========================================================================================================================
 - - FUNCTION DEFINITIONS - -
@@ -174,3 +372,169 @@ compare_node_obj_59(TYPE_59_e const type, void const* const obj_A, void const* c
 
     return ERR_NONE;
 }
+
+ERR_59_e get_type_size_59(TYPE_59_e const type, size_t* const size_out)
+{
+    if (!type || !size_out)
+        return ERR_INV_PARAM;
+
+    switch (type)
+    {
+    case U8_PTR:
+    case I8_PTR:
+        *size_out = sizeof(u8);
+        break;
+
+    case U16_PTR:
+    case I16_PTR:
+        *size_out = sizeof(u16);
+        break;
+
+    case U32_PTR:
+    case I32_PTR:
+        *size_out = sizeof(u32);
+        break;
+
+    case U64_PTR:
+    case I64_PTR:
+        *size_out = sizeof(u64);
+        break;
+
+    case SIZE_PTR:
+        *size_out = sizeof(size_t);
+        break;
+
+    case CHAR_PTR:
+        *size_out = sizeof(char);
+        break;
+
+    case BOOL_PTR:
+        *size_out = sizeof(bool);
+        break;
+
+    default: // Strings, structs, enums, etc. have no size known to the library.
+        return ERR_NOT_SUPPORTED;
+    }
+
+    return ERR_NONE;
+}
+
+ERR_59_e hash_node_obj_59(TYPE_59_e const type, void const* const obj, u64 const seed, u64* const hash_out)
+{
+    if (!type || !obj || !hash_out)
+        return ERR_INV_PARAM;
+
+    u64 val = 0;
+    switch (type)
+    {
+    case U8_PTR:
+        val = *(u8 const*)obj;
+        break;
+
+    case U16_PTR:
+        val = *(u16 const*)obj;
+        break;
+
+    case U32_PTR:
+        val = *(u32 const*)obj;
+        break;
+
+    case U64_PTR:
+        val = *(u64 const*)obj;
+        break;
+
+    case SIZE_PTR:
+        val = (u64)(*(size_t const*)obj);
+        break;
+
+    case I8_PTR:
+        val = (u64)(i64)(*(i8 const*)obj);
+        break;
+
+    case I16_PTR:
+        val = (u64)(i64)(*(i16 const*)obj);
+        break;
+
+    case I32_PTR:
+        val = (u64)(i64)(*(i32 const*)obj);
+        break;
+
+    case I64_PTR:
+        val = (u64)(*(i64 const*)obj);
+        break;
+
+    case CHAR_PTR:
+        val = (u64)(*(unsigned char const*)obj);
+        break;
+
+    case BOOL_PTR:
+        val = (u64)(*(bool const*)obj);
+        break;
+
+    case STR: // Already fully mixed, so it skips the finalizer below.
+        return hash_bytes_59(obj, strlen((char const*)obj), seed, hash_out);
+
+    default:
+        return ERR_NOT_SUPPORTED;
+    }
+
+    *hash_out = _mix_u64_containers_common_59(val ^ (seed * 0x9E3779B97F4A7C15ULL));
+
+    return ERR_NONE;
+}
+
+ERR_59_e hash_bytes_59(void const* const bytes, size_t const len, u64 const seed, u64* const hash_out)
+{
+    if ((!bytes && 0 != len) || !hash_out)
+        return ERR_INV_PARAM;
+
+    u64 acc[4];
+    for (size_t lane = 0; lane < 4; lane++)
+        acc[lane] = _hash_bytes_secrets_containers_common_59[lane] ^ seed;
+
+    u8 const* data = bytes;
+    size_t const stripes = len / HASH_BYTES_STRIPE;
+    if (0 != stripes)
+        _accumulate_containers_common_59(data, stripes, 0, acc);
+
+    // A partial last stripe rereads the tail of the stripe before it when there is one, otherwise it is zero padded.
+    // The length is mixed in below so the padding never makes two lengths collide.
+    if (0 != len % HASH_BYTES_STRIPE)
+    {
+        u8 tail[HASH_BYTES_STRIPE] = {0};
+        if (0 != stripes)
+            memcpy(tail, data + len - HASH_BYTES_STRIPE, HASH_BYTES_STRIPE);
+        else
+            memcpy(tail, data, len);
+        _accumulate_scalar_containers_common_59(tail, 1, stripes, acc);
+    }
+
+    u64 const folded = acc[0] + ((acc[1] << 17) | (acc[1] >> 47)) + ((acc[2] << 31) | (acc[2] >> 33)) +
+                       ((acc[3] << 47) | (acc[3] >> 17));
+    *hash_out = _mix_u64_containers_common_59(folded ^ ((u64)len * HASH_BYTES_SECRET_STEP) ^ seed);
+
+    return ERR_NONE;
+}
+
+ERR_59_e equal_bytes_59(void const* const bytes_A, void const* const bytes_B, size_t const len, bool* const equal)
+{
+    if ((!bytes_A && 0 != len) || (!bytes_B && 0 != len) || !equal)
+        return ERR_INV_PARAM;
+
+#ifdef CONTAINERS_COMMON_X86_SIMD
+    if (32 <= len && __builtin_cpu_supports("avx2"))
+    {
+        *equal = _equal_avx2_containers_common_59(bytes_A, bytes_B, len);
+        return ERR_NONE;
+    }
+    if (16 <= len)
+    {
+        *equal = _equal_sse2_containers_common_59(bytes_A, bytes_B, len);
+        return ERR_NONE;
+    }
+#endif
+
+    *equal = (0 == len) || 0 == memcmp(bytes_A, bytes_B, len);
+
+    return ERR_NONE;
+}
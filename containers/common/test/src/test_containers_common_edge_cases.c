@@ -75,6 +75,77 @@ ERR_59_e test_common_59_edge_cases(void)
     printf("Assert: err = %d == %d = ERR_INV_PARAM\n", err, ERR_INV_PARAM);
     assert(ERR_INV_PARAM == err);
 
+    // get_type_size()
+    puts("- - - - - - - - - - -");
+    puts("Testing get_type_size()...");
+    size_t size = 0;
+
+    err = get_type_size_59(U64_PTR, (void*)0);
+    printf("Assert: err = %d == %d = ERR_INV_PARAM\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+
+    err = get_type_size_59(STR, &size);
+    printf("Assert: err = %d == %d = ERR_NOT_SUPPORTED\n", err, ERR_NOT_SUPPORTED);
+    assert(ERR_NOT_SUPPORTED == err);
+
+    err = get_type_size_59(STRUCT_PTR, &size);
+    printf("Assert: err = %d == %d = ERR_NOT_SUPPORTED\n", err, ERR_NOT_SUPPORTED);
+    assert(ERR_NOT_SUPPORTED == err);
+
+    // hash_node_obj()
+    puts("- - - - - - - - - - -");
+    puts("Testing hash_node_obj()...");
+    u64 hash = 0;
+
+    err = hash_node_obj_59(U64_PTR, (void*)0, 0, &hash);
+    printf("Assert: err = %d == %d = ERR_INV_PARAM\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+
+    err = hash_node_obj_59(U64_PTR, &a, 0, (void*)0);
+    printf("Assert: err = %d == %d = ERR_INV_PARAM\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+
+    err = hash_node_obj_59(STRUCT_PTR, &a, 0, &hash);
+    printf("Assert: err = %d == %d = ERR_NOT_SUPPORTED\n", err, ERR_NOT_SUPPORTED);
+    assert(ERR_NOT_SUPPORTED == err);
+
+    // hash_bytes()
+    puts("- - - - - - - - - - -");
+    puts("Testing hash_bytes()...");
+
+    err = hash_bytes_59((void*)0, 1, 0, &hash);
+    printf("Assert: err = %d == %d = ERR_INV_PARAM\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+
+    err = hash_bytes_59(&a, sizeof(a), 0, (void*)0);
+    printf("Assert: err = %d == %d = ERR_INV_PARAM\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+
+    err = hash_bytes_59((void*)0, 0, 0, &hash);
+    printf("Assert: err = %d == %d = ERR_NONE with no bytes\n", err, ERR_NONE);
+    assert(ERR_NONE == err);
+
+    // equal_bytes()
+    puts("- - - - - - - - - - -");
+    puts("Testing equal_bytes()...");
+    bool equal = false;
+
+    err = equal_bytes_59((void*)0, &a, sizeof(a), &equal);
+    printf("Assert: err = %d == %d = ERR_INV_PARAM\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+
+    err = equal_bytes_59(&a, (void*)0, sizeof(a), &equal);
+    printf("Assert: err = %d == %d = ERR_INV_PARAM\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+
+    err = equal_bytes_59(&a, &a, sizeof(a), (void*)0);
+    printf("Assert: err = %d == %d = ERR_INV_PARAM\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+
+    err = equal_bytes_59((void*)0, (void*)0, 0, &equal);
+    printf("Assert: err = %d == %d = ERR_NONE with no bytes\n", err, ERR_NONE);
+    assert(ERR_NONE == err && equal);
+
     return ERR_NONE;
 }
 
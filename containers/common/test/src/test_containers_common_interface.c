@@ -36,6 +36,7 @@
 #include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 /*
 ========================================================================================================================
@@ -197,6 +198,99 @@ ERR_59_e test_container_common_59_interface(void)
     printf("Assert: str_A = %s - str_A = %s == 0\n", str_A, str_A);
     assert(0 == dif);
 
+    // get_type_size()
+    puts("- - - - - - - - - - -");
+    puts("Testing get_type_size()...");
+    TYPE_59_e const sized_types[] = {U8_PTR, U16_PTR, U32_PTR, U64_PTR, I8_PTR, I16_PTR, I32_PTR, I64_PTR, SIZE_PTR};
+    size_t const sizes[] = {1, 2, 4, 8, 1, 2, 4, 8, sizeof(size_t)};
+    size_t size = 0;
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        err = get_type_size_59(sized_types[i], &size);
+        printf("Assert: size = %lu == %lu = expected size\n", size, sizes[i]);
+        assert(ERR_NONE == err);
+        assert(sizes[i] == size);
+    }
+
+    // hash_node_obj()
+    puts("- - - - - - - - - - -");
+    puts("Testing hash_node_obj()...");
+    u64 hash_a = 0;
+    u64 hash_b = 0;
+    u64 hash_c = 0;
+    i8 small_neg = -5;
+    i64 wide_neg = -5;
+
+    hash_node_obj_59(I8_PTR, &small_neg, 0, &hash_a);
+    hash_node_obj_59(I64_PTR, &wide_neg, 0, &hash_b);
+    printf("Assert: %lu == %lu = equal values of different widths\n", hash_a, hash_b);
+    assert(hash_a == hash_b);
+
+    hash_node_obj_59(STR, str_A, 0, &hash_a);
+    hash_node_obj_59(STR, "abc", 0, &hash_b);
+    hash_node_obj_59(STR, str_A, 59, &hash_c);
+    printf("Assert: %lu == %lu = equal strings\n", hash_a, hash_b);
+    assert(hash_a == hash_b);
+    printf("Assert: %lu != %lu = different seeds\n", hash_a, hash_c);
+    assert(hash_a != hash_c);
+
+    hash_node_obj_59(U64_PTR, &a, 0, &hash_a);
+    hash_node_obj_59(U64_PTR, &b, 0, &hash_b);
+    printf("Assert: %lu != %lu = adjacent values\n", hash_a, hash_b);
+    assert(hash_a != hash_b && (hash_a >> 32) != (hash_b >> 32)); // High bits must change too.
+
+    // hash_bytes()
+    puts("- - - - - - - - - - -");
+    puts("Testing hash_bytes()...");
+    char const* url = "http://example.com/some/long/path?with=query&and=more";
+    err = hash_bytes_59(url, strlen(url), 11, &hash_a);
+    printf("Assert: 0x13EDEB806909FE41 == 0x%lX = hash pinned across cpus\n", hash_a);
+    assert(ERR_NONE == err && 0x13EDEB806909FE41ULL == hash_a);
+
+    u8 stripes[64] = {0};
+    for (size_t i = 0; i < sizeof(stripes); i++)
+        stripes[i] = (u8)i;
+    hash_bytes_59(stripes, sizeof(stripes), 0, &hash_a);
+    u8 swapped[64] = {0};
+    memcpy(swapped, stripes + 32, 32);
+    memcpy(swapped + 32, stripes, 32);
+    hash_bytes_59(swapped, sizeof(swapped), 0, &hash_b);
+    printf("Assert: %lu != %lu = swapped stripes\n", hash_a, hash_b);
+    assert(hash_a != hash_b);
+
+    // Zero bytes of every length up to a few stripes must not collide through the padding of the last stripe.
+    u8 zeros[130] = {0};
+    for (size_t len = 0; len < sizeof(zeros); len++)
+    {
+        hash_bytes_59(zeros, len, 0, &hash_a);
+        hash_bytes_59(zeros, len + 1, 0, &hash_b);
+        assert(hash_a != hash_b);
+    }
+
+    // equal_bytes()
+    puts("- - - - - - - - - - -");
+    puts("Testing equal_bytes()...");
+    u8 bytes_A[100] = {0};
+    u8 bytes_B[100] = {0};
+    bool equal = false;
+    for (size_t len = 0; len <= sizeof(bytes_A); len++)
+    {
+        for (size_t i = 0; i < len; i++)
+            bytes_A[i] = bytes_B[i] = (u8)(i * 7 + len);
+        err = equal_bytes_59(bytes_A, bytes_B, len, &equal);
+        assert(ERR_NONE == err && equal);
+
+        // A single differing byte is caught wherever it sits, including the overlapping tail compare.
+        for (size_t i = 0; i < len; i++)
+        {
+            bytes_B[i] ^= 0x80;
+            equal_bytes_59(bytes_A, bytes_B, len, &equal);
+            assert(!equal);
+            bytes_B[i] ^= 0x80;
+        }
+    }
+    puts("Assert: equal_bytes() matched every length up to 100 and caught every single differing byte");
+
     return err;
 }
 
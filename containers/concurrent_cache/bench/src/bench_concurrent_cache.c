@@ -0,0 +1,359 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Benchmark of the concurrent cache's hit ratio and throughput on Zipf traces against lru_cache_59.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <math.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <threads.h>
+#include <time.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "concurrent_cache.h"
+#include "lru_cache.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Default highest thread count, the throughput runs double from 1 up to it.
+ **********************************************************************************************************************/
+#define BENCH_DEFAULT_MAX_THREADS 8
+
+/***********************************************************************************************************************
+ * @brief: Default operations per thread in the throughput runs.
+ **********************************************************************************************************************/
+#define BENCH_DEFAULT_OPS (1UL << 20)
+
+/***********************************************************************************************************************
+ * @brief: Distinct keys drawn by the Zipf distribution.
+ **********************************************************************************************************************/
+#define BENCH_KEYS (1UL << 16)
+
+/***********************************************************************************************************************
+ * @brief: Capacity of every benchmarked cache.
+ **********************************************************************************************************************/
+#define BENCH_CAPACITY (1UL << 12)
+
+/***********************************************************************************************************************
+ * @brief: Skew of the Zipf distribution, the key of rank k is drawn with weight 1 / k^s.
+ **********************************************************************************************************************/
+#define BENCH_ZIPF_S 0.9
+
+/***********************************************************************************************************************
+ * @brief: Length of the traces, in keys.
+ **********************************************************************************************************************/
+#define BENCH_TRACE_LEN (1UL << 21)
+
+/***********************************************************************************************************************
+ * @brief: The scan trace interleaves a scan of @BENCH_SCAN_LEN keys never seen before after every @BENCH_SCAN_EVERY
+ * Zipf keys, like a periodic batch job reading through cold data.
+ **********************************************************************************************************************/
+#define BENCH_SCAN_EVERY (1UL << 16)
+#define BENCH_SCAN_LEN (BENCH_CAPACITY * 2)
+
+/*
+========================================================================================================================
+- - BENCH HELPERS - -
+========================================================================================================================
+*/
+
+typedef struct bench_worker_59
+{
+    thrd_t thread;
+    size_t id;
+    size_t ops;
+    u64 hits;
+} bench_worker_59;
+
+static u64* zipf_trace = (void*)0;
+static concurrent_cache_59* concurrent = (void*)0;
+static lru_cache_59* locked_lru = (void*)0;
+static mtx_t locked_lru_lock;
+static atomic_bool start_flag = false;
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static u64 xorshift(u64* state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+// Fills the trace with Zipf keys by inverting the cumulative weights, ranks are scattered over the key space so hot
+// keys do not share hash neighbourhoods. With @scans set, runs of unique cold keys are spliced in.
+static ERR_59_e fill_trace(u64* const trace, bool const scans)
+{
+    double* cdf = malloc(sizeof(double) * BENCH_KEYS);
+    if (!cdf)
+        return ERR_NO_MEM;
+    double total = 0;
+    for (size_t k = 0; k < BENCH_KEYS; k++)
+    {
+        total += 1.0 / pow((double)(k + 1), BENCH_ZIPF_S);
+        cdf[k] = total;
+    }
+
+    u64 rng = 59;
+    u64 cold = BENCH_KEYS;
+    for (size_t i = 0; i < BENCH_TRACE_LEN; i++)
+    {
+        if (scans && 0 == (i + 1) % BENCH_SCAN_EVERY)
+        {
+            for (size_t s = 0; s < BENCH_SCAN_LEN && i < BENCH_TRACE_LEN; s++)
+                trace[i++] = cold++;
+            i--;
+            continue;
+        }
+
+        double const target = (double)(xorshift(&rng) >> 11) / (double)(1ULL << 53) * total;
+        size_t lo = 0;
+        size_t hi = BENCH_KEYS - 1;
+        while (lo < hi)
+        {
+            size_t const mid = lo + (hi - lo) / 2;
+            if (cdf[mid] < target)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        trace[i] = (lo * 0x9E3779B97F4A7C15ULL) % BENCH_KEYS;
+    }
+
+    free(cdf);
+
+    return ERR_NONE;
+}
+
+static ERR_59_e lru_hit_ratio(u64 const* const trace, double* const ratio)
+{
+    lru_cache_59* cache = (void*)0;
+    ERR_59_e err = init_lru_cache_59(&cache, U64_PTR, U64_PTR, 0, BENCH_CAPACITY);
+    if (ERR_NONE != err)
+        return err;
+
+    for (size_t i = 0; i < BENCH_TRACE_LEN; i++)
+    {
+        void* val = (void*)0;
+        if (ERR_NONE != get_lru_cache_59(cache, &trace[i], &val))
+            put_lru_cache_59(cache, &trace[i], &trace[i]);
+    }
+    *ratio = (double)cache->hits / (double)BENCH_TRACE_LEN;
+
+    return deinit_lru_cache_59(&cache);
+}
+
+static ERR_59_e concurrent_hit_ratio(u64 const* const trace, size_t const shards, double* const ratio)
+{
+    concurrent_cache_59* cache = (void*)0;
+    ERR_59_e err = init_concurrent_cache_59(&cache, U64_PTR, U64_PTR, BENCH_CAPACITY, shards);
+    if (ERR_NONE != err)
+        return err;
+
+    for (size_t i = 0; i < BENCH_TRACE_LEN; i++)
+    {
+        u64 val = 0;
+        if (ERR_NONE != get_concurrent_cache_59(cache, &trace[i], &val))
+            put_concurrent_cache_59(cache, &trace[i], &trace[i]);
+    }
+    concurrent_cache_stats_59 stats = { 0 };
+    err = stats_concurrent_cache_59(cache, &stats);
+    if (ERR_NONE != err)
+        return err;
+    *ratio = (double)stats.hits / (double)BENCH_TRACE_LEN;
+
+    return deinit_concurrent_cache_59(&cache);
+}
+
+static int concurrent_worker(void* arg)
+{
+    bench_worker_59* worker = arg;
+    size_t at = worker->id * (BENCH_TRACE_LEN / BENCH_DEFAULT_MAX_THREADS);
+    while (!atomic_load(&start_flag))
+        thrd_yield();
+
+    for (size_t i = 0; i < worker->ops; i++, at++)
+    {
+        u64 const key = zipf_trace[at % BENCH_TRACE_LEN];
+        u64 val = 0;
+        if (ERR_NONE == get_concurrent_cache_59(concurrent, &key, &val))
+            worker->hits++;
+        else
+            put_concurrent_cache_59(concurrent, &key, &key);
+    }
+
+    return 0;
+}
+
+static int locked_worker(void* arg)
+{
+    bench_worker_59* worker = arg;
+    size_t at = worker->id * (BENCH_TRACE_LEN / BENCH_DEFAULT_MAX_THREADS);
+    while (!atomic_load(&start_flag))
+        thrd_yield();
+
+    for (size_t i = 0; i < worker->ops; i++, at++)
+    {
+        u64 const key = zipf_trace[at % BENCH_TRACE_LEN];
+        void* val = (void*)0;
+        mtx_lock(&locked_lru_lock);
+        if (ERR_NONE == get_lru_cache_59(locked_lru, &key, &val))
+            worker->hits++;
+        else
+            put_lru_cache_59(locked_lru, &key, &key);
+        mtx_unlock(&locked_lru_lock);
+    }
+
+    return 0;
+}
+
+static double run_workers(thrd_start_t func, bench_worker_59* workers, size_t const threads, size_t const ops)
+{
+    atomic_store(&start_flag, false);
+    for (size_t t = 0; t < threads; t++)
+    {
+        workers[t].id = t;
+        workers[t].ops = ops;
+        workers[t].hits = 0;
+        if (thrd_success != thrd_create(&workers[t].thread, func, &workers[t]))
+            return -1.0;
+    }
+
+    double const start = now_ns();
+    atomic_store(&start_flag, true);
+    for (size_t t = 0; t < threads; t++)
+        thrd_join(workers[t].thread, (void*)0);
+    double const elapsed = now_ns() - start;
+
+    // Million operations per second across all threads.
+    return (double)(threads * ops) / elapsed * 1e3;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    size_t const max_threads = (1 < argc) ? strtoul(argv[1], (void*)0, 10) : BENCH_DEFAULT_MAX_THREADS;
+    size_t const ops = (2 < argc) ? strtoul(argv[2], (void*)0, 10) : BENCH_DEFAULT_OPS;
+    if (0 == max_threads || 0 == ops)
+        return ERR_INV_PARAM;
+
+    bench_worker_59* workers = malloc(sizeof(bench_worker_59) * max_threads);
+    zipf_trace = malloc(sizeof(u64) * BENCH_TRACE_LEN);
+    u64* scan_trace = malloc(sizeof(u64) * BENCH_TRACE_LEN);
+    if (!workers || !zipf_trace || !scan_trace)
+        return ERR_NO_MEM;
+
+    ERR_59_e err = fill_trace(zipf_trace, false);
+    if (ERR_NONE != err)
+        return err;
+    err = fill_trace(scan_trace, true);
+    if (ERR_NONE != err)
+        return err;
+
+    printf("keys: %lu, capacity: %lu, zipf s: %.2f, trace: %lu keys\n",
+           BENCH_KEYS,
+           BENCH_CAPACITY,
+           BENCH_ZIPF_S,
+           BENCH_TRACE_LEN);
+    printf("scans: %lu unique keys after every %lu\n", BENCH_SCAN_LEN, BENCH_SCAN_EVERY);
+    printf("hit ratio        lru_cache   concurrent_cache 1 shard   concurrent_cache %d shards\n",
+           DEFAULT_CONCURRENT_CACHE_SHARDS);
+
+    u64 const* traces[] = { zipf_trace, scan_trace };
+    char const* names[] = { "zipf        ", "zipf + scans" };
+    for (size_t t = 0; t < 2; t++)
+    {
+        double lru = 0;
+        double single = 0;
+        double sharded = 0;
+        err = lru_hit_ratio(traces[t], &lru);
+        if (ERR_NONE == err)
+            err = concurrent_hit_ratio(traces[t], 1, &single);
+        if (ERR_NONE == err)
+            err = concurrent_hit_ratio(traces[t], 0, &sharded);
+        if (ERR_NONE != err)
+            return err;
+        printf("%s   %9.4f   %24.4f   %26.4f\n", names[t], lru, single, sharded);
+    }
+
+    err = init_concurrent_cache_59(&concurrent, U64_PTR, U64_PTR, BENCH_CAPACITY, 0);
+    if (ERR_NONE != err)
+        return err;
+    err = init_lru_cache_59(&locked_lru, U64_PTR, U64_PTR, 0, BENCH_CAPACITY);
+    if (ERR_NONE != err)
+        return err;
+    if (thrd_success != mtx_init(&locked_lru_lock, mtx_plain))
+        return ERR_INTRNL;
+
+    printf("ops per thread: %zu, get then put on a miss\n", ops);
+    printf("threads   concurrent_cache   global mutex lru_cache   (Mops/s)\n");
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        double const concurrent_mops = run_workers(concurrent_worker, workers, threads, ops);
+        double const locked_mops = run_workers(locked_worker, workers, threads, ops);
+        if (0 > concurrent_mops || 0 > locked_mops)
+            return ERR_INTRNL;
+        printf("%7zu   %16.2f   %22.2f\n", threads, concurrent_mops, locked_mops);
+    }
+
+    deinit_concurrent_cache_59(&concurrent);
+    deinit_lru_cache_59(&locked_lru);
+    mtx_destroy(&locked_lru_lock);
+    free(scan_trace);
+    free(zipf_trace);
+    free(workers);
+
+    return ERR_NONE;
+}
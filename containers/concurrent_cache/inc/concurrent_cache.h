@@ -0,0 +1,367 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: This file contains the declarations for a sharded, thread safe cache with W-TinyLFU admission.
+ **********************************************************************************************************************/
+
+#pragma once
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <threads.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "concurrent_hash_map.h"
+#include "containers_common.h"
+#include "dlist.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Number of shards used when 0 is passed to @init_concurrent_cache_59.
+ **********************************************************************************************************************/
+#define DEFAULT_CONCURRENT_CACHE_SHARDS 16
+
+/***********************************************************************************************************************
+ * @brief: Slots in each shard's read buffer, must be a power of two. Reads are dropped from the recency order, never
+ * from the cache, while the buffer is full.
+ **********************************************************************************************************************/
+#define CONCURRENT_CACHE_READ_BUFFER_SIZE 128
+
+/***********************************************************************************************************************
+ * @brief: Percent of each shard's capacity given to the admission window, the rest is the main space.
+ **********************************************************************************************************************/
+#define CONCURRENT_CACHE_WINDOW_PERCENT 1
+
+/***********************************************************************************************************************
+ * @brief: Percent of each shard's main space given to the protected segment, the rest is the probation segment.
+ **********************************************************************************************************************/
+#define CONCURRENT_CACHE_PROTECTED_PERCENT 80
+
+/***********************************************************************************************************************
+ * @brief: Rows of each shard's count-min sketch, every key is counted once per row.
+ **********************************************************************************************************************/
+#define CONCURRENT_CACHE_SKETCH_DEPTH 4
+
+/***********************************************************************************************************************
+ * @brief: Largest value of a sketch counter, small so that halving ages out old popularity quickly.
+ **********************************************************************************************************************/
+#define CONCURRENT_CACHE_SKETCH_MAX 15
+
+/***********************************************************************************************************************
+ * @brief: Sketch increments per entry of shard capacity after which every counter is halved.
+ **********************************************************************************************************************/
+#define CONCURRENT_CACHE_SAMPLE_FACTOR 10
+
+/***********************************************************************************************************************
+ * @brief: Seed passed to @hash_node_obj_59 for every key.
+ **********************************************************************************************************************/
+#define CONCURRENT_CACHE_SEED (59UL)
+
+/*
+========================================================================================================================
+- - TYPEDEFS - -
+========================================================================================================================
+*/
+
+typedef struct concurrent_cache_node_59 concurrent_cache_node_59;
+typedef struct concurrent_cache_read_buffer_59 concurrent_cache_read_buffer_59;
+typedef struct concurrent_cache_shard_59 concurrent_cache_shard_59;
+typedef struct concurrent_cache_stats_59 concurrent_cache_stats_59;
+typedef struct concurrent_cache_59 concurrent_cache_59;
+
+/*
+========================================================================================================================
+- - ENUMS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @CONCURRENT_CACHE_QUEUE_59_e
+ * @brief: Recency list of a shard holding a node.
+ *
+ * @CONCURRENT_CACHE_WINDOW: admission window, every new key starts here.
+ * @CONCURRENT_CACHE_PROBATION: main space, keys admitted from the window that have not been read since.
+ * @CONCURRENT_CACHE_PROTECTED: main space, keys read while on probation.
+ **********************************************************************************************************************/
+typedef enum CONCURRENT_CACHE_QUEUE_59_e
+{
+    CONCURRENT_CACHE_WINDOW,
+    CONCURRENT_CACHE_PROBATION,
+    CONCURRENT_CACHE_PROTECTED
+} CONCURRENT_CACHE_QUEUE_59_e;
+
+/*
+========================================================================================================================
+- - STRUCTS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @concurrent_cache_node_59
+ * @brief: Eviction policy entry of a cached key, one allocation holding its recency link, its chain in the shard's
+ * table and a copy of the key so an eviction can remove it from the map.
+ *
+ * @link: node in the intrusive list named by @queue.
+ * @chain: next node hashed into the same bucket of the shard's table.
+ * @hash: full width hash of the key, also what the read buffers carry.
+ * @key_len: bytes of the key, including the terminator of STR keys.
+ * @queue: list holding @link.
+ * @key: copy of the key.
+ **********************************************************************************************************************/
+struct concurrent_cache_node_59
+{
+    dlist_node_59 link;
+    concurrent_cache_node_59* chain;
+    u64 hash;
+    size_t key_len;
+    CONCURRENT_CACHE_QUEUE_59_e queue;
+    u8 key[];
+};
+
+/***********************************************************************************************************************
+ * @concurrent_cache_read_buffer_59
+ * @brief: Bounded, lock-free ring of key hashes read from a shard. Readers claim a slot with one compare and swap and
+ * never wait, the holder of the shard lock drains it in order.
+ *
+ * @head: next position to be claimed by a reader.
+ * @tail: next position to be drained.
+ * @slots: hashes awaiting the drain, 0 marks a slot claimed but not yet written.
+ **********************************************************************************************************************/
+struct concurrent_cache_read_buffer_59
+{
+    _Alignas(64) atomic_size_t head;
+    _Alignas(64) atomic_size_t tail;
+    _Atomic(u64) slots[CONCURRENT_CACHE_READ_BUFFER_SIZE];
+};
+
+/***********************************************************************************************************************
+ * @concurrent_cache_shard_59
+ * @brief: One independently locked part of a concurrent cache, keys are spread over the shards by hash. Each shard runs
+ * W-TinyLFU: new keys enter a small LRU window, and a key leaving the window only displaces the main space's next
+ * victim if the shard's count-min sketch estimates it has been used more often.
+ *
+ * @lock: taken by writers and by whoever drains @reads.
+ * @reads: hashes of reads not yet applied to the recency lists and sketch.
+ * @hits: gets that found their key.
+ * @misses: gets that did not.
+ * @table: @table_mask + 1 buckets of policy nodes.
+ * @table_mask: bucket count minus one.
+ * @window: LRU admission window, front used last.
+ * @probation: main space segment evicted from first, front used last.
+ * @protected: main space segment of keys read again after admission, front used last.
+ * @capacity: most keys held by the shard.
+ * @window_capacity: most keys held by @window.
+ * @protected_capacity: most keys held by @protected, overflow is demoted to @probation.
+ * @sketch: @CONCURRENT_CACHE_SKETCH_DEPTH rows of @sketch_mask + 1 saturating counters.
+ * @sketch_mask: counters per row minus one.
+ * @sketch_shift: shift taking a 64 bit row hash to a counter index.
+ * @sketch_additions: increments since the counters were last halved.
+ * @sketch_sample: increments that trigger halving the counters.
+ * @evictions: keys evicted from the main space.
+ * @rejections: keys leaving the window that lost admission and were evicted instead.
+ **********************************************************************************************************************/
+struct concurrent_cache_shard_59
+{
+    _Alignas(64) mtx_t lock;
+    concurrent_cache_read_buffer_59 reads;
+    _Alignas(64) _Atomic(u64) hits;
+    _Atomic(u64) misses;
+    _Alignas(64) concurrent_cache_node_59** table;
+    size_t table_mask;
+    dlist_59* window;
+    dlist_59* probation;
+    dlist_59* protected;
+    size_t capacity;
+    size_t window_capacity;
+    size_t protected_capacity;
+    u8* sketch;
+    size_t sketch_mask;
+    u32 sketch_shift;
+    size_t sketch_additions;
+    size_t sketch_sample;
+    u64 evictions;
+    u64 rejections;
+};
+
+/***********************************************************************************************************************
+ * @concurrent_cache_stats_59
+ * @brief: Counters of a concurrent cache summed over its shards.
+ *
+ * @hits: gets that found their key.
+ * @misses: gets that did not.
+ * @evictions: admitted keys evicted to make room.
+ * @rejections: new keys evicted on leaving the window because they were used less than the key they would displace.
+ **********************************************************************************************************************/
+struct concurrent_cache_stats_59
+{
+    u64 hits;
+    u64 misses;
+    u64 evictions;
+    u64 rejections;
+};
+
+/***********************************************************************************************************************
+ * @concurrent_cache_59
+ * @brief: A thread safe, fixed capacity cache that resists scans. Values live in a @concurrent_hash_map_59 so gets take
+ * no lock, they record the read in their shard's lock-free read buffer and the recency lists and sketch catch up when
+ * the buffer is drained. Puts and removes lock only their key's shard. Keys and values are copied in.
+ *
+ * @key_type: type of the keys, must be a fixed size type or STR.
+ * @val_type: type of the values, must be a fixed size type.
+ * @key_size: size of a key in bytes, 0 for STR keys.
+ * @capacity: most keys held across every shard.
+ * @map: key to value map read by gets.
+ * @shards: @shard_mask + 1 shards.
+ * @shard_mask: shard count minus one, the shard count is a power of two.
+ *
+ * @note Each shard holds an even share of @capacity, so a key may be evicted while other shards still have room.
+ **********************************************************************************************************************/
+struct concurrent_cache_59
+{
+    TYPE_59_e key_type;
+    TYPE_59_e val_type;
+    size_t key_size;
+    size_t capacity;
+    concurrent_hash_map_59* map;
+    concurrent_cache_shard_59* shards;
+    size_t shard_mask;
+};
+
+/*
+========================================================================================================================
+- - MODULE FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Initializes an empty concurrent cache, this also allocates memory to the @cache pointer.
+ *
+ * @param[out] cache: Concurrent cache pointer to initialize. @warning This must be freed when its lifetime has ended.
+ * @param[in] key_type: Type of the keys, must be a fixed size type or STR.
+ * @param[in] val_type: Type of the values, must be a fixed size type.
+ * @param[in] capacity: Most keys held at once, must be at least 1.
+ * @param[in] shards: Number of shards, must be a power of two. If 0 then @DEFAULT_CONCURRENT_CACHE_SHARDS is used.
+ * Lowered to the largest power of two no larger than @capacity, so every shard holds at least one key.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note ERR_NOT_SUPPORTED is returned for types without a fixed size, see get_type_size_59().
+ **********************************************************************************************************************/
+ERR_59_e init_concurrent_cache_59(concurrent_cache_59** cache,
+                                  TYPE_59_e const key_type,
+                                  TYPE_59_e const val_type,
+                                  size_t const capacity,
+                                  size_t const shards);
+
+/***********************************************************************************************************************
+ * @brief: Deallocates the passed cache and all of its entries.
+ *
+ * @param[out] cache: Concurrent cache to deinit, set to (void*)0 on return.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @warning No other thread may be using the cache, this is the only function that is not thread safe.
+ **********************************************************************************************************************/
+ERR_59_e deinit_concurrent_cache_59(concurrent_cache_59** cache);
+
+/***********************************************************************************************************************
+ * @brief: Copies the value of the passed key into @val without taking any lock, counting a hit or a miss. The read is
+ * recorded for its shard's recency lists and sketch, and applied once the read buffer is drained.
+ *
+ * @param[in] cache: Concurrent cache to read.
+ * @param[in] key: Key to look for.
+ * @param[out] val: Buffer of at least the value size that receives a copy of the value.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note ERR_OBJ_NOT_FOUND is returned on a miss. Misses are recorded too, so a key that keeps missing builds up the
+ * frequency it needs to be admitted.
+ **********************************************************************************************************************/
+ERR_59_e get_concurrent_cache_59(concurrent_cache_59* const cache, void const* const key, void* const val);
+
+/***********************************************************************************************************************
+ * @brief: Copies the passed key and value into the cache, or replaces the value of a cached key. A new key enters the
+ * admission window, and the key it pushes out of the window is admitted only if it is estimated to be used more often
+ * than the main space's next victim.
+ *
+ * @param[in] cache: Concurrent cache to put into.
+ * @param[in] key: Key to copy in.
+ * @param[in] val: Value to copy in.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e put_concurrent_cache_59(concurrent_cache_59* const cache, void const* const key, void const* const val);
+
+/***********************************************************************************************************************
+ * @brief: Removes the passed key from the cache.
+ *
+ * @param[in] cache: Concurrent cache to remove from.
+ * @param[in] key: Key to remove.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note ERR_OBJ_NOT_FOUND is returned if the key is not cached.
+ **********************************************************************************************************************/
+ERR_59_e remove_from_concurrent_cache_59(concurrent_cache_59* const cache, void const* const key);
+
+/***********************************************************************************************************************
+ * @brief: Reads the number of keys in the cache.
+ *
+ * @param[in] cache: Concurrent cache to read.
+ * @param[out] size: Number of keys at the time of the call.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e size_concurrent_cache_59(concurrent_cache_59* const cache, size_t* const size);
+
+/***********************************************************************************************************************
+ * @brief: Sums the counters of every shard.
+ *
+ * @param[in] cache: Concurrent cache to read.
+ * @param[out] stats: Counters at the time of the call.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Shards are read one at a time, so counters of a cache in use may be slightly out of step with each other.
+ **********************************************************************************************************************/
+ERR_59_e stats_concurrent_cache_59(concurrent_cache_59* const cache, concurrent_cache_stats_59* const stats);
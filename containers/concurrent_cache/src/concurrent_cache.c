@@ -0,0 +1,746 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: This file contains the definitions for a sharded, thread safe cache with W-TinyLFU admission.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "concurrent_cache.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Fewest counters in a sketch row, small shards still get enough counters to tell keys apart.
+ **********************************************************************************************************************/
+#define CONCURRENT_CACHE_MIN_SKETCH_WIDTH 64
+
+/*
+========================================================================================================================
+- - INTERNAL STATE - -
+========================================================================================================================
+*/
+
+// Odd multipliers giving each sketch row its own counter index for the same key hash.
+static u64 const concurrent_cache_sketch_seeds[CONCURRENT_CACHE_SKETCH_DEPTH] = {
+    0x9E3779B97F4A7C15ULL, 0xBF58476D1CE4E5B9ULL, 0x94D049BB133111EBULL, 0xD6E8FEB86659FD93ULL
+};
+
+/*
+========================================================================================================================
+- - INTERNAL FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Hashes the passed key and gets the number of bytes it takes in a node.
+ *
+ * @param[in] cache: Concurrent cache the key belongs to.
+ * @param[in] key: Key to hash.
+ * @param[out] hash: Hash of the key, never 0 since 0 marks an unwritten read buffer slot.
+ * @param[out] key_len: Bytes of the key, including the terminator of STR keys.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _hash_key_concurrent_cache_59(concurrent_cache_59 const* const cache,
+                                              void const* const key,
+                                              u64* const hash,
+                                              size_t* const key_len)
+{
+    ERR_59_e err = ERR_NONE;
+    if (cache->key_size)
+    {
+        *key_len = cache->key_size;
+        err = hash_node_obj_59(cache->key_type, key, CONCURRENT_CACHE_SEED, hash);
+    }
+    else // Same hash as hash_node_obj_59() gives STR, without a second scan for the length.
+    {
+        size_t const len = strlen((char const*)key);
+        *key_len = len + 1;
+        err = hash_bytes_59(key, len, CONCURRENT_CACHE_SEED, hash);
+    }
+
+    if (!*hash)
+        *hash = 1;
+
+    return err;
+}
+
+/***********************************************************************************************************************
+ * @brief: Gets the shard of the passed hash, taken from its high half so it is independent of the shard's buckets.
+ *
+ * @param[in] cache: Concurrent cache holding the shard.
+ * @param[in] hash: Hash of a key.
+ *
+ * @retval concurrent_cache_shard_59*: Shard of the key.
+ **********************************************************************************************************************/
+static concurrent_cache_shard_59* _shard_concurrent_cache_59(concurrent_cache_59 const* const cache, u64 const hash)
+{
+    return &cache->shards[(hash >> 32) & cache->shard_mask];
+}
+
+/***********************************************************************************************************************
+ * @brief: Gets the policy node at the back of the passed list.
+ *
+ * @param[in] list: Non empty recency list of a shard.
+ *
+ * @retval concurrent_cache_node_59*: Least recently used node of @list.
+ **********************************************************************************************************************/
+static concurrent_cache_node_59* _back_concurrent_cache_59(dlist_59 const* const list)
+{
+    // The tail is the address of the last node's next link.
+    dlist_node_59* node = CONTAINER_OF_59(list->tail, dlist_node_59, next);
+    return CONTAINER_OF_59(node, concurrent_cache_node_59, link);
+}
+
+/***********************************************************************************************************************
+ * @brief: Gets the recency list of the passed queue.
+ *
+ * @param[in] shard: Shard holding the lists.
+ * @param[in] queue: Queue to get the list of.
+ *
+ * @retval dlist_59*: List of @queue.
+ **********************************************************************************************************************/
+static dlist_59* _list_concurrent_cache_59(concurrent_cache_shard_59 const* const shard,
+                                           CONCURRENT_CACHE_QUEUE_59_e const queue)
+{
+    if (CONCURRENT_CACHE_WINDOW == queue)
+        return shard->window;
+    return (CONCURRENT_CACHE_PROBATION == queue) ? shard->probation : shard->protected;
+}
+
+/***********************************************************************************************************************
+ * @brief: Moves the passed node to the front of the list of @queue in O(1).
+ *
+ * @param[in] shard: Shard holding the node.
+ * @param[in] node: Node to move.
+ * @param[in] queue: Queue to move the node to, may be the one it is on.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _move_concurrent_cache_59(concurrent_cache_shard_59* const shard,
+                                          concurrent_cache_node_59* const node,
+                                          CONCURRENT_CACHE_QUEUE_59_e const queue)
+{
+    ERR_59_e err = unlink_node_from_dlist_59(_list_concurrent_cache_59(shard, node->queue), &node->link);
+    if (ERR_NONE != err)
+        return err;
+
+    node->queue = queue;
+
+    return push_front_dlist_59(_list_concurrent_cache_59(shard, queue), &node->link);
+}
+
+/***********************************************************************************************************************
+ * @brief: Counts one use of the passed hash in the shard's count-min sketch, halving every counter once
+ * @sketch_sample uses have been counted so old popularity fades.
+ *
+ * @param[in] shard: Shard holding the sketch.
+ * @param[in] hash: Hash of the used key.
+ **********************************************************************************************************************/
+static void _increment_sketch_concurrent_cache_59(concurrent_cache_shard_59* const shard, u64 const hash)
+{
+    bool added = false;
+    for (size_t row = 0; row < CONCURRENT_CACHE_SKETCH_DEPTH; row++)
+    {
+        u8* counter = &shard->sketch[row * (shard->sketch_mask + 1) +
+                                     (size_t)((hash * concurrent_cache_sketch_seeds[row]) >> shard->sketch_shift)];
+        if (CONCURRENT_CACHE_SKETCH_MAX > *counter)
+        {
+            (*counter)++;
+            added = true;
+        }
+    }
+
+    if (!added || ++shard->sketch_additions < shard->sketch_sample)
+        return;
+
+    for (size_t i = 0; i < CONCURRENT_CACHE_SKETCH_DEPTH * (shard->sketch_mask + 1); i++)
+        shard->sketch[i] >>= 1;
+    shard->sketch_additions /= 2;
+}
+
+/***********************************************************************************************************************
+ * @brief: Estimates how often the passed hash has been used, the smallest of its counters.
+ *
+ * @param[in] shard: Shard holding the sketch.
+ * @param[in] hash: Hash of the key.
+ *
+ * @retval u8: Estimated uses, never below the true count since the last halving.
+ **********************************************************************************************************************/
+static u8 _frequency_concurrent_cache_59(concurrent_cache_shard_59 const* const shard, u64 const hash)
+{
+    u8 frequency = CONCURRENT_CACHE_SKETCH_MAX;
+    for (size_t row = 0; row < CONCURRENT_CACHE_SKETCH_DEPTH; row++)
+    {
+        u8 const counter = shard->sketch[row * (shard->sketch_mask + 1) +
+                                         (size_t)((hash * concurrent_cache_sketch_seeds[row]) >> shard->sketch_shift)];
+        if (counter < frequency)
+            frequency = counter;
+    }
+
+    return frequency;
+}
+
+/***********************************************************************************************************************
+ * @brief: Finds the bucket link pointing at the node of the passed key.
+ *
+ * @param[in] shard: Shard of the key.
+ * @param[in] key: Key to find.
+ * @param[in] hash: Hash of @key.
+ * @param[in] key_len: Bytes of @key, see @_hash_key_concurrent_cache_59.
+ * @param[out] link: Link pointing at the node, or at NULL at the end of the chain if the key is not cached.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _find_concurrent_cache_59(concurrent_cache_shard_59 const* const shard,
+                                          void const* const key,
+                                          u64 const hash,
+                                          size_t const key_len,
+                                          concurrent_cache_node_59*** const link)
+{
+    concurrent_cache_node_59** current = &shard->table[hash & shard->table_mask];
+    for (; *current; current = &(*current)->chain)
+    {
+        if (hash != (*current)->hash || key_len != (*current)->key_len)
+            continue;
+
+        bool equal = false;
+        ERR_59_e err = equal_bytes_59(key, (*current)->key, key_len, &equal);
+        if (ERR_NONE != err)
+            return err;
+        if (equal)
+            break;
+    }
+
+    *link = current;
+
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Applies one read to the shard, counting it in the sketch and promoting the key's node if it is cached. A
+ * read on probation moves the node to the protected segment, demoting that segment's oldest node if it overflows.
+ *
+ * @param[in] shard: Locked shard of the read key.
+ * @param[in] hash: Hash of the read key, the read buffers carry no more than this.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Two keys sharing a full 64 bit hash would share their promotions, which only affects the recency order.
+ **********************************************************************************************************************/
+static ERR_59_e _apply_read_concurrent_cache_59(concurrent_cache_shard_59* const shard, u64 const hash)
+{
+    _increment_sketch_concurrent_cache_59(shard, hash);
+
+    concurrent_cache_node_59* node = shard->table[hash & shard->table_mask];
+    while (node && hash != node->hash)
+        node = node->chain;
+    if (!node)
+        return ERR_NONE;
+
+    if (CONCURRENT_CACHE_PROBATION != node->queue)
+        return _move_concurrent_cache_59(shard, node, node->queue);
+
+    ERR_59_e err = _move_concurrent_cache_59(shard, node, CONCURRENT_CACHE_PROTECTED);
+    if (ERR_NONE != err || shard->protected->size <= shard->protected_capacity)
+        return err;
+
+    return _move_concurrent_cache_59(shard, _back_concurrent_cache_59(shard->protected), CONCURRENT_CACHE_PROBATION);
+}
+
+/***********************************************************************************************************************
+ * @brief: Applies every read written to the shard's read buffer, in the order the slots were claimed. Stops early at a
+ * slot that has been claimed but not yet written, the next drain picks it up.
+ *
+ * @param[in] shard: Locked shard to drain.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _drain_concurrent_cache_59(concurrent_cache_shard_59* const shard)
+{
+    ERR_59_e err = ERR_NONE;
+    size_t tail = atomic_load_explicit(&shard->reads.tail, memory_order_relaxed);
+    size_t const head = atomic_load_explicit(&shard->reads.head, memory_order_acquire);
+    for (; tail != head && ERR_NONE == err; tail++)
+    {
+        u64 const hash = atomic_exchange_explicit(
+            &shard->reads.slots[tail & (CONCURRENT_CACHE_READ_BUFFER_SIZE - 1)], 0, memory_order_acquire);
+        if (!hash)
+            break;
+        err = _apply_read_concurrent_cache_59(shard, hash);
+    }
+
+    // Publishing the tail hands the drained slots back to readers.
+    atomic_store_explicit(&shard->reads.tail, tail, memory_order_release);
+
+    return err;
+}
+
+/***********************************************************************************************************************
+ * @brief: Records a read in the shard's read buffer without waiting. Once half the buffer is pending the reader drains
+ * it if the shard lock is free, and a full buffer drops the read.
+ *
+ * @param[in] shard: Shard of the read key.
+ * @param[in] hash: Hash of the read key.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _record_read_concurrent_cache_59(concurrent_cache_shard_59* const shard, u64 const hash)
+{
+    size_t pending = CONCURRENT_CACHE_READ_BUFFER_SIZE;
+    size_t head = atomic_load_explicit(&shard->reads.head, memory_order_relaxed);
+    for (;;)
+    {
+        size_t const tail = atomic_load_explicit(&shard->reads.tail, memory_order_acquire);
+        if (CONCURRENT_CACHE_READ_BUFFER_SIZE <= head - tail)
+            break;
+        if (atomic_compare_exchange_weak_explicit(
+                &shard->reads.head, &head, head + 1, memory_order_relaxed, memory_order_relaxed))
+        {
+            atomic_store_explicit(
+                &shard->reads.slots[head & (CONCURRENT_CACHE_READ_BUFFER_SIZE - 1)], hash, memory_order_release);
+            pending = head + 1 - tail;
+            break;
+        }
+    }
+
+    if (CONCURRENT_CACHE_READ_BUFFER_SIZE / 2 > pending || thrd_success != mtx_trylock(&shard->lock))
+        return ERR_NONE;
+
+    ERR_59_e err = _drain_concurrent_cache_59(shard);
+    mtx_unlock(&shard->lock);
+
+    return err;
+}
+
+/***********************************************************************************************************************
+ * @brief: Evicts the passed node, removing its key from the map and freeing it.
+ *
+ * @param[in] cache: Concurrent cache holding the node.
+ * @param[in] shard: Locked shard holding the node.
+ * @param[in] node: Node to evict.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _evict_concurrent_cache_59(concurrent_cache_59* const cache,
+                                           concurrent_cache_shard_59* const shard,
+                                           concurrent_cache_node_59* const node)
+{
+    ERR_59_e err = unlink_node_from_dlist_59(_list_concurrent_cache_59(shard, node->queue), &node->link);
+    if (ERR_NONE != err)
+        return err;
+
+    concurrent_cache_node_59** link = &shard->table[node->hash & shard->table_mask];
+    while (*link != node)
+        link = &(*link)->chain;
+    *link = node->chain;
+
+    err = remove_from_concurrent_hash_map_59(cache->map, node->key);
+    free(node);
+
+    return err;
+}
+
+/***********************************************************************************************************************
+ * @brief: Moves keys out of an overflowing window onto probation. While the main space is over its share each such
+ * candidate duels the main space's next victim, the one the sketch estimates is used less often is evicted and ties go
+ * against the candidate, so a scan of keys used once cannot displace the keys in use.
+ *
+ * @param[in] cache: Concurrent cache holding the shard.
+ * @param[in] shard: Locked shard to balance.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _admit_concurrent_cache_59(concurrent_cache_59* const cache, concurrent_cache_shard_59* const shard)
+{
+    while (shard->window->size > shard->window_capacity)
+    {
+        concurrent_cache_node_59* candidate = _back_concurrent_cache_59(shard->window);
+        ERR_59_e err = _move_concurrent_cache_59(shard, candidate, CONCURRENT_CACHE_PROBATION);
+        if (ERR_NONE != err)
+            return err;
+        if (shard->probation->size + shard->protected->size <= shard->capacity - shard->window_capacity)
+            continue;
+
+        // The candidate is at the front of probation, so probation's back is only another key if it holds two.
+        concurrent_cache_node_59* victim = (void*)0;
+        if (1 < shard->probation->size)
+            victim = _back_concurrent_cache_59(shard->probation);
+        else if (shard->protected->size)
+            victim = _back_concurrent_cache_59(shard->protected);
+
+        u8 const candidate_frequency = _frequency_concurrent_cache_59(shard, candidate->hash);
+        if (victim && candidate_frequency > _frequency_concurrent_cache_59(shard, victim->hash))
+        {
+            shard->evictions++;
+            err = _evict_concurrent_cache_59(cache, shard, victim);
+        }
+        else
+        {
+            shard->rejections++;
+            err = _evict_concurrent_cache_59(cache, shard, candidate);
+        }
+        if (ERR_NONE != err)
+            return err;
+    }
+
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Frees everything a shard holds, including a shard that was only partly initialized.
+ *
+ * @param[in] shard: Shard to free, its lock must have been initialized.
+ **********************************************************************************************************************/
+static void _deinit_shard_concurrent_cache_59(concurrent_cache_shard_59* const shard)
+{
+    dlist_59* lists[] = { shard->window, shard->probation, shard->protected };
+    for (size_t i = 0; i < sizeof(lists) / sizeof(lists[0]); i++)
+    {
+        if (!lists[i])
+            continue;
+
+        dlist_node_59* node = lists[i]->head;
+        while (node)
+        {
+            dlist_node_59* next_node = node->next;
+            free(CONTAINER_OF_59(node, concurrent_cache_node_59, link));
+            node = next_node;
+        }
+        deinit_dlist_59(&lists[i]);
+    }
+
+    free(shard->table);
+    free(shard->sketch);
+    mtx_destroy(&shard->lock);
+}
+
+/***********************************************************************************************************************
+ * @brief: Initializes an empty shard.
+ *
+ * @param[out] shard: Shard to initialize.
+ * @param[in] capacity: Most keys the shard holds, at least 1.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _init_shard_concurrent_cache_59(concurrent_cache_shard_59* const shard, size_t const capacity)
+{
+    if (thrd_success != mtx_init(&shard->lock, mtx_plain))
+        return ERR_INTRNL;
+
+    atomic_init(&shard->reads.head, 0);
+    atomic_init(&shard->reads.tail, 0);
+    for (size_t i = 0; i < CONCURRENT_CACHE_READ_BUFFER_SIZE; i++)
+        atomic_init(&shard->reads.slots[i], 0);
+    atomic_init(&shard->hits, 0);
+    atomic_init(&shard->misses, 0);
+
+    shard->capacity = capacity;
+    shard->window_capacity = capacity * CONCURRENT_CACHE_WINDOW_PERCENT / 100;
+    if (!shard->window_capacity)
+        shard->window_capacity = 1;
+    shard->protected_capacity = (capacity - shard->window_capacity) * CONCURRENT_CACHE_PROTECTED_PERCENT / 100;
+    shard->evictions = 0;
+    shard->rejections = 0;
+
+    // Both the table and the sketch rows get a power of two of at least the capacity, so a mask picks the bucket.
+    size_t table_size = 1;
+    while (table_size < capacity)
+        table_size <<= 1;
+    shard->table_mask = table_size - 1;
+
+    size_t width = 1;
+    shard->sketch_shift = 64;
+    while (width < capacity || width < CONCURRENT_CACHE_MIN_SKETCH_WIDTH)
+    {
+        width <<= 1;
+        shard->sketch_shift--;
+    }
+    shard->sketch_mask = width - 1;
+    shard->sketch_additions = 0;
+    shard->sketch_sample = capacity * CONCURRENT_CACHE_SAMPLE_FACTOR;
+
+    shard->table = calloc(table_size, sizeof(concurrent_cache_node_59*));
+    shard->sketch = calloc(CONCURRENT_CACHE_SKETCH_DEPTH * width, sizeof(u8));
+    shard->window = (void*)0;
+    shard->probation = (void*)0;
+    shard->protected = (void*)0;
+
+    size_t const link_offset = offsetof(concurrent_cache_node_59, link);
+    ERR_59_e err = (shard->table && shard->sketch) ? ERR_NONE : ERR_NO_MEM;
+    if (ERR_NONE == err)
+        err = init_intrusive_dlist_59(&shard->window, STRUCT_PTR, 0, link_offset);
+    if (ERR_NONE == err)
+        err = init_intrusive_dlist_59(&shard->probation, STRUCT_PTR, 0, link_offset);
+    if (ERR_NONE == err)
+        err = init_intrusive_dlist_59(&shard->protected, STRUCT_PTR, 0, link_offset);
+    if (ERR_NONE != err)
+        _deinit_shard_concurrent_cache_59(shard);
+
+    return err;
+}
+
+/*
+========================================================================================================================
+- - FUNCTION DEFINITIONS - -
+========================================================================================================================
+*/
+
+ERR_59_e init_concurrent_cache_59(concurrent_cache_59** cache,
+                                  TYPE_59_e const key_type,
+                                  TYPE_59_e const val_type,
+                                  size_t const capacity,
+                                  size_t const shards)
+{
+    if (!cache || !capacity || (shards & (shards - 1)))
+        return ERR_INV_PARAM;
+
+    size_t key_size = 0;
+    if (STR != key_type && ERR_NONE != get_type_size_59(key_type, &key_size))
+        return ERR_NOT_SUPPORTED;
+
+    size_t shard_count = shards ? shards : DEFAULT_CONCURRENT_CACHE_SHARDS;
+    while (shard_count > capacity)
+        shard_count >>= 1;
+
+    concurrent_cache_59* new_cache = malloc(sizeof(concurrent_cache_59));
+    if (!new_cache)
+        return ERR_NO_MEM;
+
+    ERR_59_e err = init_concurrent_hash_map_59(&new_cache->map, key_type, val_type, capacity);
+    if (ERR_NONE != err)
+    {
+        free(new_cache);
+        return err;
+    }
+
+    new_cache->shards =
+        aligned_alloc(_Alignof(concurrent_cache_shard_59), sizeof(concurrent_cache_shard_59) * shard_count);
+    if (!new_cache->shards)
+    {
+        deinit_concurrent_hash_map_59(&new_cache->map);
+        free(new_cache);
+        return ERR_NO_MEM;
+    }
+
+    // Shards split the capacity evenly, the first few take one more key each for the remainder.
+    for (size_t i = 0; i < shard_count; i++)
+    {
+        err = _init_shard_concurrent_cache_59(&new_cache->shards[i],
+                                              capacity / shard_count + ((i < capacity % shard_count) ? 1 : 0));
+        if (ERR_NONE != err)
+        {
+            while (i > 0)
+                _deinit_shard_concurrent_cache_59(&new_cache->shards[--i]);
+            free(new_cache->shards);
+            deinit_concurrent_hash_map_59(&new_cache->map);
+            free(new_cache);
+            return err;
+        }
+    }
+
+    new_cache->key_type = key_type;
+    new_cache->val_type = val_type;
+    new_cache->key_size = key_size;
+    new_cache->capacity = capacity;
+    new_cache->shard_mask = shard_count - 1;
+    *cache = new_cache;
+
+    return ERR_NONE;
+}
+
+ERR_59_e deinit_concurrent_cache_59(concurrent_cache_59** cache)
+{
+    if (!cache || !(*cache))
+        return ERR_INV_PARAM;
+
+    for (size_t i = 0; i <= (*cache)->shard_mask; i++)
+        _deinit_shard_concurrent_cache_59(&(*cache)->shards[i]);
+    free((*cache)->shards);
+
+    ERR_59_e err = deinit_concurrent_hash_map_59(&(*cache)->map);
+    free(*cache);
+    *cache = (void*)0;
+
+    return err;
+}
+
+ERR_59_e get_concurrent_cache_59(concurrent_cache_59* const cache, void const* const key, void* const val)
+{
+    if (!cache || !key || !val)
+        return ERR_INV_PARAM;
+
+    u64 hash = 0;
+    size_t key_len = 0;
+    ERR_59_e err = _hash_key_concurrent_cache_59(cache, key, &hash, &key_len);
+    if (ERR_NONE != err)
+        return err;
+
+    concurrent_cache_shard_59* shard = _shard_concurrent_cache_59(cache, hash);
+    err = get_from_concurrent_hash_map_59(cache->map, key, val);
+    if (ERR_NONE == err)
+        atomic_fetch_add_explicit(&shard->hits, 1, memory_order_relaxed);
+    else if (ERR_OBJ_NOT_FOUND == err)
+        atomic_fetch_add_explicit(&shard->misses, 1, memory_order_relaxed);
+    else
+        return err;
+
+    ERR_59_e const record_err = _record_read_concurrent_cache_59(shard, hash);
+
+    return (ERR_NONE != record_err) ? record_err : err;
+}
+
+ERR_59_e put_concurrent_cache_59(concurrent_cache_59* const cache, void const* const key, void const* const val)
+{
+    if (!cache || !key || !val)
+        return ERR_INV_PARAM;
+
+    u64 hash = 0;
+    size_t key_len = 0;
+    ERR_59_e err = _hash_key_concurrent_cache_59(cache, key, &hash, &key_len);
+    if (ERR_NONE != err)
+        return err;
+
+    concurrent_cache_shard_59* shard = _shard_concurrent_cache_59(cache, hash);
+    if (thrd_success != mtx_lock(&shard->lock))
+        return ERR_INTRNL;
+
+    concurrent_cache_node_59** link = (void*)0;
+    err = _drain_concurrent_cache_59(shard);
+    if (ERR_NONE == err)
+        err = _find_concurrent_cache_59(shard, key, hash, key_len, &link);
+
+    if (ERR_NONE == err && *link) // Replacing a value counts as a use of the key.
+    {
+        err = upsert_into_concurrent_hash_map_59(cache->map, key, val);
+        if (ERR_NONE == err)
+            err = _apply_read_concurrent_cache_59(shard, hash);
+    }
+    else if (ERR_NONE == err)
+    {
+        concurrent_cache_node_59* node = malloc(sizeof(concurrent_cache_node_59) + key_len);
+        err = node ? upsert_into_concurrent_hash_map_59(cache->map, key, val) : ERR_NO_MEM;
+        if (ERR_NONE == err)
+        {
+            node->hash = hash;
+            node->key_len = key_len;
+            node->queue = CONCURRENT_CACHE_WINDOW;
+            memcpy(node->key, key, key_len);
+            node->chain = *link;
+            *link = node;
+            _increment_sketch_concurrent_cache_59(shard, hash);
+            err = push_front_dlist_59(shard->window, &node->link);
+        }
+        else
+        {
+            free(node);
+        }
+
+        if (ERR_NONE == err)
+            err = _admit_concurrent_cache_59(cache, shard);
+    }
+
+    mtx_unlock(&shard->lock);
+
+    return err;
+}
+
+ERR_59_e remove_from_concurrent_cache_59(concurrent_cache_59* const cache, void const* const key)
+{
+    if (!cache || !key)
+        return ERR_INV_PARAM;
+
+    u64 hash = 0;
+    size_t key_len = 0;
+    ERR_59_e err = _hash_key_concurrent_cache_59(cache, key, &hash, &key_len);
+    if (ERR_NONE != err)
+        return err;
+
+    concurrent_cache_shard_59* shard = _shard_concurrent_cache_59(cache, hash);
+    if (thrd_success != mtx_lock(&shard->lock))
+        return ERR_INTRNL;
+
+    concurrent_cache_node_59** link = (void*)0;
+    err = _drain_concurrent_cache_59(shard);
+    if (ERR_NONE == err)
+        err = _find_concurrent_cache_59(shard, key, hash, key_len, &link);
+    if (ERR_NONE == err)
+        err = *link ? _evict_concurrent_cache_59(cache, shard, *link) : ERR_OBJ_NOT_FOUND;
+
+    mtx_unlock(&shard->lock);
+
+    return err;
+}
+
+ERR_59_e size_concurrent_cache_59(concurrent_cache_59* const cache, size_t* const size)
+{
+    if (!cache || !size)
+        return ERR_INV_PARAM;
+
+    return size_concurrent_hash_map_59(cache->map, size);
+}
+
+ERR_59_e stats_concurrent_cache_59(concurrent_cache_59* const cache, concurrent_cache_stats_59* const stats)
+{
+    if (!cache || !stats)
+        return ERR_INV_PARAM;
+
+    stats->hits = 0;
+    stats->misses = 0;
+    stats->evictions = 0;
+    stats->rejections = 0;
+    for (size_t i = 0; i <= cache->shard_mask; i++)
+    {
+        concurrent_cache_shard_59* shard = &cache->shards[i];
+        stats->hits += atomic_load_explicit(&shard->hits, memory_order_relaxed);
+        stats->misses += atomic_load_explicit(&shard->misses, memory_order_relaxed);
+        if (thrd_success != mtx_lock(&shard->lock))
+            return ERR_INTRNL;
+        stats->evictions += shard->evictions;
+        stats->rejections += shard->rejections;
+        mtx_unlock(&shard->lock);
+    }
+
+    return ERR_NONE;
+}
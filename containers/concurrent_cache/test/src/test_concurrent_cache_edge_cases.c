@@ -0,0 +1,216 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Unit tests for the concurrent cache's edge cases.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "concurrent_cache.h"
+
+/*
+========================================================================================================================
+- - UNIT TESTS - -
+========================================================================================================================
+*/
+
+ERR_59_e test_concurrent_cache_59_edge_cases(void)
+{
+    ERR_59_e err = ERR_NONE;
+
+    // Init concurrent_cache
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Initializing concurrent_cache...");
+
+    concurrent_cache_59* cache = (void*)0;
+    err = init_concurrent_cache_59(&cache, I16_PTR, U64_PTR, 1, 64);
+    if (ERR_NONE != err)
+        return err;
+
+    concurrent_cache_59* cache_dummy = (void*)0;
+    concurrent_cache_stats_59 stats = { 0 };
+    i16 key = -59;
+    u64 val = 59;
+    size_t size = 0;
+
+    // Test init_concurrent_cache edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test init_concurrent_cache and deinit_concurrent_cache...");
+
+    printf("Assert: 0 == %zu shard mask of a one key cache\n", cache->shard_mask);
+    assert(0 == cache->shard_mask && 1 == cache->shards[0].window_capacity);
+
+    err = init_concurrent_cache_59((void*)0, U64_PTR, U64_PTR, 1, 0);
+    printf("Assert: ERR_INV_PARAM == %d = init_concurrent_cache()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = init_concurrent_cache_59(&cache_dummy, U64_PTR, U64_PTR, 0, 0);
+    printf("Assert: ERR_INV_PARAM == %d = init_concurrent_cache() zero capacity\n", err);
+    assert(ERR_INV_PARAM == err && !cache_dummy);
+
+    err = init_concurrent_cache_59(&cache_dummy, U64_PTR, U64_PTR, 16, 3);
+    printf("Assert: ERR_INV_PARAM == %d = init_concurrent_cache() shards not a power of two\n", err);
+    assert(ERR_INV_PARAM == err && !cache_dummy);
+
+    err = init_concurrent_cache_59(&cache_dummy, STRUCT_PTR, U64_PTR, 16, 0);
+    printf("Assert: ERR_NOT_SUPPORTED == %d = init_concurrent_cache() struct keys\n", err);
+    assert(ERR_NOT_SUPPORTED == err && !cache_dummy);
+
+    err = init_concurrent_cache_59(&cache_dummy, U64_PTR, STR, 16, 0);
+    printf("Assert: ERR_NOT_SUPPORTED == %d = init_concurrent_cache() STR vals\n", err);
+    assert(ERR_NOT_SUPPORTED == err && !cache_dummy);
+
+    err = deinit_concurrent_cache_59(&cache_dummy);
+    printf("Assert: ERR_INV_PARAM == %d = deinit_concurrent_cache() null cache\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    // Capacity not divisible by the shards, the first shards take the remainder.
+    err = init_concurrent_cache_59(&cache_dummy, U64_PTR, U64_PTR, 7, 4);
+    printf("Assert: ERR_NONE == %d = init_concurrent_cache() uneven shards\n", err);
+    assert(ERR_NONE == err && 3 == cache_dummy->shard_mask);
+    assert(2 == cache_dummy->shards[0].capacity && 2 == cache_dummy->shards[2].capacity);
+    assert(1 == cache_dummy->shards[3].capacity);
+    err = deinit_concurrent_cache_59(&cache_dummy);
+    assert(ERR_NONE == err);
+
+    // Test empty cache edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test empty concurrent_cache...");
+
+    err = get_concurrent_cache_59(cache, &key, &val);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = get_concurrent_cache() empty cache\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err && 59 == val);
+
+    err = remove_from_concurrent_cache_59(cache, &key);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = remove_from_concurrent_cache() empty cache\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+    err = stats_concurrent_cache_59(cache, &stats);
+    assert(ERR_NONE == err && 0 == stats.hits && 1 == stats.misses);
+
+    // Test null params
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test null params...");
+
+    err = get_concurrent_cache_59(cache_dummy, &key, &val);
+    printf("Assert: ERR_INV_PARAM == %d = get_concurrent_cache()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = get_concurrent_cache_59(cache, &key, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = get_concurrent_cache() null out\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = put_concurrent_cache_59(cache, (void*)0, &val);
+    printf("Assert: ERR_INV_PARAM == %d = put_concurrent_cache() null key\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = put_concurrent_cache_59(cache, &key, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = put_concurrent_cache() null val\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = remove_from_concurrent_cache_59(cache_dummy, &key);
+    printf("Assert: ERR_INV_PARAM == %d = remove_from_concurrent_cache()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = size_concurrent_cache_59(cache, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = size_concurrent_cache() null out\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = stats_concurrent_cache_59(cache_dummy, &stats);
+    printf("Assert: ERR_INV_PARAM == %d = stats_concurrent_cache()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    // Test a capacity of one
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test a capacity of one...");
+
+    // With no main space every key leaving the window is evicted, the cache holds the last key put.
+    for (i16 i = -3; i <= 3; i++)
+    {
+        val = (u64)(i + 3);
+        err = put_concurrent_cache_59(cache, &i, &val);
+        assert(ERR_NONE == err);
+    }
+    err = size_concurrent_cache_59(cache, &size);
+    printf("Assert: ERR_NONE == %d = size_concurrent_cache() after 7 puts\n", err);
+    assert(ERR_NONE == err && 1 == size);
+
+    key = 3;
+    err = get_concurrent_cache_59(cache, &key, &val);
+    printf("Assert: ERR_NONE == %d = get_concurrent_cache() only key\n", err);
+    assert(ERR_NONE == err && 6 == val);
+
+    key = 2;
+    err = get_concurrent_cache_59(cache, &key, &val);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = get_concurrent_cache() evicted key\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+    err = stats_concurrent_cache_59(cache, &stats);
+    assert(ERR_NONE == err && 1 == stats.hits && 2 == stats.misses && 6 == stats.rejections);
+
+    // Test clean up
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test clean up...");
+    err = deinit_concurrent_cache_59(&cache);
+
+    return err;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    puts("- - -  START OF CONCURRENT CACHE TEST  - - -");
+    puts("- - - CONCURRENT CACHE EDGE CASES - - -");
+
+    ERR_59_e err = test_concurrent_cache_59_edge_cases();
+    printf("ERROR CODE: %d\n", err);
+    assert(ERR_NONE == err);
+
+    puts("- - - - END OF CONCURRENT CACHE TEST - - - -");
+    return err;
+}
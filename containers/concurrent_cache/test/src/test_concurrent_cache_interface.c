@@ -0,0 +1,302 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Unit tests for the concurrent cache's interface.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <threads.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "concurrent_cache.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+#define TEST_CAPACITY 100
+#define TEST_HOT_KEYS 50
+#define TEST_HOT_READS 10
+#define TEST_SCAN_KEYS 4000
+#define TEST_THREADS 4
+#define TEST_THREAD_OPS 20000
+#define TEST_THREAD_KEYS 1024
+
+/*
+========================================================================================================================
+- - INTERNAL TEST HELPERS - -
+========================================================================================================================
+*/
+
+static concurrent_cache_59* shared_cache = (void*)0;
+static atomic_size_t bad_reads = 0;
+static atomic_size_t gets = 0;
+
+static u64 _xorshift(u64* state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+// Gets a skewed key and puts it on a miss, every value read must be the one put for its key.
+static int _worker_thread(void* arg)
+{
+    u64 rng = 59 + (u64)(size_t)arg;
+    for (size_t i = 0; i < TEST_THREAD_OPS; i++)
+    {
+        u64 const a = _xorshift(&rng) % TEST_THREAD_KEYS;
+        u64 const b = _xorshift(&rng) % TEST_THREAD_KEYS;
+        u64 key = (a < b) ? a : b;
+        if (0 == i % 16)
+        {
+            ERR_59_e err = remove_from_concurrent_cache_59(shared_cache, &key);
+            if (ERR_NONE != err && ERR_OBJ_NOT_FOUND != err)
+                atomic_fetch_add(&bad_reads, 1);
+            continue;
+        }
+
+        u64 val = 0;
+        ERR_59_e err = get_concurrent_cache_59(shared_cache, &key, &val);
+        atomic_fetch_add(&gets, 1);
+        if (ERR_OBJ_NOT_FOUND == err)
+        {
+            val = key * 3;
+            err = put_concurrent_cache_59(shared_cache, &key, &val);
+        }
+        if (ERR_NONE != err || val != key * 3)
+            atomic_fetch_add(&bad_reads, 1);
+    }
+
+    return 0;
+}
+
+/*
+========================================================================================================================
+- - UNIT TESTS - -
+========================================================================================================================
+*/
+
+ERR_59_e test_concurrent_cache_59_interface(void)
+{
+    ERR_59_e err = ERR_NONE;
+
+    // Init concurrent_cache
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Initializing concurrent_cache...");
+
+    concurrent_cache_59* cache = (void*)0;
+    err = init_concurrent_cache_59(&cache, U64_PTR, U64_PTR, TEST_CAPACITY, 1);
+    printf("Assert: ERR_NONE == %d = init_concurrent_cache()\n", err);
+    assert(ERR_NONE == err && 0 == cache->shard_mask);
+    assert(1 == cache->shards[0].window_capacity && 79 == cache->shards[0].protected_capacity);
+
+    // Test put and get
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test put_concurrent_cache and get_concurrent_cache...");
+
+    u64 key = 5;
+    u64 val = 9;
+    err = put_concurrent_cache_59(cache, &key, &val);
+    printf("Assert: ERR_NONE == %d = put_concurrent_cache()\n", err);
+    assert(ERR_NONE == err);
+
+    val = 0;
+    err = get_concurrent_cache_59(cache, &key, &val);
+    printf("Assert: ERR_NONE == %d = get_concurrent_cache()\n", err);
+    assert(ERR_NONE == err && 9 == val);
+
+    val = 59;
+    err = put_concurrent_cache_59(cache, &key, &val);
+    printf("Assert: ERR_NONE == %d = put_concurrent_cache() existing key\n", err);
+    assert(ERR_NONE == err);
+    err = get_concurrent_cache_59(cache, &key, &val);
+    assert(ERR_NONE == err && 59 == val);
+
+    key = 6;
+    err = get_concurrent_cache_59(cache, &key, &val);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = get_concurrent_cache() miss\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+    concurrent_cache_stats_59 stats = { 0 };
+    err = stats_concurrent_cache_59(cache, &stats);
+    printf("Assert: ERR_NONE == %d = stats_concurrent_cache()\n", err);
+    assert(ERR_NONE == err && 2 == stats.hits && 1 == stats.misses && 0 == stats.evictions);
+
+    // Test remove
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test remove_from_concurrent_cache...");
+
+    key = 5;
+    err = remove_from_concurrent_cache_59(cache, &key);
+    printf("Assert: ERR_NONE == %d = remove_from_concurrent_cache()\n", err);
+    assert(ERR_NONE == err);
+    err = get_concurrent_cache_59(cache, &key, &val);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+    size_t size = 59;
+    err = size_concurrent_cache_59(cache, &size);
+    printf("Assert: ERR_NONE == %d = size_concurrent_cache() after remove\n", err);
+    assert(ERR_NONE == err && 0 == size);
+
+    // Test scan resistance
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test a scan against a hot working set...");
+
+    // Hot keys are read often enough to be protected before the scan starts.
+    for (u64 round = 0; round <= TEST_HOT_READS; round++)
+    {
+        for (key = 0; key < TEST_HOT_KEYS; key++)
+        {
+            val = key;
+            if (ERR_OBJ_NOT_FOUND == get_concurrent_cache_59(cache, &key, &val))
+                err = put_concurrent_cache_59(cache, &key, &val);
+            assert(ERR_NONE == err && key == val);
+        }
+    }
+
+    // An LRU of the same capacity would hold nothing but scan keys after this.
+    for (key = TEST_CAPACITY; key < TEST_CAPACITY + TEST_SCAN_KEYS; key++)
+    {
+        val = key;
+        if (ERR_OBJ_NOT_FOUND == get_concurrent_cache_59(cache, &key, &val))
+            err = put_concurrent_cache_59(cache, &key, &val);
+        assert(ERR_NONE == err);
+    }
+
+    err = size_concurrent_cache_59(cache, &size);
+    printf("Assert: ERR_NONE == %d = size_concurrent_cache() %zu after the scan\n", err, size);
+    assert(ERR_NONE == err && TEST_CAPACITY == size);
+
+    size_t hot_hits = 0;
+    for (key = 0; key < TEST_HOT_KEYS; key++)
+    {
+        if (ERR_NONE == get_concurrent_cache_59(cache, &key, &val) && key == val)
+            hot_hits++;
+    }
+    err = stats_concurrent_cache_59(cache, &stats);
+    printf("Assert: %zu of %d hot keys survived the scan, %lu rejections\n", hot_hits, TEST_HOT_KEYS, stats.rejections);
+    assert(ERR_NONE == err && TEST_HOT_KEYS - 1 <= hot_hits);
+    assert(TEST_SCAN_KEYS + TEST_HOT_KEYS - TEST_CAPACITY == stats.evictions + stats.rejections);
+
+    err = deinit_concurrent_cache_59(&cache);
+    printf("Assert: ERR_NONE == %d = deinit_concurrent_cache()\n", err);
+    assert(ERR_NONE == err && !cache);
+
+    // Test STR keys
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test STR keys...");
+
+    err = init_concurrent_cache_59(&cache, STR, U32_PTR, 2, 0);
+    printf("Assert: ERR_NONE == %d = init_concurrent_cache() STR keys, default shards\n", err);
+    assert(ERR_NONE == err && 1 == cache->shard_mask && 0 == cache->key_size);
+
+    u32 small_val = 5;
+    err = put_concurrent_cache_59(cache, "alpha", &small_val);
+    assert(ERR_NONE == err);
+    small_val = 0;
+    err = get_concurrent_cache_59(cache, "alph", &small_val);
+    assert(ERR_OBJ_NOT_FOUND == err);
+    err = get_concurrent_cache_59(cache, "alpha", &small_val);
+    printf("Assert: ERR_NONE == %d = get_concurrent_cache() STR key\n", err);
+    assert(ERR_NONE == err && 5 == small_val);
+    err = remove_from_concurrent_cache_59(cache, "alpha");
+    assert(ERR_NONE == err);
+
+    err = deinit_concurrent_cache_59(&cache);
+    assert(ERR_NONE == err);
+
+    // Test threads sharing a cache
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test threads sharing a cache...");
+
+    err = init_concurrent_cache_59(&shared_cache, U64_PTR, U64_PTR, TEST_CAPACITY * 2, 8);
+    assert(ERR_NONE == err && 7 == shared_cache->shard_mask);
+
+    thrd_t workers[TEST_THREADS];
+    for (size_t i = 0; i < TEST_THREADS; i++)
+    {
+        if (thrd_success != thrd_create(&workers[i], _worker_thread, (void*)i))
+            return ERR_INTRNL;
+    }
+    for (size_t i = 0; i < TEST_THREADS; i++)
+        thrd_join(workers[i], (void*)0);
+
+    printf("Assert: 0 == %zu bad reads\n", atomic_load(&bad_reads));
+    assert(0 == atomic_load(&bad_reads));
+
+    err = size_concurrent_cache_59(shared_cache, &size);
+    assert(ERR_NONE == err && TEST_CAPACITY * 2 >= size);
+    err = stats_concurrent_cache_59(shared_cache, &stats);
+    printf("Assert: %zu == %lu gets counted\n", atomic_load(&gets), stats.hits + stats.misses);
+    assert(ERR_NONE == err && atomic_load(&gets) == stats.hits + stats.misses);
+
+    // Test clean up
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test clean up...");
+    err = deinit_concurrent_cache_59(&shared_cache);
+
+    return err;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    puts("- - -  START OF CONCURRENT CACHE TEST  - - -");
+    puts("- - - CONCURRENT CACHE INTERFACE - - -");
+
+    ERR_59_e err = test_concurrent_cache_59_interface();
+    printf("ERROR CODE: %d\n", err);
+    assert(ERR_NONE == err);
+
+    puts("- - - - END OF CONCURRENT CACHE TEST - - - -");
+    return err;
+}
@@ -0,0 +1,229 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Benchmark of read heavy multi-threaded throughput, the concurrent hash map against a hash map behind one
+ * global mutex.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <threads.h>
+#include <time.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "concurrent_hash_map.h"
+#include "hash_map.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Default maximum thread count, override with the first program argument. Thread counts double from 1.
+ **********************************************************************************************************************/
+#define BENCH_DEFAULT_MAX_THREADS 8
+
+/***********************************************************************************************************************
+ * @brief: Default operations per thread, override with the second program argument.
+ **********************************************************************************************************************/
+#define BENCH_DEFAULT_OPS (1UL << 20)
+
+/***********************************************************************************************************************
+ * @brief: Number of keys preloaded and accessed.
+ **********************************************************************************************************************/
+#define BENCH_KEYS (1UL << 16)
+
+/***********************************************************************************************************************
+ * @brief: One in this many operations is an upsert, the rest are gets.
+ **********************************************************************************************************************/
+#define BENCH_UPSERT_EVERY 10
+
+/*
+========================================================================================================================
+- - BENCH HELPERS - -
+========================================================================================================================
+*/
+
+typedef struct bench_worker_59
+{
+    thrd_t thread;
+    size_t id;
+    size_t ops;
+    u64 checksum;
+} bench_worker_59;
+
+static concurrent_hash_map_59* concurrent_map = (void*)0;
+static hash_map_59* locked_map = (void*)0;
+static mtx_t locked_map_lock;
+static atomic_bool start_flag = false;
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static u64 xorshift(u64* state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+static int concurrent_worker(void* arg)
+{
+    bench_worker_59* worker = arg;
+    u64 rng = 59 + worker->id;
+    while (!atomic_load(&start_flag))
+        thrd_yield();
+
+    for (size_t i = 0; i < worker->ops; i++)
+    {
+        u64 key = xorshift(&rng) % BENCH_KEYS;
+        u64 val = key;
+        if (0 == i % BENCH_UPSERT_EVERY)
+            upsert_into_concurrent_hash_map_59(concurrent_map, &key, &val);
+        else if (ERR_NONE == get_from_concurrent_hash_map_59(concurrent_map, &key, &val))
+            worker->checksum += val;
+    }
+
+    return 0;
+}
+
+static int locked_worker(void* arg)
+{
+    bench_worker_59* worker = arg;
+    u64 rng = 59 + worker->id;
+    while (!atomic_load(&start_flag))
+        thrd_yield();
+
+    for (size_t i = 0; i < worker->ops; i++)
+    {
+        u64 key = xorshift(&rng) % BENCH_KEYS;
+        void* val = (void*)0;
+        mtx_lock(&locked_map_lock);
+        if (0 == i % BENCH_UPSERT_EVERY)
+            upsert_into_hash_map_59(locked_map, &key, &key);
+        else if (ERR_NONE == get_from_hash_map_59(locked_map, &key, &val))
+            worker->checksum += *(u64*)val;
+        mtx_unlock(&locked_map_lock);
+    }
+
+    return 0;
+}
+
+static double run_workers(thrd_start_t func, bench_worker_59* workers, size_t const threads, size_t const ops)
+{
+    atomic_store(&start_flag, false);
+    for (size_t t = 0; t < threads; t++)
+    {
+        workers[t].id = t;
+        workers[t].ops = ops;
+        workers[t].checksum = 0;
+        if (thrd_success != thrd_create(&workers[t].thread, func, &workers[t]))
+            return -1.0;
+    }
+
+    double const start = now_ns();
+    atomic_store(&start_flag, true);
+    for (size_t t = 0; t < threads; t++)
+        thrd_join(workers[t].thread, (void*)0);
+    double const elapsed = now_ns() - start;
+
+    // Million operations per second across all threads.
+    return (double)(threads * ops) / elapsed * 1e3;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    size_t const max_threads = (1 < argc) ? strtoul(argv[1], (void*)0, 10) : BENCH_DEFAULT_MAX_THREADS;
+    size_t const ops = (2 < argc) ? strtoul(argv[2], (void*)0, 10) : BENCH_DEFAULT_OPS;
+    if (0 == max_threads || 0 == ops)
+        return ERR_INV_PARAM;
+
+    bench_worker_59* workers = malloc(sizeof(bench_worker_59) * max_threads);
+    if (!workers)
+        return ERR_NO_MEM;
+
+    ERR_59_e err = init_concurrent_hash_map_59(&concurrent_map, U64_PTR, U64_PTR, 0);
+    if (ERR_NONE != err)
+        return err;
+    err = init_copy_hash_map_59(&locked_map, U64_PTR, U64_PTR, 0, BENCH_KEYS, 0);
+    if (ERR_NONE != err)
+        return err;
+    if (thrd_success != mtx_init(&locked_map_lock, mtx_plain))
+        return ERR_INTRNL;
+
+    for (u64 key = 0; key < BENCH_KEYS; key++)
+    {
+        err = upsert_into_concurrent_hash_map_59(concurrent_map, &key, &key);
+        if (ERR_NONE != err)
+            return err;
+        err = upsert_into_hash_map_59(locked_map, &key, &key);
+        if (ERR_NONE != err)
+            return err;
+    }
+
+    printf("keys: %lu, ops per thread: %zu, upserts: 1 in %d\n", BENCH_KEYS, ops, BENCH_UPSERT_EVERY);
+    printf("threads   concurrent_hash_map   global mutex hash_map   (Mops/s)\n");
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        double const concurrent_mops = run_workers(concurrent_worker, workers, threads, ops);
+        double const locked_mops = run_workers(locked_worker, workers, threads, ops);
+        if (0 > concurrent_mops || 0 > locked_mops)
+            return ERR_INTRNL;
+        printf("%7zu   %19.2f   %21.2f\n", threads, concurrent_mops, locked_mops);
+    }
+
+    deinit_concurrent_hash_map_59(&concurrent_map);
+    deinit_hash_map_59(&locked_map);
+    mtx_destroy(&locked_map_lock);
+    free(workers);
+
+    return ERR_NONE;
+}
@@ -0,0 +1,263 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Contains all the declarations for a thread safe hash map with striped writer locks and lock-free readers.
+ **********************************************************************************************************************/
+
+#pragma once
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <threads.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "containers_common.h"
+#include "epoch.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Number of writer locks, a key's stripe is the low bits of its hash. Must be a power of two.
+ **********************************************************************************************************************/
+#define CONCURRENT_HASH_MAP_STRIPES 64
+
+/***********************************************************************************************************************
+ * @brief: Default number of buckets, tables are never smaller than @CONCURRENT_HASH_MAP_STRIPES.
+ **********************************************************************************************************************/
+#define DEFAULT_CONCURRENT_HASH_MAP_TABLE_SIZE 64
+
+/***********************************************************************************************************************
+ * @brief: Average entries per bucket above which an upsert doubles the table.
+ **********************************************************************************************************************/
+#define CONCURRENT_HASH_MAP_MAX_LOAD 2
+
+/***********************************************************************************************************************
+ * @brief: Seed passed to @hash_node_obj_59 for every key.
+ **********************************************************************************************************************/
+#define CONCURRENT_HASH_MAP_SEED (59UL)
+
+/*
+========================================================================================================================
+- - TYPEDEFS - -
+========================================================================================================================
+*/
+
+typedef struct concurrent_hash_map_node_59 concurrent_hash_map_node_59;
+typedef struct concurrent_hash_map_table_59 concurrent_hash_map_table_59;
+typedef struct concurrent_hash_map_stripe_59 concurrent_hash_map_stripe_59;
+typedef struct concurrent_hash_map_59 concurrent_hash_map_59;
+
+/*
+========================================================================================================================
+- - STRUCTS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @concurrent_hash_map_node_59
+ * @brief: A single allocation entry of a concurrent hash map, nodes are never modified once published so a reader
+ * walking a chain always sees a consistent key and value.
+ *
+ * @next: Next node in the bucket chain.
+ * @retire: Epoch node used to defer freeing the entry until no reader can hold it.
+ * @hash: Full width hash of the key.
+ * @data_size: Number of bytes in @data.
+ * @val_offset: Offset of the value bytes in @data, aligned to u64.
+ * @data: Key bytes followed by the value bytes.
+ **********************************************************************************************************************/
+struct concurrent_hash_map_node_59
+{
+    _Atomic(concurrent_hash_map_node_59*) next;
+    epoch_node_59 retire;
+    u64 hash;
+    size_t data_size;
+    size_t val_offset;
+    u8 data[];
+};
+
+/***********************************************************************************************************************
+ * @concurrent_hash_map_table_59
+ * @brief: Bucket array of a concurrent hash map, a resize publishes a new table and retires the old one.
+ *
+ * @retire: Epoch node used to defer freeing the table until no reader can hold it.
+ * @mask: Number of buckets minus one, the bucket count is always a power of two.
+ * @buckets: Heads of the bucket chains.
+ **********************************************************************************************************************/
+struct concurrent_hash_map_table_59
+{
+    epoch_node_59 retire;
+    size_t mask;
+    _Atomic(concurrent_hash_map_node_59*) buckets[];
+};
+
+/***********************************************************************************************************************
+ * @concurrent_hash_map_stripe_59
+ * @brief: Writer lock guarding every bucket whose index shares its low bits, padded to a cache line.
+ *
+ * @lock: Mutex taken by writers of the stripe.
+ **********************************************************************************************************************/
+struct concurrent_hash_map_stripe_59
+{
+    _Alignas(64) mtx_t lock;
+};
+
+/***********************************************************************************************************************
+ * @concurrent_hash_map_59
+ * @brief: A thread safe hash map, writers lock one of @CONCURRENT_HASH_MAP_STRIPES stripes while readers take no locks
+ * and are protected by the epoch module. Keys and values are copied in.
+ *
+ * @key_type: Type of the keys, must be a fixed size type or STR.
+ * @val_type: Type of the values, must be a fixed size type.
+ * @key_size: Size of a key in bytes, 0 for STR keys.
+ * @val_size: Size of a value in bytes.
+ * @table: Current bucket array.
+ * @stripes: Writer locks.
+ * @size: Number of entries held by the map.
+ *
+ * @note Resizing takes every stripe lock so writers wait, readers keep using the old table until the new one is
+ * published.
+ **********************************************************************************************************************/
+struct concurrent_hash_map_59
+{
+    TYPE_59_e key_type;
+    TYPE_59_e val_type;
+    size_t key_size;
+    size_t val_size;
+    _Atomic(concurrent_hash_map_table_59*) table;
+    concurrent_hash_map_stripe_59* stripes;
+    atomic_size_t size;
+};
+
+/*
+========================================================================================================================
+- - MODULE FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Initializes a concurrent hash map based on the passed parameters.
+ *
+ * @param[out] map: Pointer to a @concurrent_hash_map_59 pointer to initialize the map in.
+ * @param[in] key_type: Type of the keys, must be a fixed size type or STR.
+ * @param[in] val_type: Type of the values, must be a fixed size type.
+ * @param[in] table_size: Number of buckets, rounded up to a power of two no smaller than
+ * @CONCURRENT_HASH_MAP_STRIPES. If 0 then @DEFAULT_CONCURRENT_HASH_MAP_TABLE_SIZE is used.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @warning This will need to be freed with @deinit_concurrent_hash_map_59 when its lifetime has expired.
+ **********************************************************************************************************************/
+ERR_59_e init_concurrent_hash_map_59(concurrent_hash_map_59** map,
+                                     TYPE_59_e const key_type,
+                                     TYPE_59_e const val_type,
+                                     size_t const table_size);
+
+/***********************************************************************************************************************
+ * @brief: Deallocates the passed map and all of its entries.
+ *
+ * @param[out] map: Pointer to a concurrent_hash_map_59 pointer that will be freed.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note The pointer to the map will be (void*)0 on return.
+ *
+ * @warning No other thread may be using the map, this is the only function that is not thread safe.
+ **********************************************************************************************************************/
+ERR_59_e deinit_concurrent_hash_map_59(concurrent_hash_map_59** map);
+
+/***********************************************************************************************************************
+ * @brief: Inserts a copy of the key and value, or replaces the value of a key already in the map.
+ *
+ * @param[in] map: Map to upsert into.
+ * @param[in] key: Key to copy in.
+ * @param[in] val: Value to copy in.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Grows the table when the map holds more than @CONCURRENT_HASH_MAP_MAX_LOAD entries per bucket.
+ **********************************************************************************************************************/
+ERR_59_e upsert_into_concurrent_hash_map_59(concurrent_hash_map_59* const map,
+                                            void const* const key,
+                                            void const* const val);
+
+/***********************************************************************************************************************
+ * @brief: Copies the value held at the passed key into @val without taking any lock.
+ *
+ * @param[in] map: Map to read from.
+ * @param[in] key: Key to look for.
+ * @param[out] val: Buffer of at least the value size that receives a copy of the value.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note ERR_OBJ_NOT_FOUND is returned when the key is not in the map.
+ **********************************************************************************************************************/
+ERR_59_e get_from_concurrent_hash_map_59(concurrent_hash_map_59* const map, void const* const key, void* const val);
+
+/***********************************************************************************************************************
+ * @brief: Removes the passed key from the map, its entry is freed once no reader can still hold it.
+ *
+ * @param[in] map: Map to remove the key from.
+ * @param[in] key: Key to remove.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e remove_from_concurrent_hash_map_59(concurrent_hash_map_59* const map, void const* const key);
+
+/***********************************************************************************************************************
+ * @brief: Rebuilds the map's table with the passed number of buckets while readers continue on the old table.
+ *
+ * @param[in] map: Map to resize.
+ * @param[in] new_size: Number of buckets, rounded up to a power of two no smaller than @CONCURRENT_HASH_MAP_STRIPES.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e resize_table_concurrent_hash_map_59(concurrent_hash_map_59* const map, size_t const new_size);
+
+/***********************************************************************************************************************
+ * @brief: Reads the number of entries in the map.
+ *
+ * @param[in] map: Map to read.
+ * @param[out] size: Number of entries at the time of the call.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e size_concurrent_hash_map_59(concurrent_hash_map_59* const map, size_t* const size);
@@ -0,0 +1,585 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Contains all the definitions for a thread safe hash map with striped writer locks and lock-free readers.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "concurrent_hash_map.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Alignment of the value bytes inside a node's data.
+ **********************************************************************************************************************/
+#define CONCURRENT_HASH_MAP_DATA_ALIGN (sizeof(u64))
+
+/*
+========================================================================================================================
+- - INTERNAL FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Epoch reclaim callback freeing a retired node.
+ *
+ * @param[in] retire: Retire member of the node.
+ **********************************************************************************************************************/
+static void _reclaim_node_concurrent_hash_map_59(epoch_node_59* retire)
+{
+    free((u8*)retire - offsetof(concurrent_hash_map_node_59, retire));
+}
+
+/***********************************************************************************************************************
+ * @brief: Epoch reclaim callback freeing a retired table.
+ *
+ * @param[in] retire: Retire member of the table.
+ **********************************************************************************************************************/
+static void _reclaim_table_concurrent_hash_map_59(epoch_node_59* retire)
+{
+    free((u8*)retire - offsetof(concurrent_hash_map_table_59, retire));
+}
+
+/***********************************************************************************************************************
+ * @brief: Rounds a requested bucket count up to a power of two no smaller than @CONCURRENT_HASH_MAP_STRIPES, so every
+ * bucket belongs to exactly one stripe.
+ *
+ * @param[in] requested: Requested bucket count.
+ * @param[out] buckets: Rounded bucket count.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _round_table_size_concurrent_hash_map_59(size_t const requested, size_t* const buckets)
+{
+    size_t rounded = CONCURRENT_HASH_MAP_STRIPES;
+    while (rounded < requested)
+    {
+        if (rounded > SIZE_MAX / 2)
+            return ERR_INV_PARAM;
+        rounded <<= 1;
+    }
+
+    *buckets = rounded;
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Allocates an empty table.
+ *
+ * @param[in] buckets: Number of buckets, a power of two.
+ * @param[out] table: Allocated table.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _alloc_table_concurrent_hash_map_59(size_t const buckets, concurrent_hash_map_table_59** table)
+{
+    concurrent_hash_map_table_59* new_table =
+        malloc(sizeof(concurrent_hash_map_table_59) + sizeof(_Atomic(concurrent_hash_map_node_59*)) * buckets);
+    if (!new_table)
+        return ERR_NO_MEM;
+
+    new_table->mask = buckets - 1;
+    for (size_t i = 0; i < buckets; i++)
+        atomic_init(&new_table->buckets[i], (void*)0);
+
+    *table = new_table;
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Frees every node of a table and the table itself, only for tables no reader can reach.
+ *
+ * @param[in] table: Table to free.
+ **********************************************************************************************************************/
+static void _free_table_concurrent_hash_map_59(concurrent_hash_map_table_59* table)
+{
+    for (size_t i = 0; i <= table->mask; i++)
+    {
+        concurrent_hash_map_node_59* node = atomic_load_explicit(&table->buckets[i], memory_order_relaxed);
+        while (node)
+        {
+            concurrent_hash_map_node_59* next = atomic_load_explicit(&node->next, memory_order_relaxed);
+            free(node);
+            node = next;
+        }
+    }
+
+    free(table);
+}
+
+/***********************************************************************************************************************
+ * @brief: Hashes a key and finds the number of key bytes to copy.
+ *
+ * @param[in] map: Map the key belongs to.
+ * @param[in] key: Key to hash.
+ * @param[out] hash: Full width hash of the key.
+ * @param[out] key_len: Number of bytes in the key, including the terminator for STR keys.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _hash_key_concurrent_hash_map_59(concurrent_hash_map_59 const* const map,
+                                                 void const* const key,
+                                                 u64* const hash,
+                                                 size_t* const key_len)
+{
+    *key_len = (STR == map->key_type) ? strlen(key) + 1 : map->key_size;
+    return hash_node_obj_59(map->key_type, key, CONCURRENT_HASH_MAP_SEED, hash);
+}
+
+/***********************************************************************************************************************
+ * @brief: Checks if a node holds the passed key.
+ *
+ * @param[in] map: Map the node belongs to.
+ * @param[in] node: Node to check.
+ * @param[in] key: Key to compare.
+ * @param[in] hash: Hash of @key, compared first so mismatches rarely touch the key bytes.
+ *
+ * @retval bool: true when the node holds @key.
+ **********************************************************************************************************************/
+static bool _node_has_key_concurrent_hash_map_59(concurrent_hash_map_59 const* const map,
+                                                 concurrent_hash_map_node_59 const* const node,
+                                                 void const* const key,
+                                                 u64 const hash)
+{
+    if (node->hash != hash)
+        return false;
+    if (STR == map->key_type)
+        return 0 == strcmp((char const*)node->data, key);
+    return 0 == memcmp(node->data, key, map->key_size);
+}
+
+/***********************************************************************************************************************
+ * @brief: Allocates an unpublished node holding copies of the key and value.
+ *
+ * @param[in] map: Map the node will belong to.
+ * @param[in] key: Key to copy.
+ * @param[in] key_len: Number of key bytes.
+ * @param[in] val: Value to copy.
+ * @param[in] hash: Hash of @key.
+ * @param[out] node: Allocated node.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _alloc_node_concurrent_hash_map_59(concurrent_hash_map_59 const* const map,
+                                                   void const* const key,
+                                                   size_t const key_len,
+                                                   void const* const val,
+                                                   u64 const hash,
+                                                   concurrent_hash_map_node_59** node)
+{
+    size_t const val_offset = (key_len + CONCURRENT_HASH_MAP_DATA_ALIGN - 1) / CONCURRENT_HASH_MAP_DATA_ALIGN *
+                              CONCURRENT_HASH_MAP_DATA_ALIGN;
+    size_t const data_size = val_offset + map->val_size;
+
+    concurrent_hash_map_node_59* new_node = malloc(sizeof(concurrent_hash_map_node_59) + data_size);
+    if (!new_node)
+        return ERR_NO_MEM;
+
+    atomic_init(&new_node->next, (void*)0);
+    new_node->hash = hash;
+    new_node->data_size = data_size;
+    new_node->val_offset = val_offset;
+    memcpy(new_node->data, key, key_len);
+    memcpy(new_node->data + val_offset, val, map->val_size);
+
+    *node = new_node;
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Builds a copy of every node of the current table in a new table and publishes it. Readers still walking the
+ * old table are untouched since its nodes are copied rather than relinked.
+ *
+ * @param[in] map: Map to rebuild, every stripe lock must be held.
+ * @param[in] buckets: Bucket count of the new table, a power of two no smaller than @CONCURRENT_HASH_MAP_STRIPES.
+ * @param[out] old_table: Replaced table, to be retired by the caller once the stripe locks are released. Set to
+ * (void*)0 when no rebuild was needed.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _rebuild_table_concurrent_hash_map_59(concurrent_hash_map_59* const map,
+                                                      size_t const buckets,
+                                                      concurrent_hash_map_table_59** old_table)
+{
+    *old_table = (void*)0;
+
+    concurrent_hash_map_table_59* table = atomic_load_explicit(&map->table, memory_order_relaxed);
+    if (table->mask + 1 == buckets)
+        return ERR_NONE;
+
+    concurrent_hash_map_table_59* new_table = (void*)0;
+    ERR_59_e err = _alloc_table_concurrent_hash_map_59(buckets, &new_table);
+    if (ERR_NONE != err)
+        return err;
+
+    for (size_t i = 0; i <= table->mask; i++)
+    {
+        concurrent_hash_map_node_59* node = atomic_load_explicit(&table->buckets[i], memory_order_relaxed);
+        for (; node; node = atomic_load_explicit(&node->next, memory_order_relaxed))
+        {
+            size_t const node_size = sizeof(concurrent_hash_map_node_59) + node->data_size;
+            concurrent_hash_map_node_59* copy = malloc(node_size);
+            if (!copy)
+            {
+                _free_table_concurrent_hash_map_59(new_table);
+                return ERR_NO_MEM;
+            }
+
+            copy->hash = node->hash;
+            copy->data_size = node->data_size;
+            copy->val_offset = node->val_offset;
+            memcpy(copy->data, node->data, node->data_size);
+
+            size_t const idx = (size_t)node->hash & new_table->mask;
+            atomic_init(&copy->next, atomic_load_explicit(&new_table->buckets[idx], memory_order_relaxed));
+            atomic_store_explicit(&new_table->buckets[idx], copy, memory_order_relaxed);
+        }
+    }
+
+    atomic_store_explicit(&map->table, new_table, memory_order_release);
+    *old_table = table;
+
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Retires every node of a replaced table and then the table itself.
+ *
+ * @param[in] table: Table no longer reachable from its map.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _retire_table_concurrent_hash_map_59(concurrent_hash_map_table_59* const table)
+{
+    ERR_59_e err = ERR_NONE;
+
+    for (size_t i = 0; i <= table->mask; i++)
+    {
+        concurrent_hash_map_node_59* node = atomic_load_explicit(&table->buckets[i], memory_order_relaxed);
+        while (node)
+        {
+            concurrent_hash_map_node_59* next = atomic_load_explicit(&node->next, memory_order_relaxed);
+            err = retire_epoch_59(&node->retire, _reclaim_node_concurrent_hash_map_59);
+            if (ERR_NONE != err)
+                return err;
+            node = next;
+        }
+    }
+
+    return retire_epoch_59(&table->retire, _reclaim_table_concurrent_hash_map_59);
+}
+
+/***********************************************************************************************************************
+ * @brief: Takes every stripe lock, rebuilds the table and retires the replaced one.
+ *
+ * @param[in] map: Map to resize.
+ * @param[in] buckets: Target bucket count, a power of two no smaller than @CONCURRENT_HASH_MAP_STRIPES.
+ * @param[in] expected: When not 0 the resize is skipped unless the table still has this many buckets, so writers that
+ * race to grow the same table only grow it once.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e
+_resize_locked_concurrent_hash_map_59(concurrent_hash_map_59* const map, size_t const buckets, size_t const expected)
+{
+    for (size_t i = 0; i < CONCURRENT_HASH_MAP_STRIPES; i++)
+        mtx_lock(&map->stripes[i].lock);
+
+    ERR_59_e err = ERR_NONE;
+    concurrent_hash_map_table_59* old_table = (void*)0;
+    concurrent_hash_map_table_59* table = atomic_load_explicit(&map->table, memory_order_relaxed);
+    if (0 == expected || table->mask + 1 == expected)
+        err = _rebuild_table_concurrent_hash_map_59(map, buckets, &old_table);
+
+    for (size_t i = CONCURRENT_HASH_MAP_STRIPES; i > 0; i--)
+        mtx_unlock(&map->stripes[i - 1].lock);
+
+    if (ERR_NONE != err || !old_table)
+        return err;
+
+    return _retire_table_concurrent_hash_map_59(old_table);
+}
+
+/*
+========================================================================================================================
+- - FUNCTION DEFINITIONS - -
+========================================================================================================================
+*/
+
+ERR_59_e init_concurrent_hash_map_59(concurrent_hash_map_59** map,
+                                     TYPE_59_e const key_type,
+                                     TYPE_59_e const val_type,
+                                     size_t const table_size)
+{
+    if (!map)
+        return ERR_INV_PARAM;
+
+    size_t key_size = 0;
+    size_t val_size = 0;
+    if (STR != key_type && ERR_NONE != get_type_size_59(key_type, &key_size))
+        return ERR_NOT_SUPPORTED;
+    if (ERR_NONE != get_type_size_59(val_type, &val_size))
+        return ERR_NOT_SUPPORTED;
+
+    size_t buckets = 0;
+    ERR_59_e err = _round_table_size_concurrent_hash_map_59(
+        (0 != table_size) ? table_size : DEFAULT_CONCURRENT_HASH_MAP_TABLE_SIZE, &buckets);
+    if (ERR_NONE != err)
+        return err;
+
+    concurrent_hash_map_59* new_map = malloc(sizeof(concurrent_hash_map_59));
+    if (!new_map)
+        return ERR_NO_MEM;
+
+    new_map->stripes =
+        aligned_alloc(_Alignof(concurrent_hash_map_stripe_59),
+                      sizeof(concurrent_hash_map_stripe_59) * CONCURRENT_HASH_MAP_STRIPES);
+    if (!new_map->stripes)
+    {
+        free(new_map);
+        return ERR_NO_MEM;
+    }
+
+    for (size_t i = 0; i < CONCURRENT_HASH_MAP_STRIPES; i++)
+    {
+        if (thrd_success != mtx_init(&new_map->stripes[i].lock, mtx_plain))
+        {
+            while (i > 0)
+                mtx_destroy(&new_map->stripes[--i].lock);
+            free(new_map->stripes);
+            free(new_map);
+            return ERR_INTRNL;
+        }
+    }
+
+    concurrent_hash_map_table_59* table = (void*)0;
+    err = _alloc_table_concurrent_hash_map_59(buckets, &table);
+    if (ERR_NONE != err)
+    {
+        for (size_t i = 0; i < CONCURRENT_HASH_MAP_STRIPES; i++)
+            mtx_destroy(&new_map->stripes[i].lock);
+        free(new_map->stripes);
+        free(new_map);
+        return err;
+    }
+
+    new_map->key_type = key_type;
+    new_map->val_type = val_type;
+    new_map->key_size = key_size;
+    new_map->val_size = val_size;
+    atomic_init(&new_map->table, table);
+    atomic_init(&new_map->size, 0);
+
+    *map = new_map;
+
+    return ERR_NONE;
+}
+
+ERR_59_e deinit_concurrent_hash_map_59(concurrent_hash_map_59** map)
+{
+    if (!map || !(*map))
+        return ERR_INV_PARAM;
+
+    _free_table_concurrent_hash_map_59(atomic_load(&(*map)->table));
+
+    for (size_t i = 0; i < CONCURRENT_HASH_MAP_STRIPES; i++)
+        mtx_destroy(&(*map)->stripes[i].lock);
+
+    free((*map)->stripes);
+    free((*map));
+    *map = (void*)0;
+
+    // Reclaim entries retired by earlier writers, skipped when the caller is itself inside an epoch.
+    flush_epoch_59();
+
+    return ERR_NONE;
+}
+
+ERR_59_e upsert_into_concurrent_hash_map_59(concurrent_hash_map_59* const map,
+                                            void const* const key,
+                                            void const* const val)
+{
+    if (!map || !key || !val)
+        return ERR_INV_PARAM;
+
+    u64 hash = 0;
+    size_t key_len = 0;
+    ERR_59_e err = _hash_key_concurrent_hash_map_59(map, key, &hash, &key_len);
+    if (ERR_NONE != err)
+        return err;
+
+    // Allocate before locking so the stripe is only held for the relink.
+    concurrent_hash_map_node_59* new_node = (void*)0;
+    err = _alloc_node_concurrent_hash_map_59(map, key, key_len, val, hash, &new_node);
+    if (ERR_NONE != err)
+        return err;
+
+    mtx_t* lock = &map->stripes[hash & (CONCURRENT_HASH_MAP_STRIPES - 1)].lock;
+    mtx_lock(lock);
+
+    // A resize needs every stripe lock, so the table cannot change while this one is held.
+    concurrent_hash_map_table_59* table = atomic_load_explicit(&map->table, memory_order_acquire);
+    size_t const buckets = table->mask + 1;
+    _Atomic(concurrent_hash_map_node_59*)* link = &table->buckets[(size_t)hash & table->mask];
+    concurrent_hash_map_node_59* node = atomic_load_explicit(link, memory_order_relaxed);
+    while (node && !_node_has_key_concurrent_hash_map_59(map, node, key, hash))
+    {
+        link = &node->next;
+        node = atomic_load_explicit(link, memory_order_relaxed);
+    }
+
+    size_t size = 0;
+    if (node)
+        atomic_init(&new_node->next, atomic_load_explicit(&node->next, memory_order_relaxed));
+    else
+    {
+        atomic_init(&new_node->next, atomic_load_explicit(link, memory_order_relaxed));
+        size = atomic_fetch_add_explicit(&map->size, 1, memory_order_relaxed) + 1;
+    }
+    atomic_store_explicit(link, new_node, memory_order_release);
+
+    mtx_unlock(lock);
+
+    // The replaced node stays readable until every reader that could have reached it has left its epoch.
+    if (node)
+        return retire_epoch_59(&node->retire, _reclaim_node_concurrent_hash_map_59);
+
+    if (size > buckets * CONCURRENT_HASH_MAP_MAX_LOAD && buckets <= SIZE_MAX / 2)
+        return _resize_locked_concurrent_hash_map_59(map, buckets * 2, buckets);
+
+    return ERR_NONE;
+}
+
+ERR_59_e get_from_concurrent_hash_map_59(concurrent_hash_map_59* const map, void const* const key, void* const val)
+{
+    if (!map || !key || !val)
+        return ERR_INV_PARAM;
+
+    u64 hash = 0;
+    size_t key_len = 0;
+    ERR_59_e err = _hash_key_concurrent_hash_map_59(map, key, &hash, &key_len);
+    if (ERR_NONE != err)
+        return err;
+
+    err = enter_epoch_59();
+    if (ERR_NONE != err)
+        return err;
+
+    concurrent_hash_map_table_59* table = atomic_load_explicit(&map->table, memory_order_acquire);
+    concurrent_hash_map_node_59* node =
+        atomic_load_explicit(&table->buckets[(size_t)hash & table->mask], memory_order_acquire);
+    while (node && !_node_has_key_concurrent_hash_map_59(map, node, key, hash))
+        node = atomic_load_explicit(&node->next, memory_order_acquire);
+
+    if (node)
+        memcpy(val, node->data + node->val_offset, map->val_size);
+    else
+        err = ERR_OBJ_NOT_FOUND;
+
+    exit_epoch_59();
+
+    return err;
+}
+
+ERR_59_e remove_from_concurrent_hash_map_59(concurrent_hash_map_59* const map, void const* const key)
+{
+    if (!map || !key)
+        return ERR_INV_PARAM;
+
+    u64 hash = 0;
+    size_t key_len = 0;
+    ERR_59_e err = _hash_key_concurrent_hash_map_59(map, key, &hash, &key_len);
+    if (ERR_NONE != err)
+        return err;
+
+    mtx_t* lock = &map->stripes[hash & (CONCURRENT_HASH_MAP_STRIPES - 1)].lock;
+    mtx_lock(lock);
+
+    concurrent_hash_map_table_59* table = atomic_load_explicit(&map->table, memory_order_acquire);
+    _Atomic(concurrent_hash_map_node_59*)* link = &table->buckets[(size_t)hash & table->mask];
+    concurrent_hash_map_node_59* node = atomic_load_explicit(link, memory_order_relaxed);
+    while (node && !_node_has_key_concurrent_hash_map_59(map, node, key, hash))
+    {
+        link = &node->next;
+        node = atomic_load_explicit(link, memory_order_relaxed);
+    }
+
+    if (node)
+    {
+        // Readers already on the node still see its next link, it is not modified by the unlink.
+        atomic_store_explicit(link, atomic_load_explicit(&node->next, memory_order_relaxed), memory_order_release);
+        atomic_fetch_sub_explicit(&map->size, 1, memory_order_relaxed);
+    }
+
+    mtx_unlock(lock);
+
+    if (!node)
+        return ERR_OBJ_NOT_FOUND;
+
+    return retire_epoch_59(&node->retire, _reclaim_node_concurrent_hash_map_59);
+}
+
+ERR_59_e resize_table_concurrent_hash_map_59(concurrent_hash_map_59* const map, size_t const new_size)
+{
+    if (!map || 0 == new_size)
+        return ERR_INV_PARAM;
+
+    size_t buckets = 0;
+    ERR_59_e err = _round_table_size_concurrent_hash_map_59(new_size, &buckets);
+    if (ERR_NONE != err)
+        return err;
+
+    return _resize_locked_concurrent_hash_map_59(map, buckets, 0);
+}
+
+ERR_59_e size_concurrent_hash_map_59(concurrent_hash_map_59* const map, size_t* const size)
+{
+    if (!map || !size)
+        return ERR_INV_PARAM;
+
+    *size = atomic_load_explicit(&map->size, memory_order_relaxed);
+
+    return ERR_NONE;
+}
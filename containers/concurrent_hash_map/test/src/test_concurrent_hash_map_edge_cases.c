@@ -0,0 +1,189 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Test cases for concurrent hash maps that cover edge cases and invalid parameters.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "concurrent_hash_map.h"
+
+/*
+========================================================================================================================
+- - UNIT TESTS - -
+========================================================================================================================
+*/
+
+ERR_59_e test_concurrent_hash_map_59_edge_cases(void)
+{
+    ERR_59_e err = ERR_NONE;
+
+    // Init concurrent_hash_map
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Initializing concurrent_hash_maps...");
+
+    concurrent_hash_map_59* map = (void*)0;
+    err = init_concurrent_hash_map_59(&map, U64_PTR, U64_PTR, 0);
+    if (ERR_NONE != err)
+        return err;
+
+    concurrent_hash_map_59* map_dummy = (void*)0;
+    u64 key = 59;
+    u64 val = 0;
+    size_t size = 0;
+
+    // Test init_concurrent_hash_map edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test init_concurrent_hash_map...");
+
+    err = init_concurrent_hash_map_59((void*)0, U64_PTR, U64_PTR, 0);
+    printf("Assert: ERR_INV_PARAM == %d = init_concurrent_hash_map() with void ptr\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = init_concurrent_hash_map_59(&map_dummy, STRUCT_PTR, U64_PTR, 0);
+    printf("Assert: ERR_NOT_SUPPORTED == %d = init_concurrent_hash_map() with unsized key type\n", err);
+    assert(ERR_NOT_SUPPORTED == err);
+
+    err = init_concurrent_hash_map_59(&map_dummy, U64_PTR, STR, 0);
+    printf("Assert: ERR_NOT_SUPPORTED == %d = init_concurrent_hash_map() with STR val type\n", err);
+    assert(ERR_NOT_SUPPORTED == err);
+
+    err = init_concurrent_hash_map_59(&map_dummy, U64_PTR, U64_PTR, SIZE_MAX);
+    printf("Assert: ERR_INV_PARAM == %d = init_concurrent_hash_map() with oversized table\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    // Test deinit_concurrent_hash_map edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test deinit_concurrent_hash_map...");
+
+    err = deinit_concurrent_hash_map_59((void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = deinit_concurrent_hash_map() with void ptr\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = deinit_concurrent_hash_map_59(&map_dummy);
+    printf("Assert: ERR_INV_PARAM == %d = deinit_concurrent_hash_map() with void map\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    // Test upsert, get and remove edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test upsert/get/remove_concurrent_hash_map...");
+
+    err = upsert_into_concurrent_hash_map_59(map_dummy, &key, &val);
+    printf("Assert: ERR_INV_PARAM == %d = upsert_into_concurrent_hash_map() with void map\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = upsert_into_concurrent_hash_map_59(map, (void*)0, &val);
+    printf("Assert: ERR_INV_PARAM == %d = upsert_into_concurrent_hash_map() with void key\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = upsert_into_concurrent_hash_map_59(map, &key, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = upsert_into_concurrent_hash_map() with void val\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = get_from_concurrent_hash_map_59(map, &key, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = get_from_concurrent_hash_map() with void out\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = get_from_concurrent_hash_map_59(map, &key, &val);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = get_from_concurrent_hash_map() on empty map\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+    err = remove_from_concurrent_hash_map_59(map, &key);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = remove_from_concurrent_hash_map() missing key\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+    err = remove_from_concurrent_hash_map_59(map, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = remove_from_concurrent_hash_map() with void key\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    // Test resize and size edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test resize_table/size_concurrent_hash_map...");
+
+    err = resize_table_concurrent_hash_map_59(map, 0);
+    printf("Assert: ERR_INV_PARAM == %d = resize_table_concurrent_hash_map() to 0\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = resize_table_concurrent_hash_map_59(map_dummy, 128);
+    printf("Assert: ERR_INV_PARAM == %d = resize_table_concurrent_hash_map() with void map\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = resize_table_concurrent_hash_map_59(map, DEFAULT_CONCURRENT_HASH_MAP_TABLE_SIZE);
+    printf("Assert: ERR_NONE == %d = resize_table_concurrent_hash_map() to the current size\n", err);
+    assert(ERR_NONE == err);
+
+    err = size_concurrent_hash_map_59(map, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = size_concurrent_hash_map() with void out\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = size_concurrent_hash_map_59(map, &size);
+    printf("Assert: 0 == %lu = size_concurrent_hash_map() on empty map\n", size);
+    assert(ERR_NONE == err && 0 == size);
+
+    // Test clean up
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test clean up...");
+    err = deinit_concurrent_hash_map_59(&map);
+
+    return err;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    puts("- - -  START OF CONCURRENT HASH MAP TEST  - - -");
+    puts("- - - CONCURRENT HASH MAP EDGE CASES - - -");
+
+    ERR_59_e err = test_concurrent_hash_map_59_edge_cases();
+    printf("ERROR CODE: %d\n", err);
+    assert(ERR_NONE == err);
+
+    puts("- - - - END OF CONCURRENT HASH MAP TEST - - - -");
+    return err;
+}
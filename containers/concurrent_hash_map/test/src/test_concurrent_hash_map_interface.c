@@ -0,0 +1,316 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Test cases for concurrent hash maps that cover the module interface.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <threads.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "concurrent_hash_map.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+#define TEST_KEYS 1000
+#define TEST_WRITERS 4
+#define TEST_READERS 4
+#define TEST_KEYS_PER_WRITER 2000
+
+/*
+========================================================================================================================
+- - INTERNAL TEST HELPERS - -
+========================================================================================================================
+*/
+
+static concurrent_hash_map_59* shared_map = (void*)0;
+static atomic_bool writers_done = false;
+static atomic_size_t bad_reads = 0;
+
+static int _writer_thread(void* arg)
+{
+    u64 const base = (u64)(size_t)arg * TEST_KEYS_PER_WRITER;
+    for (u64 i = 0; i < TEST_KEYS_PER_WRITER; i++)
+    {
+        u64 key = base + i;
+        u64 val = key * 2;
+        if (ERR_NONE != upsert_into_concurrent_hash_map_59(shared_map, &key, &val))
+            return 1;
+    }
+
+    // Remove every odd key so removals race with readers and resizes too.
+    for (u64 i = 1; i < TEST_KEYS_PER_WRITER; i += 2)
+    {
+        u64 key = base + i;
+        if (ERR_NONE != remove_from_concurrent_hash_map_59(shared_map, &key))
+            return 1;
+    }
+
+    return 0;
+}
+
+static int _reader_thread(void* arg)
+{
+    (void)arg;
+    u64 key = 0;
+    while (!atomic_load(&writers_done))
+    {
+        u64 val = 0;
+        ERR_59_e err = get_from_concurrent_hash_map_59(shared_map, &key, &val);
+        if ((ERR_NONE == err && val != key * 2) || (ERR_NONE != err && ERR_OBJ_NOT_FOUND != err))
+            atomic_fetch_add(&bad_reads, 1);
+        key = (key + 7) % (TEST_WRITERS * TEST_KEYS_PER_WRITER);
+    }
+
+    return 0;
+}
+
+/*
+========================================================================================================================
+- - UNIT TESTS - -
+========================================================================================================================
+*/
+
+ERR_59_e test_concurrent_hash_map_59_interface(void)
+{
+    ERR_59_e err = ERR_NONE;
+
+    // Init concurrent_hash_map
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Initializing concurrent_hash_maps...");
+
+    concurrent_hash_map_59* u64_map = (void*)0;
+    err = init_concurrent_hash_map_59(&u64_map, U64_PTR, U64_PTR, 0);
+    if (ERR_NONE != err)
+        return err;
+
+    concurrent_hash_map_59* str_map = (void*)0;
+    err = init_concurrent_hash_map_59(&str_map, STR, I32_PTR, 0);
+    if (ERR_NONE != err)
+        return err;
+
+    // Test upsert and get
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test upsert/get_concurrent_hash_map...");
+
+    for (u64 i = 0; i < TEST_KEYS; i++)
+    {
+        u64 val = i * 3;
+        err = upsert_into_concurrent_hash_map_59(u64_map, &i, &val);
+        assert(ERR_NONE == err);
+    }
+
+    size_t size = 0;
+    err = size_concurrent_hash_map_59(u64_map, &size);
+    printf("Assert: %d == %lu = size_concurrent_hash_map()\n", TEST_KEYS, size);
+    assert(ERR_NONE == err && TEST_KEYS == size);
+
+    size_t const buckets = atomic_load(&u64_map->table)->mask + 1;
+    printf("Assert: %lu > %d = table grew past its max load\n", buckets, DEFAULT_CONCURRENT_HASH_MAP_TABLE_SIZE);
+    assert(atomic_load(&u64_map->table)->mask + 1 > DEFAULT_CONCURRENT_HASH_MAP_TABLE_SIZE);
+
+    for (u64 i = 0; i < TEST_KEYS; i++)
+    {
+        u64 val = 0;
+        err = get_from_concurrent_hash_map_59(u64_map, &i, &val);
+        assert(ERR_NONE == err && i * 3 == val);
+    }
+    puts("Assert: all values found after growing");
+
+    u64 key = 59;
+    u64 val = 5959;
+    err = upsert_into_concurrent_hash_map_59(u64_map, &key, &val);
+    printf("Assert: ERR_NONE == %d = upsert_into_concurrent_hash_map() replace\n", err);
+    assert(ERR_NONE == err);
+    val = 0;
+    err = get_from_concurrent_hash_map_59(u64_map, &key, &val);
+    printf("Assert: 5959 == %lu = get_from_concurrent_hash_map() replaced\n", val);
+    assert(ERR_NONE == err && 5959 == val);
+    err = size_concurrent_hash_map_59(u64_map, &size);
+    assert(ERR_NONE == err && TEST_KEYS == size);
+
+    char key_a[] = "concurrent";
+    char key_b[] = "hash map";
+    i32 str_val = -59;
+    err = upsert_into_concurrent_hash_map_59(str_map, key_a, &str_val);
+    assert(ERR_NONE == err);
+    str_val = 59;
+    err = upsert_into_concurrent_hash_map_59(str_map, key_b, &str_val);
+    assert(ERR_NONE == err);
+
+    // The map holds its own copy, so changing the caller's key must not matter.
+    key_a[0] = 'C';
+    err = get_from_concurrent_hash_map_59(str_map, "concurrent", &str_val);
+    printf("Assert: -59 == %d = get_from_concurrent_hash_map() copied str key\n", str_val);
+    assert(ERR_NONE == err && -59 == str_val);
+
+    err = get_from_concurrent_hash_map_59(str_map, key_a, &str_val);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = get_from_concurrent_hash_map() missing str key\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+    // Test remove
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test remove_from_concurrent_hash_map...");
+
+    for (u64 i = 0; i < TEST_KEYS; i += 2)
+    {
+        err = remove_from_concurrent_hash_map_59(u64_map, &i);
+        assert(ERR_NONE == err);
+    }
+    err = size_concurrent_hash_map_59(u64_map, &size);
+    printf("Assert: %d == %lu = size after removing evens\n", TEST_KEYS / 2, size);
+    assert(ERR_NONE == err && TEST_KEYS / 2 == size);
+
+    for (u64 i = 0; i < TEST_KEYS; i++)
+    {
+        err = get_from_concurrent_hash_map_59(u64_map, &i, &val);
+        assert((0 == i % 2) == (ERR_OBJ_NOT_FOUND == err));
+    }
+    puts("Assert: only odd keys remain");
+
+    // Test resize
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test resize_table_concurrent_hash_map...");
+
+    err = resize_table_concurrent_hash_map_59(u64_map, 100);
+    printf("Assert: ERR_NONE == %d = resize_table_concurrent_hash_map()\n", err);
+    assert(ERR_NONE == err);
+    printf("Assert: 128 == %lu = resize rounds up to a power of two\n", atomic_load(&u64_map->table)->mask + 1);
+    assert(128 == atomic_load(&u64_map->table)->mask + 1);
+
+    err = resize_table_concurrent_hash_map_59(u64_map, 1);
+    assert(ERR_NONE == err);
+    printf("Assert: %d == %lu = resize never goes below the stripe count\n", CONCURRENT_HASH_MAP_STRIPES,
+           atomic_load(&u64_map->table)->mask + 1);
+    assert(CONCURRENT_HASH_MAP_STRIPES == atomic_load(&u64_map->table)->mask + 1);
+
+    for (u64 i = 1; i < TEST_KEYS; i += 2)
+    {
+        err = get_from_concurrent_hash_map_59(u64_map, &i, &val);
+        assert(ERR_NONE == err && (59 == i ? 5959 : i * 3) == val);
+    }
+    puts("Assert: all values found after resizing");
+
+    // Test concurrent writers and readers
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test concurrent writers and readers...");
+
+    err = init_concurrent_hash_map_59(&shared_map, U64_PTR, U64_PTR, 0);
+    if (ERR_NONE != err)
+        return err;
+
+    thrd_t writers[TEST_WRITERS];
+    thrd_t readers[TEST_READERS];
+    for (size_t i = 0; i < TEST_READERS; i++)
+    {
+        if (thrd_success != thrd_create(&readers[i], _reader_thread, (void*)0))
+            return ERR_INTRNL;
+    }
+    for (size_t i = 0; i < TEST_WRITERS; i++)
+    {
+        if (thrd_success != thrd_create(&writers[i], _writer_thread, (void*)i))
+            return ERR_INTRNL;
+    }
+
+    int res = 0;
+    int failed = 0;
+    for (size_t i = 0; i < TEST_WRITERS; i++)
+    {
+        thrd_join(writers[i], &res);
+        failed |= res;
+    }
+    atomic_store(&writers_done, true);
+    for (size_t i = 0; i < TEST_READERS; i++)
+        thrd_join(readers[i], (void*)0);
+
+    printf("Assert: 0 == %d = writer failures\n", failed);
+    assert(0 == failed);
+    printf("Assert: 0 == %lu = bad reads\n", atomic_load(&bad_reads));
+    assert(0 == atomic_load(&bad_reads));
+
+    err = size_concurrent_hash_map_59(shared_map, &size);
+    printf("Assert: %d == %lu = size after concurrent writes\n", TEST_WRITERS * TEST_KEYS_PER_WRITER / 2, size);
+    assert(ERR_NONE == err && TEST_WRITERS * TEST_KEYS_PER_WRITER / 2 == size);
+
+    for (u64 i = 0; i < TEST_WRITERS * TEST_KEYS_PER_WRITER; i++)
+    {
+        err = get_from_concurrent_hash_map_59(shared_map, &i, &val);
+        assert((0 == i % 2) ? (ERR_NONE == err && i * 2 == val) : (ERR_OBJ_NOT_FOUND == err));
+    }
+    puts("Assert: every even key survived the concurrent writes");
+
+    // Test clean up
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test clean up...");
+    err = deinit_concurrent_hash_map_59(&u64_map);
+    assert(ERR_NONE == err);
+    err = deinit_concurrent_hash_map_59(&str_map);
+    assert(ERR_NONE == err);
+    err = deinit_concurrent_hash_map_59(&shared_map);
+    assert(ERR_NONE == err);
+
+    return err;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    puts("- - -  START OF CONCURRENT HASH MAP TEST  - - -");
+    puts("- - - INTERFACE TESTS - - -");
+
+    ERR_59_e err = test_concurrent_hash_map_59_interface();
+    printf("ERROR CODE: %d\n", err);
+    assert(ERR_NONE == err);
+
+    puts("- - - - END OF CONCURRENT HASH MAP TEST - - - -");
+    return err;
+}
@@ -0,0 +1,240 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Benchmark of producer/consumer throughput, the lock-free concurrent queue against a linked list behind one
+ * global mutex.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <threads.h>
+#include <time.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "concurrent_queue.h"
+#include "llist.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Default maximum number of producers, override with the first program argument. The counts double from 1
+ * and every run has as many consumers as producers.
+ **********************************************************************************************************************/
+#define BENCH_DEFAULT_MAX_THREADS 16
+
+/***********************************************************************************************************************
+ * @brief: Default nodes pushed per producer, override with the second program argument.
+ **********************************************************************************************************************/
+#define BENCH_DEFAULT_OPS (1UL << 18)
+
+/*
+========================================================================================================================
+- - BENCH HELPERS - -
+========================================================================================================================
+*/
+
+typedef struct bench_worker_59
+{
+    thrd_t thread;
+    llist_node_59* nodes;
+    size_t ops;
+} bench_worker_59;
+
+static concurrent_queue_59* concurrent = (void*)0;
+static llist_59* locked_list = (void*)0;
+static mtx_t locked_list_lock;
+static atomic_bool start_flag = false;
+static atomic_size_t popped = 0;
+static size_t total_ops = 0;
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static int concurrent_producer(void* arg)
+{
+    bench_worker_59* worker = arg;
+    while (!atomic_load(&start_flag))
+        thrd_yield();
+
+    for (size_t i = 0; i < worker->ops; i++)
+        push_concurrent_queue_59(concurrent, &worker->nodes[i]);
+
+    return 0;
+}
+
+static int concurrent_consumer(void* arg)
+{
+    (void)arg;
+    while (!atomic_load(&start_flag))
+        thrd_yield();
+
+    while (atomic_load_explicit(&popped, memory_order_relaxed) < total_ops)
+    {
+        llist_node_59* node = (void*)0;
+        if (ERR_NONE == pop_concurrent_queue_59(concurrent, &node))
+            atomic_fetch_add_explicit(&popped, 1, memory_order_relaxed);
+    }
+
+    return 0;
+}
+
+static int locked_producer(void* arg)
+{
+    bench_worker_59* worker = arg;
+    while (!atomic_load(&start_flag))
+        thrd_yield();
+
+    for (size_t i = 0; i < worker->ops; i++)
+    {
+        mtx_lock(&locked_list_lock);
+        push_back_llist_59(locked_list, &worker->nodes[i]);
+        mtx_unlock(&locked_list_lock);
+    }
+
+    return 0;
+}
+
+static int locked_consumer(void* arg)
+{
+    (void)arg;
+    while (!atomic_load(&start_flag))
+        thrd_yield();
+
+    while (atomic_load_explicit(&popped, memory_order_relaxed) < total_ops)
+    {
+        llist_node_59* node = (void*)0;
+        mtx_lock(&locked_list_lock);
+        ERR_59_e const err = pop_front_llist_59(locked_list, &node);
+        mtx_unlock(&locked_list_lock);
+        if (ERR_NONE == err)
+            atomic_fetch_add_explicit(&popped, 1, memory_order_relaxed);
+    }
+
+    return 0;
+}
+
+static double run_workers(thrd_start_t producer, thrd_start_t consumer, bench_worker_59* producers,
+                          bench_worker_59* consumers, size_t const threads)
+{
+    atomic_store(&start_flag, false);
+    atomic_store(&popped, 0);
+    total_ops = threads * producers[0].ops;
+    for (size_t t = 0; t < threads; t++)
+    {
+        if (thrd_success != thrd_create(&producers[t].thread, producer, &producers[t]))
+            return -1.0;
+        if (thrd_success != thrd_create(&consumers[t].thread, consumer, &consumers[t]))
+            return -1.0;
+    }
+
+    double const start = now_ns();
+    atomic_store(&start_flag, true);
+    for (size_t t = 0; t < threads; t++)
+    {
+        thrd_join(producers[t].thread, (void*)0);
+        thrd_join(consumers[t].thread, (void*)0);
+    }
+    double const elapsed = now_ns() - start;
+
+    // Million nodes moved from a producer to a consumer per second.
+    return (double)total_ops / elapsed * 1e3;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    size_t const max_threads = (1 < argc) ? strtoul(argv[1], (void*)0, 10) : BENCH_DEFAULT_MAX_THREADS;
+    size_t const ops = (2 < argc) ? strtoul(argv[2], (void*)0, 10) : BENCH_DEFAULT_OPS;
+    if (0 == max_threads || 0 == ops)
+        return ERR_INV_PARAM;
+
+    bench_worker_59* producers = malloc(sizeof(bench_worker_59) * max_threads);
+    bench_worker_59* consumers = malloc(sizeof(bench_worker_59) * max_threads);
+    llist_node_59* nodes = calloc(max_threads * ops, sizeof(llist_node_59));
+    if (!producers || !consumers || !nodes)
+        return ERR_NO_MEM;
+    for (size_t t = 0; t < max_threads; t++)
+    {
+        producers[t].nodes = &nodes[t * ops];
+        producers[t].ops = ops;
+    }
+
+    // The nodes belong to the bench, the intrusive list never frees them.
+    ERR_59_e err = init_concurrent_queue_59(&concurrent);
+    if (ERR_NONE != err)
+        return err;
+    err = init_intrusive_llist_59(&locked_list, VOID_0, 0, 0);
+    if (ERR_NONE != err)
+        return err;
+    if (thrd_success != mtx_init(&locked_list_lock, mtx_plain))
+        return ERR_INTRNL;
+
+    printf("nodes per producer: %zu, consumers per producer: 1\n", ops);
+    printf("producers   concurrent_queue   global mutex llist   (Mnodes/s)\n");
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        double const concurrent_mops =
+            run_workers(concurrent_producer, concurrent_consumer, producers, consumers, threads);
+        double const locked_mops = run_workers(locked_producer, locked_consumer, producers, consumers, threads);
+        if (0 > concurrent_mops || 0 > locked_mops)
+            return ERR_INTRNL;
+        printf("%9zu   %16.2f   %18.2f\n", threads, concurrent_mops, locked_mops);
+    }
+
+    deinit_concurrent_queue_59(&concurrent);
+    deinit_llist_59(&locked_list);
+    mtx_destroy(&locked_list_lock);
+    free(nodes);
+    free(consumers);
+    free(producers);
+
+    return ERR_NONE;
+}
@@ -0,0 +1,186 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: This file contains the declarations for a lock-free multi-producer multi-consumer queue of linked list nodes.
+ **********************************************************************************************************************/
+
+#pragma once
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "containers_common.h"
+#include "epoch.h"
+#include "llist.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Cache line size, the head and tail of a queue are kept on separate lines so producers and consumers do not
+ * invalidate each other.
+ **********************************************************************************************************************/
+#define CONCURRENT_QUEUE_CACHE_LINE 64
+
+/***********************************************************************************************************************
+ * @brief: Number of popped cells a thread gathers before handing them to the epoch as one node, so consumers take the
+ * epoch's limbo lock once per batch rather than once per pop.
+ **********************************************************************************************************************/
+#define CONCURRENT_QUEUE_RETIRE_BATCH 64
+
+/*
+========================================================================================================================
+- - TYPEDEFS - -
+========================================================================================================================
+*/
+
+typedef struct concurrent_queue_cell_59 concurrent_queue_cell_59;
+typedef struct concurrent_queue_59 concurrent_queue_59;
+
+/*
+========================================================================================================================
+- - STRUCTS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @concurrent_queue_cell_59
+ * @brief: Link of a concurrent queue carrying one pushed node. The cell at the head is a sentinel whose node has
+ * already been popped.
+ *
+ * @next: Next cell towards the tail.
+ * @node: Linked list node handed to @push_concurrent_queue_59.
+ * @retired: Next popped cell waiting in the same retire batch, only touched by the thread that popped the cell.
+ * @retire: Epoch node used to defer freeing the cell until no thread can still be reading it.
+ **********************************************************************************************************************/
+struct concurrent_queue_cell_59
+{
+    _Atomic(concurrent_queue_cell_59*) next;
+    llist_node_59* node;
+    concurrent_queue_cell_59* retired;
+    epoch_node_59 retire;
+};
+
+/***********************************************************************************************************************
+ * @concurrent_queue_59
+ * @brief: An unbounded lock-free FIFO queue (Michael-Scott), any number of threads may push and pop at once. Popped
+ * cells are freed through the epoch module so a thread still reading one is never left with a dangling pointer.
+ * Each thread batches the cells it pops, a thread's last partial batch is retired when it exits.
+ *
+ * @head: Sentinel cell, the next cell holds the front of the queue.
+ * @tail: Last or second to last cell, a lagging tail is swung forward by whichever thread notices it.
+ * @size: Number of nodes in the queue.
+ **********************************************************************************************************************/
+struct concurrent_queue_59
+{
+    _Alignas(CONCURRENT_QUEUE_CACHE_LINE) _Atomic(concurrent_queue_cell_59*) head;
+    _Alignas(CONCURRENT_QUEUE_CACHE_LINE) _Atomic(concurrent_queue_cell_59*) tail;
+    _Alignas(CONCURRENT_QUEUE_CACHE_LINE) atomic_size_t size;
+};
+
+/*
+========================================================================================================================
+- - MODULE FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Initializes an empty concurrent queue.
+ *
+ * @param[out] queue: Pointer to a @concurrent_queue_59 pointer to initialize the queue in.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @warning This will need to be freed with @deinit_concurrent_queue_59 when its lifetime has expired.
+ **********************************************************************************************************************/
+ERR_59_e init_concurrent_queue_59(concurrent_queue_59** queue);
+
+/***********************************************************************************************************************
+ * @brief: Deallocates the passed queue, nodes still queued are freed with deinit_llist_node_59(). The calling thread's
+ * batch of popped cells is retired as well.
+ *
+ * @param[out] queue: Pointer to a concurrent_queue_59 pointer that will be freed.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note The pointer to the queue will be (void*)0 on return.
+ *
+ * @warning No other thread may be using the queue, this is the only function that is not thread safe.
+ **********************************************************************************************************************/
+ERR_59_e deinit_concurrent_queue_59(concurrent_queue_59** queue);
+
+/***********************************************************************************************************************
+ * @brief: Appends a node to the back of the queue, the queue owns the node until it is popped.
+ *
+ * @param[in] queue: Queue to push onto.
+ * @param[in] node: Node to push, made with init_llist_node_59() or popped from an @llist_59.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note The node's next pointer is cleared, the queue links nodes through its own cells.
+ **********************************************************************************************************************/
+ERR_59_e push_concurrent_queue_59(concurrent_queue_59* const queue, llist_node_59* const node);
+
+/***********************************************************************************************************************
+ * @brief: Removes the node at the front of the queue.
+ *
+ * @param[in] queue: Queue to pop from.
+ * @param[out] node: Popped node, owned by the caller again.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note ERR_CONTAINER_EMPTY is returned when the queue held no nodes at the time of the call.
+ **********************************************************************************************************************/
+ERR_59_e pop_concurrent_queue_59(concurrent_queue_59* const queue, llist_node_59** const node);
+
+/***********************************************************************************************************************
+ * @brief: Reads the number of nodes in the queue.
+ *
+ * @param[in] queue: Queue to read.
+ * @param[out] size: Number of nodes at the time of the call.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note A push counts itself before it links its node, so under contention the size may briefly run ahead of what a
+ * pop can see.
+ **********************************************************************************************************************/
+ERR_59_e size_concurrent_queue_59(concurrent_queue_59* const queue, size_t* const size);
@@ -0,0 +1,338 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: This file contains the definitions for a lock-free multi-producer multi-consumer queue of linked list nodes.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdlib.h>
+#include <threads.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "concurrent_queue.h"
+
+/*
+========================================================================================================================
+- - INTERNAL STATE - -
+========================================================================================================================
+*/
+
+static once_flag concurrent_queue_once = ONCE_FLAG_INIT;
+static bool concurrent_queue_init_ok = false;
+static tss_t concurrent_queue_batch_key;
+
+static _Thread_local concurrent_queue_cell_59* concurrent_queue_batch = (void*)0;
+static _Thread_local size_t concurrent_queue_batch_count = 0;
+
+/*
+========================================================================================================================
+- - INTERNAL FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Epoch reclaim callback freeing a retired batch of cells.
+ *
+ * @param[in] retire: Retire member of the first cell of the batch.
+ **********************************************************************************************************************/
+static void _reclaim_batch_concurrent_queue_59(epoch_node_59* retire)
+{
+    concurrent_queue_cell_59* cell =
+        (concurrent_queue_cell_59*)(void*)((u8*)retire - offsetof(concurrent_queue_cell_59, retire));
+    while (cell)
+    {
+        concurrent_queue_cell_59* next = cell->retired;
+        free(cell);
+        cell = next;
+    }
+}
+
+/***********************************************************************************************************************
+ * @brief: Retires a thread's partial batch when the thread exits, registered as the thread specific storage destructor.
+ *
+ * @param[in] batch: First cell of the batch.
+ **********************************************************************************************************************/
+static void _release_batch_concurrent_queue_59(void* batch)
+{
+    retire_epoch_59(&((concurrent_queue_cell_59*)batch)->retire, _reclaim_batch_concurrent_queue_59);
+}
+
+/***********************************************************************************************************************
+ * @brief: One time creation of the key whose destructor retires a thread's last batch.
+ **********************************************************************************************************************/
+static void _init_once_concurrent_queue_59(void)
+{
+    concurrent_queue_init_ok =
+        (thrd_success == tss_create(&concurrent_queue_batch_key, _release_batch_concurrent_queue_59));
+}
+
+/***********************************************************************************************************************
+ * @brief: Hands the calling thread's batch of popped cells to the epoch.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _retire_batch_concurrent_queue_59(void)
+{
+    concurrent_queue_cell_59* batch = concurrent_queue_batch;
+    if (!batch)
+        return ERR_NONE;
+
+    concurrent_queue_batch = (void*)0;
+    concurrent_queue_batch_count = 0;
+    tss_set(concurrent_queue_batch_key, (void*)0);
+
+    return retire_epoch_59(&batch->retire, _reclaim_batch_concurrent_queue_59);
+}
+
+/***********************************************************************************************************************
+ * @brief: Adds an unlinked cell to the calling thread's batch, retiring the batch once it is full.
+ *
+ * @param[in] cell: Cell no longer reachable from the queue.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note The first cell of a batch carries the epoch node, the others chain behind it so the thread specific value
+ * only changes when a batch is started.
+ **********************************************************************************************************************/
+static ERR_59_e _batch_cell_concurrent_queue_59(concurrent_queue_cell_59* const cell)
+{
+    if (!concurrent_queue_batch)
+    {
+        cell->retired = (void*)0;
+        if (thrd_success != tss_set(concurrent_queue_batch_key, cell))
+            return retire_epoch_59(&cell->retire, _reclaim_batch_concurrent_queue_59);
+        concurrent_queue_batch = cell;
+    }
+    else
+    {
+        cell->retired = concurrent_queue_batch->retired;
+        concurrent_queue_batch->retired = cell;
+    }
+
+    if (CONCURRENT_QUEUE_RETIRE_BATCH <= ++concurrent_queue_batch_count)
+        return _retire_batch_concurrent_queue_59();
+
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Allocates an unlinked cell carrying the passed node.
+ *
+ * @param[in] node: Node carried by the cell, (void*)0 for the sentinel.
+ * @param[out] cell: Allocated cell.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _alloc_cell_concurrent_queue_59(llist_node_59* const node, concurrent_queue_cell_59** const cell)
+{
+    concurrent_queue_cell_59* new_cell = malloc(sizeof(concurrent_queue_cell_59));
+    if (!new_cell)
+        return ERR_NO_MEM;
+
+    atomic_init(&new_cell->next, (void*)0);
+    new_cell->node = node;
+    new_cell->retired = (void*)0;
+    new_cell->retire.next = (void*)0;
+    new_cell->retire.reclaim = (void*)0;
+    *cell = new_cell;
+
+    return ERR_NONE;
+}
+
+/*
+========================================================================================================================
+- - FUNCTION DEFINITIONS - -
+========================================================================================================================
+*/
+
+ERR_59_e init_concurrent_queue_59(concurrent_queue_59** queue)
+{
+    if (!queue)
+        return ERR_INV_PARAM;
+
+    call_once(&concurrent_queue_once, _init_once_concurrent_queue_59);
+    if (!concurrent_queue_init_ok)
+        return ERR_INTRNL;
+
+    concurrent_queue_59* new_queue = aligned_alloc(_Alignof(concurrent_queue_59), sizeof(concurrent_queue_59));
+    if (!new_queue)
+        return ERR_NO_MEM;
+
+    concurrent_queue_cell_59* sentinel = (void*)0;
+    ERR_59_e err = _alloc_cell_concurrent_queue_59((void*)0, &sentinel);
+    if (ERR_NONE != err)
+    {
+        free(new_queue);
+        return err;
+    }
+
+    atomic_init(&new_queue->head, sentinel);
+    atomic_init(&new_queue->tail, sentinel);
+    atomic_init(&new_queue->size, 0);
+    *queue = new_queue;
+
+    return ERR_NONE;
+}
+
+ERR_59_e deinit_concurrent_queue_59(concurrent_queue_59** queue)
+{
+    if (!queue || !(*queue))
+        return ERR_INV_PARAM;
+
+    // The sentinel's node was already popped, every cell after it still owns its node.
+    concurrent_queue_cell_59* cell = atomic_load_explicit(&(*queue)->head, memory_order_relaxed);
+    concurrent_queue_cell_59* next = atomic_load_explicit(&cell->next, memory_order_relaxed);
+    free(cell);
+    for (cell = next; cell; cell = next)
+    {
+        next = atomic_load_explicit(&cell->next, memory_order_relaxed);
+        deinit_llist_node_59(&cell->node);
+        free(cell);
+    }
+
+    free((*queue));
+    *queue = (void*)0;
+
+    // Reclaim cells retired by earlier pops, skipped when the caller is itself inside an epoch.
+    ERR_59_e err = _retire_batch_concurrent_queue_59();
+    flush_epoch_59();
+
+    return err;
+}
+
+ERR_59_e push_concurrent_queue_59(concurrent_queue_59* const queue, llist_node_59* const node)
+{
+    if (!queue || !node)
+        return ERR_INV_PARAM;
+
+    concurrent_queue_cell_59* cell = (void*)0;
+    ERR_59_e err = _alloc_cell_concurrent_queue_59(node, &cell);
+    if (ERR_NONE != err)
+        return err;
+
+    // The tail cell may be popped and retired while we read it, the epoch keeps it allocated until we leave.
+    err = enter_epoch_59();
+    if (ERR_NONE != err)
+    {
+        free(cell);
+        return err;
+    }
+
+    node->next = (void*)0;
+    atomic_fetch_add_explicit(&queue->size, 1, memory_order_relaxed);
+
+    concurrent_queue_cell_59* tail = (void*)0;
+    while (true)
+    {
+        tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        concurrent_queue_cell_59* next = atomic_load_explicit(&tail->next, memory_order_acquire);
+        if (tail != atomic_load_explicit(&queue->tail, memory_order_acquire))
+            continue;
+
+        if (next) // Tail is lagging behind another push, help it along before retrying.
+        {
+            atomic_compare_exchange_weak_explicit(&queue->tail, &tail, next, memory_order_release,
+                                                  memory_order_relaxed);
+            continue;
+        }
+
+        if (atomic_compare_exchange_weak_explicit(&tail->next, &next, cell, memory_order_release,
+                                                  memory_order_relaxed))
+            break;
+    }
+
+    // Failing is fine, another thread has already swung the tail past our cell.
+    atomic_compare_exchange_strong_explicit(&queue->tail, &tail, cell, memory_order_release, memory_order_relaxed);
+
+    return exit_epoch_59();
+}
+
+ERR_59_e pop_concurrent_queue_59(concurrent_queue_59* const queue, llist_node_59** const node)
+{
+    if (!queue || !node)
+        return ERR_INV_PARAM;
+
+    ERR_59_e err = enter_epoch_59();
+    if (ERR_NONE != err)
+        return err;
+
+    concurrent_queue_cell_59* head = (void*)0;
+    llist_node_59* popped = (void*)0;
+    while (true)
+    {
+        head = atomic_load_explicit(&queue->head, memory_order_acquire);
+        concurrent_queue_cell_59* tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        concurrent_queue_cell_59* next = atomic_load_explicit(&head->next, memory_order_acquire);
+        if (head != atomic_load_explicit(&queue->head, memory_order_acquire))
+            continue;
+
+        if (!next)
+        {
+            exit_epoch_59();
+            return ERR_CONTAINER_EMPTY;
+        }
+
+        if (head == tail) // Never let the head pass the tail, finish the lagging push first.
+        {
+            atomic_compare_exchange_weak_explicit(&queue->tail, &tail, next, memory_order_release,
+                                                  memory_order_relaxed);
+            continue;
+        }
+
+        // Read before the swap, once next becomes the sentinel another pop may retire it.
+        popped = next->node;
+        if (atomic_compare_exchange_weak_explicit(&queue->head, &head, next, memory_order_acq_rel,
+                                                  memory_order_relaxed))
+            break;
+    }
+
+    exit_epoch_59();
+    atomic_fetch_sub_explicit(&queue->size, 1, memory_order_relaxed);
+    *node = popped;
+
+    // The old sentinel is unlinked, threads that loaded it before the swap keep it alive through their epoch.
+    return _batch_cell_concurrent_queue_59(head);
+}
+
+ERR_59_e size_concurrent_queue_59(concurrent_queue_59* const queue, size_t* const size)
+{
+    if (!queue || !size)
+        return ERR_INV_PARAM;
+
+    *size = atomic_load_explicit(&queue->size, memory_order_relaxed);
+
+    return ERR_NONE;
+}
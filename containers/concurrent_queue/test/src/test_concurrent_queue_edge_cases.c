@@ -0,0 +1,164 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: This file contains the edge case tests for the lock-free concurrent queue.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "concurrent_queue.h"
+
+/*
+========================================================================================================================
+- - UNIT TESTS - -
+========================================================================================================================
+*/
+
+ERR_59_e test_concurrent_queue_59_edge_cases(void)
+{
+    ERR_59_e err = ERR_NONE;
+
+    // Init concurrent_queue
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Initializing concurrent_queues...");
+
+    concurrent_queue_59* queue = (void*)0;
+    err = init_concurrent_queue_59(&queue);
+    if (ERR_NONE != err)
+        return err;
+
+    concurrent_queue_59* queue_dummy = (void*)0;
+    llist_node_59* node = (void*)0;
+    size_t size = 0;
+
+    // Test init_concurrent_queue edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test init_concurrent_queue...");
+
+    err = init_concurrent_queue_59((void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = init_concurrent_queue() with void ptr\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    // Test deinit_concurrent_queue edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test deinit_concurrent_queue...");
+
+    err = deinit_concurrent_queue_59((void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = deinit_concurrent_queue() with void ptr\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = deinit_concurrent_queue_59(&queue_dummy);
+    printf("Assert: ERR_INV_PARAM == %d = deinit_concurrent_queue() with void queue\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    // Test push and pop edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test push/pop_concurrent_queue...");
+
+    err = push_concurrent_queue_59(queue, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = push_concurrent_queue() with void node\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = pop_concurrent_queue_59(queue_dummy, &node);
+    printf("Assert: ERR_INV_PARAM == %d = pop_concurrent_queue() with void queue\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = pop_concurrent_queue_59(queue, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = pop_concurrent_queue() with void out\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = pop_concurrent_queue_59(queue, &node);
+    printf("Assert: ERR_CONTAINER_EMPTY == %d = pop_concurrent_queue() on empty queue\n", err);
+    assert(ERR_CONTAINER_EMPTY == err && !node);
+
+    err = init_llist_node_59(&node, (void*)0, (void*)0);
+    if (ERR_NONE != err)
+        return err;
+    err = push_concurrent_queue_59(queue, node);
+    assert(ERR_NONE == err);
+    node = (void*)0;
+    err = pop_concurrent_queue_59(queue, &node);
+    assert(ERR_NONE == err && node);
+    err = pop_concurrent_queue_59(queue, &node);
+    printf("Assert: ERR_CONTAINER_EMPTY == %d = pop_concurrent_queue() once drained again\n", err);
+    assert(ERR_CONTAINER_EMPTY == err);
+    deinit_llist_node_59(&node);
+
+    // Test size edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test size_concurrent_queue...");
+
+    err = size_concurrent_queue_59(queue, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = size_concurrent_queue() with void out\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = size_concurrent_queue_59(queue, &size);
+    printf("Assert: 0 == %lu = size_concurrent_queue() on empty queue\n", size);
+    assert(ERR_NONE == err && 0 == size);
+
+    // Test clean up
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test clean up...");
+    err = deinit_concurrent_queue_59(&queue);
+
+    return err;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    puts("- - -  START OF CONCURRENT QUEUE TEST  - - -");
+    puts("- - - CONCURRENT QUEUE EDGE CASES - - -");
+
+    ERR_59_e err = test_concurrent_queue_59_edge_cases();
+    printf("ERROR CODE: %d\n", err);
+    assert(ERR_NONE == err);
+
+    puts("- - - - END OF CONCURRENT QUEUE TEST - - - -");
+    return err;
+}
@@ -0,0 +1,265 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: This file contains the interface tests for the lock-free concurrent queue.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <threads.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "concurrent_queue.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+#define TEST_NODES 1000
+#define TEST_PRODUCERS 4
+#define TEST_CONSUMERS 4
+#define TEST_NODES_PER_PRODUCER 5000
+
+/*
+========================================================================================================================
+- - INTERNAL TEST HELPERS - -
+========================================================================================================================
+*/
+
+static concurrent_queue_59* shared_queue = (void*)0;
+static atomic_size_t popped_count = 0;
+static atomic_size_t bad_pops = 0;
+static atomic_uchar seen[TEST_PRODUCERS * TEST_NODES_PER_PRODUCER];
+
+static ERR_59_e _make_node(u64 const val, llist_node_59** node)
+{
+    u64* obj = malloc(sizeof(u64));
+    if (!obj)
+        return ERR_NO_MEM;
+    *obj = val;
+
+    ERR_59_e err = init_llist_node_59(node, (void*)0, obj);
+    if (ERR_NONE != err)
+        free(obj);
+
+    return err;
+}
+
+static int _producer_thread(void* arg)
+{
+    u64 const producer = (u64)(size_t)arg;
+    for (u64 i = 0; i < TEST_NODES_PER_PRODUCER; i++)
+    {
+        llist_node_59* node = (void*)0;
+        if (ERR_NONE != _make_node(producer * TEST_NODES_PER_PRODUCER + i, &node))
+            return 1;
+        if (ERR_NONE != push_concurrent_queue_59(shared_queue, node))
+            return 1;
+    }
+
+    return 0;
+}
+
+static int _consumer_thread(void* arg)
+{
+    (void)arg;
+    u64 last[TEST_PRODUCERS];
+    for (size_t i = 0; i < TEST_PRODUCERS; i++)
+        last[i] = UINT64_MAX;
+
+    while (atomic_load(&popped_count) < TEST_PRODUCERS * TEST_NODES_PER_PRODUCER)
+    {
+        llist_node_59* node = (void*)0;
+        ERR_59_e err = pop_concurrent_queue_59(shared_queue, &node);
+        if (ERR_CONTAINER_EMPTY == err)
+        {
+            thrd_yield();
+            continue;
+        }
+        if (ERR_NONE != err)
+        {
+            atomic_fetch_add(&bad_pops, 1);
+            return 1;
+        }
+
+        // Nodes of one producer must come out in the order it pushed them, and every node exactly once.
+        u64 const val = *(u64*)node->node_obj;
+        u64 const producer = val / TEST_NODES_PER_PRODUCER;
+        if (UINT64_MAX != last[producer] && last[producer] >= val)
+            atomic_fetch_add(&bad_pops, 1);
+        if (0 != atomic_fetch_add(&seen[val], 1))
+            atomic_fetch_add(&bad_pops, 1);
+        last[producer] = val;
+
+        deinit_llist_node_59(&node);
+        atomic_fetch_add(&popped_count, 1);
+    }
+
+    return 0;
+}
+
+/*
+========================================================================================================================
+- - UNIT TESTS - -
+========================================================================================================================
+*/
+
+ERR_59_e test_concurrent_queue_59_interface(void)
+{
+    ERR_59_e err = ERR_NONE;
+
+    // Init concurrent_queue
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Initializing concurrent_queues...");
+
+    concurrent_queue_59* queue = (void*)0;
+    err = init_concurrent_queue_59(&queue);
+    if (ERR_NONE != err)
+        return err;
+
+    err = init_concurrent_queue_59(&shared_queue);
+    if (ERR_NONE != err)
+        return err;
+
+    // Test push and pop
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test push/pop_concurrent_queue...");
+
+    size_t size = 0;
+    for (u64 i = 0; i < TEST_NODES; i++)
+    {
+        llist_node_59* node = (void*)0;
+        err = _make_node(i, &node);
+        if (ERR_NONE != err)
+            return err;
+        err = push_concurrent_queue_59(queue, node);
+        assert(ERR_NONE == err);
+    }
+    err = size_concurrent_queue_59(queue, &size);
+    printf("Assert: %d == %lu = size_concurrent_queue() after pushes\n", TEST_NODES, size);
+    assert(ERR_NONE == err && TEST_NODES == size);
+
+    for (u64 i = 0; i < TEST_NODES / 2; i++)
+    {
+        llist_node_59* node = (void*)0;
+        err = pop_concurrent_queue_59(queue, &node);
+        assert(ERR_NONE == err && !node->next);
+        assert(i == *(u64*)node->node_obj);
+        deinit_llist_node_59(&node);
+    }
+    puts("Assert: nodes popped in the order they were pushed");
+
+    err = size_concurrent_queue_59(queue, &size);
+    printf("Assert: %d == %lu = size_concurrent_queue() after pops\n", TEST_NODES / 2, size);
+    assert(ERR_NONE == err && TEST_NODES / 2 == size);
+
+    // Test concurrent producers and consumers
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test concurrent producers and consumers...");
+
+    thrd_t producers[TEST_PRODUCERS];
+    thrd_t consumers[TEST_CONSUMERS];
+    for (size_t i = 0; i < TEST_CONSUMERS; i++)
+    {
+        if (thrd_success != thrd_create(&consumers[i], _consumer_thread, (void*)0))
+            return ERR_INTRNL;
+    }
+    for (size_t i = 0; i < TEST_PRODUCERS; i++)
+    {
+        if (thrd_success != thrd_create(&producers[i], _producer_thread, (void*)i))
+            return ERR_INTRNL;
+    }
+
+    for (size_t i = 0; i < TEST_PRODUCERS; i++)
+    {
+        int res = 0;
+        thrd_join(producers[i], &res);
+        assert(0 == res);
+    }
+    for (size_t i = 0; i < TEST_CONSUMERS; i++)
+    {
+        int res = 0;
+        thrd_join(consumers[i], &res);
+        assert(0 == res);
+    }
+
+    printf("Assert: 0 == %lu = out of order or duplicate pops\n", atomic_load(&bad_pops));
+    assert(0 == atomic_load(&bad_pops));
+    printf("Assert: %d == %lu = nodes popped\n", TEST_PRODUCERS * TEST_NODES_PER_PRODUCER, atomic_load(&popped_count));
+    assert(TEST_PRODUCERS * TEST_NODES_PER_PRODUCER == atomic_load(&popped_count));
+
+    err = size_concurrent_queue_59(shared_queue, &size);
+    printf("Assert: 0 == %lu = size_concurrent_queue() once drained\n", size);
+    assert(ERR_NONE == err && 0 == size);
+
+    // Test clean up, the nodes left in queue are freed by deinit
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test clean up...");
+    err = deinit_concurrent_queue_59(&queue);
+    assert(ERR_NONE == err && !queue);
+    err = deinit_concurrent_queue_59(&shared_queue);
+    assert(ERR_NONE == err);
+
+    return err;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    puts("- - -  START OF CONCURRENT QUEUE TEST  - - -");
+    puts("- - - INTERFACE TESTS - - -");
+
+    ERR_59_e err = test_concurrent_queue_59_interface();
+    printf("ERROR CODE: %d\n", err);
+    assert(ERR_NONE == err);
+
+    puts("- - - - END OF CONCURRENT QUEUE TEST - - - -");
+    return err;
+}
@@ -84,15 +84,21 @@ struct dlist_node_59
  *
  * @head: start of the linked list.
  * @tail: end of the linked list inplemented as a pointer to a pointer. Begins as address of @head.
+ * @size: number of nodes in the list.
  * @type: type of the linked list's nodes, this can be any type so besure you document what you're pointing at.
  * @type_depth: if pointing at arrays with consistent size, place the size of the arrays here, otherwise leave as 0.
+ * @intrusive: whether the nodes are embedded in the objects they link, see @init_intrusive_dlist_59.
+ * @link_offset: offset of the node within each object of an intrusive list, 0 otherwise.
  **********************************************************************************************************************/
 struct dlist_59
 {
     dlist_node_59* head;
     dlist_node_59** tail;
+    size_t size;
     TYPE_59_e type;
     size_t type_depth;
+    bool intrusive;
+    size_t link_offset;
 };
 
 /*
@@ -115,7 +121,26 @@ struct dlist_59
 ERR_59_e init_dlist_59(dlist_59** dlist, TYPE_59_e const type, size_t const type_depth);
 
 /***********************************************************************************************************************
- * @brief: Deinits the passed doubly linked list and all of the nodes, this also deallocates the used memory.
+ * @brief: Initializes an intrusive doubly linked list, whose nodes are embedded in the objects they link rather than
+ * allocated with init_dlist_node_59(). Linking an object then needs no allocation, and the object is reached from its
+ * node with CONTAINER_OF_59() rather than through @node_obj, which intrusive lists leave unused.
+ *
+ * @param[out] dlist: doubly linked list pointer to initialize. @warning This must be freed when its lifetime has ended.
+ * @param[in] type: type of the objects holding the nodes.
+ * @param[in] type_depth: size of the objects, all must be the same size, if not set as 0.
+ * @param[in] link_offset: offset of the embedded node within each object, ie offsetof(my_struct, link).
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Every other list function works on intrusive lists unchanged. The list never allocates or frees the objects,
+ * deinit_dlist_59() only frees the list itself.
+ **********************************************************************************************************************/
+ERR_59_e
+init_intrusive_dlist_59(dlist_59** dlist, TYPE_59_e const type, size_t const type_depth, size_t const link_offset);
+
+/***********************************************************************************************************************
+ * @brief: Deinits the passed doubly linked list and all of the nodes, this also deallocates the used memory. The nodes
+ * and objects of intrusive lists belong to the caller and are left alone.
  *
  * @param[in] dlist: doubly linked list to deinit.
  *
@@ -173,9 +198,27 @@ ERR_59_e pop_front_dlist_59(dlist_59* const dlist, dlist_node_59** front_node);
  * @param[out] remove_node: Node to remove, error is returned if not found.
  *
  * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note The list is searched for the node first, use @unlink_node_from_dlist_59 when the node is known to be in it.
  **********************************************************************************************************************/
 ERR_59_e remove_given_node_from_dlist_59(dlist_59* const dlist, dlist_node_59* remove_node);
 
+/***********************************************************************************************************************
+ * @brief: Unlinks the passed node in O(1) through its own links, without searching the list for it the way
+ * @remove_given_node_from_dlist_59 does. @warning DOES NOT DEALLOCATE the node.
+ *
+ * @param[in] dlist: Doubly linked list holding the node.
+ * @param[in] node: Node to unlink, its links are cleared.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note ERR_OBJ_NOT_FOUND is returned for a node that is already unlinked. Debug builds (DEBUG_59 defined) also walk
+ * the list to confirm the node is in it.
+ * @warning Outside of debug builds the node is trusted to belong to @dlist, unlinking a node of another list corrupts
+ * both lists.
+ **********************************************************************************************************************/
+ERR_59_e unlink_node_from_dlist_59(dlist_59* const dlist, dlist_node_59* const node);
+
 /***********************************************************************************************************************
  * @brief: Inserts a node into the doubly linked list at the passed index, if the index is passed the end of the list it
  * appends the node to the end of the list.
@@ -193,7 +236,8 @@ ERR_59_e insert_node_into_dlist_59(dlist_59* const dlist, dlist_node_59* const n
  *
  * @param[in] dlist Double linked list to find the node in.
  * @param[in] node Node to find in the list.
- * @param[out] val value of the found node, null if node is not in list.
+ * @param[out] val value of the found node, null if node is not in list. For intrusive lists the value is the object
+ * holding the node.
  *
  * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
  **********************************************************************************************************************/
@@ -210,6 +254,72 @@ ERR_59_e find_node_in_dlist_59(dlist_59 const* const dlist, dlist_node_59 const*
  **********************************************************************************************************************/
 ERR_59_e get_at_idx_dlist_59(dlist_59 const* const dlist, size_t const idx, dlist_node_59** node);
 
+/***********************************************************************************************************************
+ * @brief: Moves every node of @src onto the end of @dest in O(1), @src is left empty.
+ *
+ * @param[in] dest: List to append to.
+ * @param[in] src: List whose nodes are moved.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Both lists must have the same type and both be intrusive with the same link offset or both not, otherwise
+ * ERR_INV_PARAM is returned.
+ **********************************************************************************************************************/
+ERR_59_e concat_dlist_59(dlist_59* const dest, dlist_59* const src);
+
+/***********************************************************************************************************************
+ * @brief: Splits the doubly linked list before the node at @idx, that node and every node after it are moved onto
+ * the end of @dest. Finding the node walks @idx nodes, the move itself is O(1).
+ *
+ * @param[in] dlist: List to split.
+ * @param[in] idx: Index of the first node to move.
+ * @param[in] dest: List to append the moved nodes to, the same requirements as @concat_dlist_59 apply.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note ERR_INV_PARAM is returned if @idx is out of range, neither list is changed.
+ **********************************************************************************************************************/
+ERR_59_e split_at_dlist_59(dlist_59* const dlist, size_t const idx, dlist_59* const dest);
+
+/***********************************************************************************************************************
+ * @brief: Moves the run of nodes from @first to @last out of @src and links it into @dest before @before, in O(1).
+ *
+ * @param[in] dest: List to move the run into, may be @src.
+ * @param[in] before: Node of @dest the run is placed in front of, (void*)0 appends the run to @dest.
+ * @param[in] src: List holding the run.
+ * @param[in] first: First node of the run.
+ * @param[in] last: Last node of the run, may be @first.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note The same requirements as @concat_dlist_59 apply to the two lists. Moving a run between two lists counts its
+ * nodes to keep both sizes right, within one list nothing is walked.
+ * @warning The run is trusted rather than searched for, @first must come no later than @last in @src and @before must
+ * not be inside the run.
+ **********************************************************************************************************************/
+ERR_59_e splice_dlist_59(dlist_59* const dest,
+                         dlist_node_59* const before,
+                         dlist_59* const src,
+                         dlist_node_59* const first,
+                         dlist_node_59* const last);
+
+/***********************************************************************************************************************
+ * @brief: Sorts the doubly linked list in place with a stable bottom-up merge sort, O(n log n) compares and no
+ * allocation. Nodes are relinked rather than their objects swapped, so pointers to nodes stay valid.
+ *
+ * @param[in] dlist: The doubly linked list to sort.
+ * @param[in] compare: Comparison returning the same sign convention as compare_node_obj_59(), or (void*)0 to
+ * compare with compare_node_obj_59() and the list's type. For intrusive lists the objects holding the nodes are
+ * compared.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note If a comparison fails the sort finishes without comparing further, the list keeps every node but in an
+ * unspecified order, and the comparison's error is returned.
+ **********************************************************************************************************************/
+ERR_59_e sort_dlist_59(dlist_59* const dlist,
+                       ERR_59_e (*compare)(void const* const obj_A, void const* const obj_B, i64* const diff_out));
+
 /***********************************************************************************************************************
  * @brief: Initializes a node for a @dlist_59, @next, @last and @node_obj can be NULL.
  *
@@ -45,6 +45,134 @@
 
 #include "dlist.h"
 
+/*
+========================================================================================================================
+- - INTERNAL FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Compares the objects of two nodes for @sort_dlist_59.
+ *
+ * @param[in] dlist: List the nodes belong to.
+ * @param[in] compare: Caller's comparison, (void*)0 to use compare_node_obj_59() with the list's type.
+ * @param[in] node_A: Node whose object is compared.
+ * @param[in] node_B: Other node whose object is compared.
+ * @param[out] diff_out: Sign of the comparison.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e
+_compare_nodes_dlist_59(dlist_59 const* const dlist,
+                        ERR_59_e (*compare)(void const* const obj_A, void const* const obj_B, i64* const diff_out),
+                        dlist_node_59 const* const node_A,
+                        dlist_node_59 const* const node_B,
+                        i64* const diff_out)
+{
+    void const* obj_A = node_A->node_obj;
+    void const* obj_B = node_B->node_obj;
+    if (dlist->intrusive)
+    {
+        obj_A = (char const*)node_A - dlist->link_offset;
+        obj_B = (char const*)node_B - dlist->link_offset;
+    }
+
+    if (compare)
+        return compare(obj_A, obj_B, diff_out);
+    return compare_node_obj_59(dlist->type, obj_A, obj_B, diff_out);
+}
+
+/***********************************************************************************************************************
+ * @brief: Checks two lists may exchange nodes, they must hold the same type and agree on who owns the nodes.
+ *
+ * @param[in] A: List to check.
+ * @param[in] B: Other list to check.
+ *
+ * @retval bool: true if nodes can move between the lists.
+ **********************************************************************************************************************/
+static bool _compatible_dlist_59(dlist_59 const* const A, dlist_59 const* const B)
+{
+    return A->type == B->type && A->type_depth == B->type_depth && A->intrusive == B->intrusive &&
+           A->link_offset == B->link_offset;
+}
+
+/***********************************************************************************************************************
+ * @brief: Moves a run of nodes within or between lists, see @splice_dlist_59.
+ *
+ * @param[in] dest: List to move the run into, may be @src.
+ * @param[in] before: Node of @dest the run is placed in front of, (void*)0 appends the run.
+ * @param[in] src: List holding the run.
+ * @param[in] first: First node of the run.
+ * @param[in] last: Last node of the run.
+ * @param[in] count: Number of nodes in the run, ignored when @dest is @src.
+ **********************************************************************************************************************/
+static void _splice_dlist_59(dlist_59* const dest,
+                             dlist_node_59* const before,
+                             dlist_59* const src,
+                             dlist_node_59* const first,
+                             dlist_node_59* const last,
+                             size_t const count)
+{
+    // Unlink the run from src.
+    if (first->last)
+        first->last->next = last->next;
+    else
+        src->head = last->next;
+
+    if (last->next)
+        last->next->last = first->last;
+    else // The run held the tail.
+        src->tail = first->last ? &(first->last->next) : &(src->head);
+
+    // Link it into dest, before is never in the run so dest's links are still intact when dest is src.
+    if (before)
+    {
+        first->last = before->last;
+        last->next = before;
+        if (before->last)
+            before->last->next = first;
+        else
+            dest->head = first;
+        before->last = last;
+    }
+    else
+    {
+        first->last = (dest->tail == &dest->head) ? (void*)0 : CONTAINER_OF_59(dest->tail, dlist_node_59, next);
+        last->next = (void*)0;
+        *(dest->tail) = first;
+        dest->tail = &(last->next);
+    }
+
+    if (dest != src)
+    {
+        src->size -= count;
+        dest->size += count;
+    }
+}
+
+/***********************************************************************************************************************
+ * @brief: Unlinks a node known to be in the list through its own links, O(1).
+ *
+ * @param[in] dlist: List holding the node.
+ * @param[in] node: Node to unlink, its links are cleared.
+ **********************************************************************************************************************/
+static void _unlink_dlist_59(dlist_59* const dlist, dlist_node_59* const node)
+{
+    if (node->last)
+        node->last->next = node->next;
+    else
+        dlist->head = node->next;
+
+    if (node->next)
+        node->next->last = node->last;
+    else // Removed node was the true tail, so tail needs to be moved.
+        dlist->tail = node->last ? &node->last->next : &dlist->head;
+
+    node->next = (void*)0;
+    node->last = (void*)0;
+    dlist->size--;
+}
+
 /*
 ========================================================================================================================
 - - FUNCTION DEFINITIONS - -
@@ -65,6 +193,22 @@ ERR_59_e init_dlist_59(dlist_59** dlist, TYPE_59_e const type, size_t const type
     (*dlist)->type_depth = type_depth;
     (*dlist)->head = (void*)0;
     (*dlist)->tail = &(*dlist)->head;
+    (*dlist)->size = 0;
+    (*dlist)->intrusive = false;
+    (*dlist)->link_offset = 0;
+
+    return ERR_NONE;
+}
+
+ERR_59_e
+init_intrusive_dlist_59(dlist_59** dlist, TYPE_59_e const type, size_t const type_depth, size_t const link_offset)
+{
+    ERR_59_e err = init_dlist_59(dlist, type, type_depth);
+    if (ERR_NONE != err)
+        return err;
+
+    (*dlist)->intrusive = true;
+    (*dlist)->link_offset = link_offset;
 
     return ERR_NONE;
 }
@@ -74,7 +218,7 @@ ERR_59_e deinit_dlist_59(dlist_59** dlist)
     if (!dlist || !(*dlist))
         return ERR_INV_PARAM;
 
-    dlist_node_59* node = (*dlist)->head;
+    dlist_node_59* node = (*dlist)->intrusive ? (void*)0 : (*dlist)->head; // Intrusive nodes belong to the caller.
     dlist_node_59* next_node = (void*)0;
     while (node)
     {
@@ -89,6 +233,7 @@ ERR_59_e deinit_dlist_59(dlist_59** dlist)
 
     (*dlist)->head = (void*)0;
     (*dlist)->tail = (void*)0;
+    (*dlist)->size = 0;
     (*dlist)->type = VOID_0;
     (*dlist)->type_depth = 0;
     free((*dlist));
@@ -102,18 +247,12 @@ ERR_59_e push_back_dlist_59(dlist_59* const dlist, dlist_node_59* const new_node
     if (!dlist || !new_node)
         return ERR_INV_PARAM;
 
-    dlist_node_59* current_node = dlist->head;
-    while (current_node)
-    {
-        if (current_node->next)
-            current_node = current_node->next;
-        else
-            break;
-    }
-
-    new_node->last = current_node;
+    // Tail points at the next member of the last node, unless the list is empty and it points at head.
+    new_node->last = (dlist->tail == &dlist->head) ? (void*)0 : CONTAINER_OF_59(dlist->tail, dlist_node_59, next);
+    new_node->next = (void*)0;
     *(dlist->tail) = new_node;
     dlist->tail = &(*dlist->tail)->next;
+    dlist->size++;
 
     return ERR_NONE;
 }
@@ -125,26 +264,8 @@ ERR_59_e pop_back_dlist_59(dlist_59* const dlist, dlist_node_59** back_node)
     if (!dlist->head)
         return ERR_CONTAINER_EMPTY;
 
-    dlist_node_59* tail = dlist->head;
-    dlist_node_59* scnd_to_tail = (void*)0;
-    while (tail->next)
-    {
-        scnd_to_tail = tail;
-        tail = tail->next;
-    }
-
-    *back_node = tail;
-    if (scnd_to_tail)
-    {
-        scnd_to_tail->next = (void*)0;
-        (*back_node)->last = (void*)0;
-        dlist->tail = &(scnd_to_tail->next);
-    }
-    else
-    { // Only one node in dlist ie the head
-        dlist->head = (void*)0;
-        dlist->tail = &dlist->head;
-    }
+    *back_node = CONTAINER_OF_59(dlist->tail, dlist_node_59, next);
+    _unlink_dlist_59(dlist, *back_node);
 
     return ERR_NONE;
 }
@@ -154,17 +275,14 @@ ERR_59_e push_front_dlist_59(dlist_59* const dlist, dlist_node_59* const new_fro
     if (!dlist || !new_front)
         return ERR_INV_PARAM;
 
-    if (!dlist->head)
-    {
-        *dlist->tail = new_front;
-        dlist->head = new_front;
-    }
-    else
-    {
-        new_front->next = dlist->head;
+    new_front->last = (void*)0;
+    new_front->next = dlist->head;
+    if (dlist->head)
         dlist->head->last = new_front;
-        dlist->head = new_front;
-    }
+    else // List was empty, so tail needs to be moved off head.
+        dlist->tail = &new_front->next;
+    dlist->head = new_front;
+    dlist->size++;
 
     return ERR_NONE;
 }
@@ -178,13 +296,12 @@ ERR_59_e pop_front_dlist_59(dlist_59* const dlist, dlist_node_59** front_node)
 
     *front_node = dlist->head;
 
-    if (dlist->head->next)
-    {
-        dlist->head->next->last = (void*)0;
-        dlist->head = dlist->head->next;
-    }
-    else
-        dlist->head = (void*)0;
+    dlist->head = dlist->head->next;
+    if (dlist->head)
+        dlist->head->last = (void*)0;
+    else // Popped the only node, tail needs to be reset.
+        dlist->tail = &dlist->head;
+    dlist->size--;
 
     (*front_node)->next = (void*)0;
 
@@ -200,56 +317,64 @@ ERR_59_e remove_given_node_from_dlist_59(dlist_59* const dlist, dlist_node_59* r
     if (!node)
         return ERR_CONTAINER_EMPTY;
 
-    dlist_node_59* last_node = (void*)0;
     while (node)
     {
         if (node == remove_node)
         {
-            if (last_node)
-            {
-                last_node->next = node->next;
-                node->next->last = last_node;
-            }
-            else
-                dlist->head = node->next;
-
-            remove_node = node;
-            remove_node->next = (void*)0;
+            _unlink_dlist_59(dlist, node);
             return ERR_NONE;
         }
-        last_node = node;
         node = node->next;
     }
 
     return ERR_OBJ_NOT_FOUND;
 }
 
+ERR_59_e unlink_node_from_dlist_59(dlist_59* const dlist, dlist_node_59* const node)
+{
+    if (!dlist || !node)
+        return ERR_INV_PARAM;
+    if (!dlist->head)
+        return ERR_CONTAINER_EMPTY;
+
+    // Only the head has no last and only the tail has no next, this catches nodes that were already unlinked.
+    if ((!node->last && dlist->head != node) || (!node->next && dlist->tail != &node->next))
+        return ERR_OBJ_NOT_FOUND;
+
+#ifdef DEBUG_59
+    dlist_node_59 const* current = dlist->head;
+    while (current && current != node)
+        current = current->next;
+    if (!current)
+        return ERR_OBJ_NOT_FOUND;
+#endif
+
+    _unlink_dlist_59(dlist, node);
+
+    return ERR_NONE;
+}
+
 ERR_59_e insert_node_into_dlist_59(dlist_59* const dlist, dlist_node_59* const new_node, size_t const idx)
 {
     if (!dlist || !new_node)
         return ERR_INV_PARAM;
 
-    if (!dlist->head)
-    {
-        dlist->head = new_node;
-        return ERR_NONE;
-    }
-
-    dlist_node_59* node = dlist->head;
+    dlist_node_59** link = &dlist->head;
     dlist_node_59* last_node = (void*)0;
-    for (size_t i = 0; i < idx; i++)
+    for (size_t i = 0; i < idx && *link; i++)
     {
-        if (!node)
-            break;
-
-        last_node = node;
-        node = node->next;
+        last_node = *link;
+        link = &last_node->next;
     }
-    last_node->next = new_node;
+
     new_node->last = last_node;
-    new_node->next = node;
-    if (node)
-        node->last = new_node;
+    new_node->next = *link;
+    *link = new_node;
+    if (new_node->next)
+        new_node->next->last = new_node;
+    else // Inserted at the end, so tail needs to be moved.
+        dlist->tail = &new_node->next;
+    dlist->size++;
 
     return ERR_NONE;
 }
@@ -268,7 +393,7 @@ ERR_59_e find_node_in_dlist_59(dlist_59 const* const dlist, dlist_node_59 const*
     {
         if (node == current)
         {
-            *val = current->node_obj;
+            *val = dlist->intrusive ? (void*)((char*)current - dlist->link_offset) : current->node_obj;
             return ERR_NONE;
         }
         current = current->next;
@@ -279,27 +404,147 @@ ERR_59_e find_node_in_dlist_59(dlist_59 const* const dlist, dlist_node_59 const*
 
 ERR_59_e get_at_idx_dlist_59(dlist_59 const* const dlist, size_t const idx, dlist_node_59** node)
 {
-    if (!dlist)
+    if (!dlist || !node)
     {
         return ERR_INV_PARAM;
     }
 
     *node = (void*)0;
     dlist_node_59* current = dlist->head;
-    for (size_t i = 0; i <= idx; i++)
+    for (size_t i = 0; i < idx && current; i++)
+        current = current->next;
+
+    if (!current)
+        return ERR_INV_PARAM;
+
+    *node = current;
+    return ERR_NONE;
+}
+
+ERR_59_e concat_dlist_59(dlist_59* const dest, dlist_59* const src)
+{
+    if (!dest || !src || dest == src || !_compatible_dlist_59(dest, src))
+        return ERR_INV_PARAM;
+    if (!src->head)
+        return ERR_NONE;
+
+    src->head->last = (dest->tail == &dest->head) ? (void*)0 : CONTAINER_OF_59(dest->tail, dlist_node_59, next);
+    *(dest->tail) = src->head;
+    dest->tail = src->tail;
+    dest->size += src->size;
+    src->head = (void*)0;
+    src->tail = &(src->head);
+    src->size = 0;
+
+    return ERR_NONE;
+}
+
+ERR_59_e split_at_dlist_59(dlist_59* const dlist, size_t const idx, dlist_59* const dest)
+{
+    if (!dlist || !dest || dlist == dest || !_compatible_dlist_59(dlist, dest))
+        return ERR_INV_PARAM;
+
+    dlist_node_59* first = dlist->head;
+    for (size_t i = 0; i < idx && first; i++)
+        first = first->next;
+    if (!first)
+        return ERR_INV_PARAM;
+
+    dlist_node_59* const last = CONTAINER_OF_59(dlist->tail, dlist_node_59, next);
+    _splice_dlist_59(dest, (void*)0, dlist, first, last, dlist->size - idx);
+
+    return ERR_NONE;
+}
+
+ERR_59_e splice_dlist_59(dlist_59* const dest,
+                         dlist_node_59* const before,
+                         dlist_59* const src,
+                         dlist_node_59* const first,
+                         dlist_node_59* const last)
+{
+    if (!dest || !src || !first || !last || (dest != src && !_compatible_dlist_59(dest, src)))
+        return ERR_INV_PARAM;
+
+    // Within one list the size does not change, between lists the run has to be counted.
+    size_t count = 0;
+    if (dest != src)
     {
-        if (current)
-        {
-            current = current->next;
-        }
-        else
+        for (dlist_node_59 const* node = first; node != last->next; node = node->next)
+            count++;
+    }
+    _splice_dlist_59(dest, before, src, first, last, count);
+
+    return ERR_NONE;
+}
+
+ERR_59_e sort_dlist_59(dlist_59* const dlist,
+                       ERR_59_e (*compare)(void const* const obj_A, void const* const obj_B, i64* const diff_out))
+{
+    if (!dlist)
+        return ERR_INV_PARAM;
+
+    // Each pass merges neighbouring sorted runs of width nodes, doubling the width until one run is left.
+    ERR_59_e err = ERR_NONE;
+    for (size_t width = 1;; width *= 2)
+    {
+        dlist_node_59* left = dlist->head;
+        dlist_node_59** tail = &(dlist->head);
+        dlist_node_59* last = (void*)0;
+        size_t merges = 0;
+
+        while (left)
         {
-            return ERR_INV_PARAM;
+            merges++;
+            dlist_node_59* right = left;
+            size_t left_size = 0;
+            while (left_size < width && right)
+            {
+                right = right->next;
+                left_size++;
+            }
+            size_t right_size = width;
+
+            while (left_size || (right_size && right))
+            {
+                bool take_left = !right_size || !right;
+                if (!take_left && left_size)
+                {
+                    // Ties go to the left run to keep the sort stable, after an error the runs are just joined.
+                    i64 diff = 0;
+                    if (ERR_NONE == err)
+                        err = _compare_nodes_dlist_59(dlist, compare, left, right, &diff);
+                    take_left = (ERR_NONE != err) || 0 >= diff;
+                }
+
+                dlist_node_59* next = (void*)0;
+                if (take_left)
+                {
+                    next = left;
+                    left = left->next;
+                    left_size--;
+                }
+                else
+                {
+                    next = right;
+                    right = right->next;
+                    right_size--;
+                }
+                *tail = next;
+                tail = &(next->next);
+                next->last = last;
+                last = next;
+            }
+
+            left = right;
         }
+
+        *tail = (void*)0;
+        dlist->tail = tail;
+        if (1 >= merges)
+            break;
     }
 
-    *node = current;
-    return ERR_NONE;
+    return err;
 }
 
 ERR_59_e init_dlist_node_59(dlist_node_59** node, dlist_node_59* const next, dlist_node_59* const last, void* node_obj)
@@ -80,6 +80,110 @@ ERR_59_e test_dlist_59_edge_cases(void)
     assert(ERR_INV_PARAM == err);
     err = ERR_NONE;
 
+    err = init_intrusive_dlist_59((void*)0, I64_PTR, 0, 0);
+    printf("Assert: err = %d == %d ERR_INV_PARAM\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+    err = ERR_NONE;
+
+    // sort list
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Testing sort_dlist()...");
+
+    err = sort_dlist_59((void*)0, (void*)0);
+    printf("Assert: err = %d == %d ERR_INV_PARAM\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+    err = ERR_NONE;
+
+    dlist_59* unsorted = (void*)0;
+    dlist_node_59 unsorted_nodes[3];
+    err = init_intrusive_dlist_59(&unsorted, BOOL_PTR, 0, 0);
+    for (size_t i = 0; i < 3; i++)
+        err = push_back_dlist_59(unsorted, &unsorted_nodes[i]);
+    err = sort_dlist_59(unsorted, (void*)0);
+    printf("Assert: err = %d == %d ERR_NOT_SUPPORTED\n", err, ERR_NOT_SUPPORTED);
+    assert(ERR_NOT_SUPPORTED == err);
+    dlist_node_59* unsorted_node = unsorted->head;
+    for (size_t i = 0; i < 2; i++)
+        unsorted_node = unsorted_node->next;
+    printf("Assert: %p == %p, every node kept after a failed sort\n", (void*)0, (void*)unsorted_node->next);
+    assert(!unsorted_node->next && &unsorted_node->next == unsorted->tail);
+    err = deinit_dlist_59(&unsorted);
+    err = ERR_NONE;
+
+    // concat, split_at, splice
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Testing concat_dlist(), split_at_dlist(), splice_dlist()...");
+
+    dlist_59* other_list = (void*)0;
+    err = init_dlist_59(&other_list, U64_PTR, 0);
+
+    err = concat_dlist_59(list, (void*)0);
+    printf("Assert: err = %d == %d ERR_INV_PARAM\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+
+    err = concat_dlist_59(list, list);
+    printf("Assert: err = %d == %d ERR_INV_PARAM\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+
+    err = concat_dlist_59(list, other_list);
+    printf("Assert: err = %d == %d ERR_INV_PARAM, lists of different types\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+
+    err = split_at_dlist_59(list, 0, other_list);
+    printf("Assert: err = %d == %d ERR_INV_PARAM, lists of different types\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+
+    err = deinit_dlist_59(&other_list);
+    err = init_dlist_59(&other_list, I64_PTR, 0);
+
+    err = split_at_dlist_59(list, 0, other_list);
+    printf("Assert: err = %d == %d ERR_INV_PARAM, index past the end\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+
+    err = splice_dlist_59(list, (void*)0, other_list, (void*)0, node1);
+    printf("Assert: err = %d == %d ERR_INV_PARAM\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+
+    err = deinit_dlist_59(&other_list);
+    err = ERR_NONE;
+
+    // unlink node
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Testing unlink_node_from_dlist()...");
+
+    err = unlink_node_from_dlist_59(list, (void*)0);
+    printf("Assert: err = %d == %d ERR_INV_PARAM\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+
+    err = unlink_node_from_dlist_59(list, node1);
+    printf("Assert: err = %d == %d ERR_CONTAINER_EMPTY\n", err, ERR_CONTAINER_EMPTY);
+    assert(ERR_CONTAINER_EMPTY == err);
+
+    dlist_59* owner = (void*)0;
+    dlist_node_59 owned[3];
+    err = init_intrusive_dlist_59(&owner, STRUCT_PTR, 0, 0);
+    for (size_t i = 0; i < 3; i++)
+        err = push_back_dlist_59(owner, &owned[i]);
+    dlist_node_59 stray = {(void*)0, (void*)0, (void*)0};
+    err = unlink_node_from_dlist_59(owner, &stray);
+    printf("Assert: err = %d == %d ERR_OBJ_NOT_FOUND, node in no list\n", err, ERR_OBJ_NOT_FOUND);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+#ifdef DEBUG_59
+    dlist_59* other_owner = (void*)0;
+    dlist_node_59 other_owned[3];
+    err = init_intrusive_dlist_59(&other_owner, STRUCT_PTR, 0, 0);
+    for (size_t i = 0; i < 3; i++)
+        err = push_back_dlist_59(other_owner, &other_owned[i]);
+    err = unlink_node_from_dlist_59(owner, &other_owned[1]);
+    printf("Assert: err = %d == %d ERR_OBJ_NOT_FOUND, node of another list\n", err, ERR_OBJ_NOT_FOUND);
+    assert(ERR_OBJ_NOT_FOUND == err && 3 == other_owner->size);
+    err = deinit_dlist_59(&other_owner);
+#endif
+
+    err = deinit_dlist_59(&owner);
+    err = ERR_NONE;
+
     // deinit list
     puts("- - - - - - - - - - - - - - - - -");
     puts("Testing deinit_dlist()...");
@@ -34,6 +34,7 @@
 */
 
 #include <assert.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -45,6 +46,27 @@
 
 #include "dlist.h"
 
+/*
+========================================================================================================================
+- - INTERNAL TEST HELPERS - -
+========================================================================================================================
+*/
+
+typedef struct sort_item
+{
+    u64 key;
+    u64 seq;
+    dlist_node_59 link;
+} sort_item;
+
+static ERR_59_e _compare_sort_items(void const* const obj_A, void const* const obj_B, i64* const diff_out)
+{
+    u64 const key_A = ((sort_item const*)obj_A)->key;
+    u64 const key_B = ((sort_item const*)obj_B)->key;
+    *diff_out = (key_A > key_B) - (key_A < key_B);
+    return ERR_NONE;
+}
+
 /*
 ========================================================================================================================
 - - UNIT TESTS - -
@@ -268,6 +290,248 @@ ERR_59_e test_dlist_59_interface(void)
     printf("Assert: expected = %lu == %lu = obj\n", val, *((u64*)node->node_obj));
     assert(*((u64*)node->node_obj) == val);
 
+    // intrusive list
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Checking intrusive dlist...");
+
+    struct intrusive_item
+    {
+        u64 id;
+        dlist_node_59 link;
+    } items[8];
+
+    dlist_59* intrusive = (void*)0;
+    err = init_intrusive_dlist_59(&intrusive, U64_PTR, 0, offsetof(struct intrusive_item, link));
+    if (ERR_NONE != err)
+        return err;
+    printf("Assert: intrusive = %d == 1\n", intrusive->intrusive);
+    assert(intrusive->intrusive);
+
+    for (u64 i = 0; i < 8; i++)
+    {
+        items[i].id = i;
+        if (0 == i % 2)
+            err = push_back_dlist_59(intrusive, &items[i].link);
+        else
+            err = push_front_dlist_59(intrusive, &items[i].link);
+        if (ERR_NONE != err)
+            return err;
+    }
+
+    u64 const intrusive_order[] = {7, 5, 3, 1, 0, 2, 4, 6};
+    node = intrusive->head;
+    for (size_t i = 0; i < 8; i++)
+    {
+        assert(intrusive_order[i] == CONTAINER_OF_59(node, struct intrusive_item, link)->id);
+        node = node->next;
+    }
+    printf("Assert: 6 == %lu = id of the object holding the tail node\n",
+           CONTAINER_OF_59(intrusive->tail, struct intrusive_item, link.next)->id);
+    assert(6 == CONTAINER_OF_59(intrusive->tail, struct intrusive_item, link.next)->id);
+
+    err = find_node_in_dlist_59(intrusive, &items[3].link, &v_out);
+    printf("Assert: %p == %p = find_node_in_dlist() hands back the object\n", (void*)&items[3], v_out);
+    assert(ERR_NONE == err && &items[3] == v_out);
+
+    err = remove_given_node_from_dlist_59(intrusive, &items[6].link);
+    assert(ERR_NONE == err);
+    err = pop_front_dlist_59(intrusive, &node);
+    assert(ERR_NONE == err && &items[7].link == node);
+    err = insert_node_into_dlist_59(intrusive, &items[7].link, 0);
+    assert(ERR_NONE == err);
+    err = insert_node_into_dlist_59(intrusive, &items[6].link, 100);
+    assert(ERR_NONE == err);
+    err = get_at_idx_dlist_59(intrusive, 7, &node);
+    printf("Assert: 6 == %lu = id at the end after reinserting\n",
+           CONTAINER_OF_59(node, struct intrusive_item, link)->id);
+    assert(ERR_NONE == err && &items[6].link == node && &items[6].link.next == intrusive->tail);
+
+    for (size_t i = 0; i < 8; i++)
+    {
+        err = pop_back_dlist_59(intrusive, &node);
+        assert(ERR_NONE == err);
+    }
+    assert(!intrusive->head && &intrusive->head == intrusive->tail);
+
+    // The items live on the stack, deinit must leave them alone.
+    err = push_back_dlist_59(intrusive, &items[0].link);
+    assert(ERR_NONE == err);
+    err = deinit_dlist_59(&intrusive);
+    printf("Assert: ERR_NONE == %d = deinit_dlist() of an intrusive list\n", err);
+    assert(ERR_NONE == err && !intrusive);
+
+    // sort()
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Checking sort_dlist()...");
+
+    dlist_59* sort_list = (void*)0;
+    err = init_dlist_59(&sort_list, U64_PTR, 0);
+    if (ERR_NONE != err)
+        return err;
+
+    err = sort_dlist_59(sort_list, (void*)0);
+    printf("Assert: ERR_NONE == %d = sort_dlist() of an empty list\n", err);
+    assert(ERR_NONE == err && !sort_list->head && &sort_list->head == sort_list->tail);
+
+    u64 sort_rng = 59;
+    for (size_t i = 0; i < 1000; i++)
+    {
+        sort_rng = sort_rng * 6364136223846793005UL + 1442695040888963407UL;
+        dlist_node_59* sort_node = (void*)0;
+        err = init_dlist_node_59(&sort_node, (void*)0, (void*)0, malloc(sizeof(u64)));
+        if (ERR_NONE != err)
+            return err;
+        *((u64*)sort_node->node_obj) = sort_rng >> 40;
+        err = push_back_dlist_59(sort_list, sort_node);
+        if (ERR_NONE != err)
+            return err;
+    }
+
+    err = sort_dlist_59(sort_list, (void*)0);
+    assert(ERR_NONE == err);
+    size_t sorted = 0;
+    dlist_node_59* prev = (void*)0;
+    for (node = sort_list->head; node; node = node->next)
+    {
+        assert(prev == node->last);
+        assert(!prev || *((u64*)prev->node_obj) <= *((u64*)node->node_obj));
+        prev = node;
+        sorted++;
+    }
+    printf("Assert: 1000 == %lu = nodes in ascending order after sort_dlist()\n", sorted);
+    assert(1000 == sorted && &prev->next == sort_list->tail);
+
+    err = deinit_dlist_59(&sort_list);
+    if (ERR_NONE != err)
+        return err;
+
+    // Stability, equal keys keep the order they were pushed in.
+    sort_item sort_items[64];
+    err = init_intrusive_dlist_59(&sort_list, STRUCT_PTR, 0, offsetof(sort_item, link));
+    if (ERR_NONE != err)
+        return err;
+    for (u64 i = 0; i < 64; i++)
+    {
+        sort_items[i].key = (i * 37) % 8;
+        sort_items[i].seq = i;
+        err = push_back_dlist_59(sort_list, &sort_items[i].link);
+        if (ERR_NONE != err)
+            return err;
+    }
+
+    err = sort_dlist_59(sort_list, _compare_sort_items);
+    assert(ERR_NONE == err);
+    sort_item const* prev_item = (void*)0;
+    for (node = sort_list->head; node; node = node->next)
+    {
+        sort_item const* item = CONTAINER_OF_59(node, sort_item, link);
+        assert(!prev_item || prev_item->key < item->key || (prev_item->key == item->key && prev_item->seq < item->seq));
+        prev_item = item;
+    }
+    printf("Assert: 7 == %lu = last key after a stable sort_dlist()\n", prev_item->key);
+    assert(7 == prev_item->key && &prev_item->link.next == sort_list->tail);
+
+    err = deinit_dlist_59(&sort_list);
+    if (ERR_NONE != err)
+        return err;
+
+    // concat(), split_at(), splice()
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Checking concat_dlist(), split_at_dlist(), splice_dlist()...");
+
+    dlist_node_59 move_nodes[8];
+    dlist_59* move_A = (void*)0;
+    dlist_59* move_B = (void*)0;
+    err = init_intrusive_dlist_59(&move_A, STRUCT_PTR, 0, 0);
+    if (ERR_NONE != err)
+        return err;
+    err = init_intrusive_dlist_59(&move_B, STRUCT_PTR, 0, 0);
+    if (ERR_NONE != err)
+        return err;
+    for (size_t i = 0; i < 8; i++)
+    {
+        err = push_back_dlist_59((4 > i) ? move_A : move_B, &move_nodes[i]);
+        if (ERR_NONE != err)
+            return err;
+    }
+
+    err = concat_dlist_59(move_A, move_B);
+    assert(ERR_NONE == err && !move_B->head && &move_B->head == move_B->tail);
+    printf("Assert: 8 == %lu, 0 == %lu = sizes after concat\n", move_A->size, move_B->size);
+    assert(8 == move_A->size && 0 == move_B->size);
+    assert(&move_nodes[7].next == move_A->tail);
+    node = move_A->head;
+    for (size_t i = 0; i < 8; i++, node = node->next)
+        assert(&move_nodes[i] == node);
+    puts("Assert: concat_dlist() appended every node in order and emptied the source");
+
+    err = split_at_dlist_59(move_A, 5, move_B);
+    printf("Assert: 5 == %lu, 3 == %lu = sizes after split_at\n", move_A->size, move_B->size);
+    assert(5 == move_A->size && 3 == move_B->size);
+    assert(ERR_NONE == err && &move_nodes[5] == move_B->head && &move_nodes[7].next == move_B->tail);
+    printf("Assert: %p == %p = tail of the list that was split\n", (void*)&move_nodes[4].next, (void*)move_A->tail);
+    assert(&move_nodes[4].next == move_A->tail && !move_nodes[4].next);
+    assert(!move_nodes[5].last);
+
+    err = split_at_dlist_59(move_A, 0, move_B);
+    assert(ERR_NONE == err && !move_A->head && &move_A->head == move_A->tail);
+    assert(0 == move_A->size && 8 == move_B->size);
+    node = move_B->head;
+    for (size_t i = 0; i < 8; i++, node = node->next)
+        assert(&move_nodes[(i + 5) % 8] == node);
+    puts("Assert: split_at_dlist() appended the split nodes to the destination");
+
+    // Move 6..7 in front of 2, then 0 to the very end, of the same list.
+    err = splice_dlist_59(move_B, &move_nodes[2], move_B, &move_nodes[6], &move_nodes[7]);
+    assert(ERR_NONE == err);
+    err = splice_dlist_59(move_B, (void*)0, move_B, &move_nodes[0], &move_nodes[0]);
+    assert(ERR_NONE == err);
+    size_t const splice_order[] = {5, 1, 6, 7, 2, 3, 4, 0};
+    node = move_B->head;
+    for (size_t i = 0; i < 8; i++, node = node->next)
+    {
+        assert(&move_nodes[splice_order[i]] == node);
+        assert((0 == i) ? !node->last : &move_nodes[splice_order[i - 1]] == node->last);
+    }
+    printf("Assert: %p == %p = tail after splicing the head to the end\n", (void*)&move_nodes[0].next,
+           (void*)move_B->tail);
+    assert(&move_nodes[0].next == move_B->tail);
+
+    // A run spanning the whole list moved into an empty list.
+    err = splice_dlist_59(move_A, (void*)0, move_B, &move_nodes[5], &move_nodes[0]);
+    assert(ERR_NONE == err && !move_B->head && &move_B->head == move_B->tail);
+    printf("Assert: 8 == %lu, 0 == %lu = sizes after splicing between lists\n", move_A->size, move_B->size);
+    assert(8 == move_A->size && 0 == move_B->size);
+    assert(&move_nodes[5] == move_A->head && &move_nodes[0].next == move_A->tail);
+    puts("Assert: splice_dlist() relinked runs within and between lists");
+
+    // unlink_node()
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Checking unlink_node_from_dlist()...");
+
+    err = unlink_node_from_dlist_59(move_A, &move_nodes[2]);
+    assert(ERR_NONE == err && !move_nodes[2].next && !move_nodes[2].last);
+    assert(&move_nodes[3] == move_nodes[7].next && &move_nodes[7] == move_nodes[3].last);
+    err = unlink_node_from_dlist_59(move_A, &move_nodes[5]);
+    assert(ERR_NONE == err && &move_nodes[1] == move_A->head && !move_nodes[1].last);
+    err = unlink_node_from_dlist_59(move_A, &move_nodes[0]);
+    assert(ERR_NONE == err && &move_nodes[4].next == move_A->tail);
+    printf("Assert: 5 == %lu = size after unlinking the middle, head and tail\n", move_A->size);
+    assert(5 == move_A->size);
+    err = unlink_node_from_dlist_59(move_A, &move_nodes[2]);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = unlink_node_from_dlist() of an unlinked node\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+    err = pop_back_dlist_59(move_A, &node);
+    assert(ERR_NONE == err && &move_nodes[4] == node && &move_nodes[3].next == move_A->tail && 4 == move_A->size);
+
+    err = deinit_dlist_59(&move_A);
+    if (ERR_NONE != err)
+        return err;
+    err = deinit_dlist_59(&move_B);
+    if (ERR_NONE != err)
+        return err;
+
     // deinit_list()
     puts("- - - - - - - - - - - - - - - - -");
     puts("Checking deinit_list()...");
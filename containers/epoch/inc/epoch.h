@@ -0,0 +1,136 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: This file contains the declarations for epoch based memory reclamation, which lets lock-free readers of the
+ * concurrent containers safely traverse nodes that writers are concurrently unlinking.
+ **********************************************************************************************************************/
+
+#pragma once
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "containers_common.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Maximum number of threads that may be inside epochs at once, each thread claims a slot on its first enter
+ * and gives it back when it exits.
+ **********************************************************************************************************************/
+#define EPOCH_MAX_THREADS 256
+
+/***********************************************************************************************************************
+ * @brief: Number of retired nodes that triggers an attempt to advance the epoch and reclaim the oldest nodes.
+ **********************************************************************************************************************/
+#define EPOCH_RECLAIM_THRESHOLD 64
+
+/*
+========================================================================================================================
+- - TYPEDEFS - -
+========================================================================================================================
+*/
+
+typedef struct epoch_node_59 epoch_node_59;
+
+/*
+========================================================================================================================
+- - STRUCTS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @epoch_node_59
+ * @brief: Intrusive header embedded in objects that are retired through the epoch, so retiring never allocates.
+ *
+ * @next: Next retired node waiting for the same epoch, owned by the epoch once retired.
+ * @reclaim: Function called to free the object once no reader can still hold a reference to it.
+ **********************************************************************************************************************/
+struct epoch_node_59
+{
+    epoch_node_59* next;
+    void (*reclaim)(epoch_node_59* node);
+};
+
+/*
+========================================================================================================================
+- - MODULE FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Pins the calling thread to the current epoch, nodes retired from now on will not be reclaimed until the
+ * thread calls @exit_epoch_59. Calls may be nested.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note ERR_CONTAINER_AT_CAPACITY is returned when @EPOCH_MAX_THREADS threads already hold slots.
+ **********************************************************************************************************************/
+ERR_59_e enter_epoch_59(void);
+
+/***********************************************************************************************************************
+ * @brief: Unpins the calling thread, matching a previous call to @enter_epoch_59.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e exit_epoch_59(void);
+
+/***********************************************************************************************************************
+ * @brief: Retires a node that has already been unlinked from its container, @reclaim is called once every thread that
+ * could still be reading it has left its epoch.
+ *
+ * @param[in] node: Header of the unlinked object.
+ * @param[in] reclaim: Function that frees the object holding @node.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e retire_epoch_59(epoch_node_59* const node, void (*reclaim)(epoch_node_59* node));
+
+/***********************************************************************************************************************
+ * @brief: Advances the epoch as far as pinned threads allow and reclaims every node that is safe to free.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note When no other thread is pinned every retired node is reclaimed, use this when tearing down a container.
+ * @warning Must not be called while the calling thread is inside an epoch, ERR_NOT_SUPPORTED is returned.
+ **********************************************************************************************************************/
+ERR_59_e flush_epoch_59(void);
@@ -0,0 +1,300 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Contains all the definitions for epoch based memory reclamation.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <threads.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "epoch.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Number of limbo lists, nodes retired in epoch e are safe once the global epoch has reached e + 2.
+ **********************************************************************************************************************/
+#define EPOCH_LIMBO_LISTS 3
+
+/***********************************************************************************************************************
+ * @brief: Cache line size used to keep thread slots from sharing lines.
+ **********************************************************************************************************************/
+#define EPOCH_CACHE_LINE 64
+
+/*
+========================================================================================================================
+- - TYPEDEFS - -
+========================================================================================================================
+*/
+
+typedef struct epoch_slot_59 epoch_slot_59;
+
+/*
+========================================================================================================================
+- - STRUCTS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @epoch_slot_59
+ * @brief: Per thread announcement of the epoch a thread is reading in.
+ *
+ * @state: Epoch the thread is pinned to shifted left by one, with the low bit set while the thread is pinned.
+ * @in_use: Whether a thread has claimed this slot.
+ **********************************************************************************************************************/
+struct epoch_slot_59
+{
+    _Alignas(EPOCH_CACHE_LINE) atomic_uint_fast64_t state;
+    atomic_bool in_use;
+};
+
+/*
+========================================================================================================================
+- - INTERNAL STATE - -
+========================================================================================================================
+*/
+
+static epoch_slot_59 epoch_slots[EPOCH_MAX_THREADS];
+static atomic_uint_fast64_t epoch_global = 0;
+
+static mtx_t epoch_limbo_lock;
+static epoch_node_59* epoch_limbo[EPOCH_LIMBO_LISTS];
+static size_t epoch_limbo_count = 0;
+
+static once_flag epoch_once = ONCE_FLAG_INIT;
+static bool epoch_init_ok = false;
+static tss_t epoch_slot_key;
+
+static _Thread_local size_t epoch_tls_slot = EPOCH_MAX_THREADS;
+static _Thread_local size_t epoch_tls_depth = 0;
+
+/*
+========================================================================================================================
+- - INTERNAL FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Gives a thread's slot back when the thread exits, registered as the thread specific storage destructor.
+ *
+ * @param[in] slot: Slot index plus one, stored so that slot 0 is not mistaken for no value.
+ **********************************************************************************************************************/
+static void _release_slot_epoch_59(void* slot)
+{
+    size_t const idx = (size_t)(uintptr_t)slot - 1;
+    atomic_store_explicit(&epoch_slots[idx].state, 0, memory_order_release);
+    atomic_store_explicit(&epoch_slots[idx].in_use, false, memory_order_release);
+}
+
+/***********************************************************************************************************************
+ * @brief: One time initialization of the limbo lock and the slot release hook.
+ **********************************************************************************************************************/
+static void _init_once_epoch_59(void)
+{
+    if (thrd_success != mtx_init(&epoch_limbo_lock, mtx_plain))
+        return;
+    if (thrd_success != tss_create(&epoch_slot_key, _release_slot_epoch_59))
+    {
+        mtx_destroy(&epoch_limbo_lock);
+        return;
+    }
+    epoch_init_ok = true;
+}
+
+/***********************************************************************************************************************
+ * @brief: Claims a free slot for the calling thread.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _claim_slot_epoch_59(void)
+{
+    for (size_t i = 0; i < EPOCH_MAX_THREADS; i++)
+    {
+        bool expected = false;
+        if (atomic_compare_exchange_strong(&epoch_slots[i].in_use, &expected, true))
+        {
+            if (thrd_success != tss_set(epoch_slot_key, (void*)(uintptr_t)(i + 1)))
+            {
+                atomic_store(&epoch_slots[i].in_use, false);
+                return ERR_INTRNL;
+            }
+            epoch_tls_slot = i;
+            return ERR_NONE;
+        }
+    }
+
+    return ERR_CONTAINER_AT_CAPACITY;
+}
+
+/***********************************************************************************************************************
+ * @brief: Advances the global epoch if every pinned thread has caught up to it, and reclaims the nodes retired two
+ * epochs ago which no reader can reach anymore.
+ *
+ * @retval bool: true if the epoch advanced.
+ **********************************************************************************************************************/
+static bool _try_advance_epoch_59(void)
+{
+    mtx_lock(&epoch_limbo_lock);
+
+    uint_fast64_t const global = atomic_load(&epoch_global);
+    for (size_t i = 0; i < EPOCH_MAX_THREADS; i++)
+    {
+        uint_fast64_t const state = atomic_load(&epoch_slots[i].state);
+        if ((state & 1) && (state >> 1) != global)
+        {
+            mtx_unlock(&epoch_limbo_lock);
+            return false;
+        }
+    }
+
+    atomic_store(&epoch_global, global + 1);
+
+    // Nodes retired in global - 1 share a list index with global + 2.
+    size_t const safe_idx = (size_t)((global + 2) % EPOCH_LIMBO_LISTS);
+    epoch_node_59* node = epoch_limbo[safe_idx];
+    epoch_limbo[safe_idx] = (void*)0;
+    size_t reclaimed = 0;
+    for (epoch_node_59 const* n = node; n; n = n->next)
+        reclaimed++;
+    epoch_limbo_count -= reclaimed;
+
+    mtx_unlock(&epoch_limbo_lock);
+
+    while (node)
+    {
+        epoch_node_59* next = node->next;
+        node->reclaim(node);
+        node = next;
+    }
+
+    return true;
+}
+
+/*
+========================================================================================================================
+- - FUNCTION DEFINITIONS - -
+========================================================================================================================
+*/
+
+ERR_59_e enter_epoch_59(void)
+{
+    call_once(&epoch_once, _init_once_epoch_59);
+    if (!epoch_init_ok)
+        return ERR_INTRNL;
+
+    if (EPOCH_MAX_THREADS == epoch_tls_slot)
+    {
+        ERR_59_e err = _claim_slot_epoch_59();
+        if (ERR_NONE != err)
+            return err;
+    }
+
+    if (0 == epoch_tls_depth++)
+    {
+        // Announce, then confirm the epoch did not move underneath us so we never pin a stale epoch.
+        atomic_uint_fast64_t* state = &epoch_slots[epoch_tls_slot].state;
+        uint_fast64_t global = atomic_load(&epoch_global);
+        atomic_store(state, (global << 1) | 1);
+        while (global != atomic_load(&epoch_global))
+        {
+            global = atomic_load(&epoch_global);
+            atomic_store(state, (global << 1) | 1);
+        }
+    }
+
+    return ERR_NONE;
+}
+
+ERR_59_e exit_epoch_59(void)
+{
+    if (0 == epoch_tls_depth || EPOCH_MAX_THREADS == epoch_tls_slot)
+        return ERR_INV_PARAM;
+
+    if (0 == --epoch_tls_depth)
+        atomic_store_explicit(&epoch_slots[epoch_tls_slot].state, 0, memory_order_release);
+
+    return ERR_NONE;
+}
+
+ERR_59_e retire_epoch_59(epoch_node_59* const node, void (*reclaim)(epoch_node_59* node))
+{
+    if (!node || !reclaim)
+        return ERR_INV_PARAM;
+
+    call_once(&epoch_once, _init_once_epoch_59);
+    if (!epoch_init_ok)
+        return ERR_INTRNL;
+
+    node->reclaim = reclaim;
+
+    mtx_lock(&epoch_limbo_lock);
+    size_t const idx = (size_t)(atomic_load(&epoch_global) % EPOCH_LIMBO_LISTS);
+    node->next = epoch_limbo[idx];
+    epoch_limbo[idx] = node;
+    bool const try_advance = (++epoch_limbo_count >= EPOCH_RECLAIM_THRESHOLD);
+    mtx_unlock(&epoch_limbo_lock);
+
+    if (try_advance)
+        _try_advance_epoch_59();
+
+    return ERR_NONE;
+}
+
+ERR_59_e flush_epoch_59(void)
+{
+    if (0 != epoch_tls_depth)
+        return ERR_NOT_SUPPORTED;
+
+    call_once(&epoch_once, _init_once_epoch_59);
+    if (!epoch_init_ok)
+        return ERR_INTRNL;
+
+    // Every list is reclaimed after as many advances as there are lists.
+    for (size_t i = 0; i < EPOCH_LIMBO_LISTS; i++)
+    {
+        if (!_try_advance_epoch_59())
+            break;
+    }
+
+    return ERR_NONE;
+}
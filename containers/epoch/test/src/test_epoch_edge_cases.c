@@ -0,0 +1,133 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Test cases for epoch based reclamation that cover edge cases and invalid parameters.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "epoch.h"
+
+/*
+========================================================================================================================
+- - INTERNAL TEST HELPERS - -
+========================================================================================================================
+*/
+
+static void _reclaim_test_node(epoch_node_59* node)
+{
+    free(node);
+}
+
+/*
+========================================================================================================================
+- - UNIT TESTS - -
+========================================================================================================================
+*/
+
+ERR_59_e test_epoch_59_edge_cases(void)
+{
+    ERR_59_e err = ERR_NONE;
+    epoch_node_59 node = {0};
+
+    // Test exit_epoch edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test exit_epoch...");
+
+    err = exit_epoch_59();
+    printf("Assert: ERR_INV_PARAM == %d = exit_epoch() without enter\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    // Test retire_epoch edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test retire_epoch...");
+
+    err = retire_epoch_59((void*)0, _reclaim_test_node);
+    printf("Assert: ERR_INV_PARAM == %d = retire_epoch() with void node\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = retire_epoch_59(&node, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = retire_epoch() with void reclaim\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    // Test flush_epoch edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test flush_epoch...");
+
+    err = flush_epoch_59();
+    printf("Assert: ERR_NONE == %d = flush_epoch() with nothing retired\n", err);
+    assert(ERR_NONE == err);
+
+    err = enter_epoch_59();
+    assert(ERR_NONE == err);
+    err = flush_epoch_59();
+    printf("Assert: ERR_NOT_SUPPORTED == %d = flush_epoch() inside an epoch\n", err);
+    assert(ERR_NOT_SUPPORTED == err);
+    err = exit_epoch_59();
+    assert(ERR_NONE == err);
+
+    err = exit_epoch_59();
+    printf("Assert: ERR_INV_PARAM == %d = exit_epoch() unbalanced\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    return ERR_NONE;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    puts("- - -  START OF EPOCH TEST  - - -");
+    puts("- - - EPOCH EDGE CASES - - -");
+
+    ERR_59_e err = test_epoch_59_edge_cases();
+    printf("ERROR CODE: %d\n", err);
+    assert(ERR_NONE == err);
+
+    puts("- - - - END OF EPOCH TEST - - - -");
+    return err;
+}
@@ -0,0 +1,188 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Test cases for epoch based reclamation that cover the module interface.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <threads.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "epoch.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+#define TEST_NODE_COUNT 200
+
+/*
+========================================================================================================================
+- - INTERNAL TEST HELPERS - -
+========================================================================================================================
+*/
+
+static atomic_size_t reclaimed = 0;
+static atomic_int reader_stage = 0;
+
+static void _reclaim_test_node(epoch_node_59* node)
+{
+    atomic_fetch_add(&reclaimed, 1);
+    free(node);
+}
+
+static int _pinned_reader(void* arg)
+{
+    (void)arg;
+    if (ERR_NONE != enter_epoch_59())
+        return 1;
+
+    // Stay pinned until the main thread has tried to reclaim.
+    atomic_store(&reader_stage, 1);
+    while (2 != atomic_load(&reader_stage))
+        thrd_yield();
+
+    return ERR_NONE != exit_epoch_59();
+}
+
+/*
+========================================================================================================================
+- - UNIT TESTS - -
+========================================================================================================================
+*/
+
+ERR_59_e test_epoch_59_interface(void)
+{
+    ERR_59_e err = ERR_NONE;
+
+    // Test enter and exit nesting
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test enter_epoch/exit_epoch...");
+
+    err = enter_epoch_59();
+    printf("Assert: ERR_NONE == %d = enter_epoch()\n", err);
+    assert(ERR_NONE == err);
+
+    err = enter_epoch_59();
+    printf("Assert: ERR_NONE == %d = enter_epoch() nested\n", err);
+    assert(ERR_NONE == err);
+
+    err = exit_epoch_59();
+    assert(ERR_NONE == err);
+    err = exit_epoch_59();
+    printf("Assert: ERR_NONE == %d = exit_epoch()\n", err);
+    assert(ERR_NONE == err);
+
+    // Test retire and flush with no readers
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test retire_epoch/flush_epoch...");
+
+    for (size_t i = 0; i < TEST_NODE_COUNT; i++)
+    {
+        epoch_node_59* node = malloc(sizeof(epoch_node_59));
+        if (!node)
+            return ERR_NO_MEM;
+        err = retire_epoch_59(node, _reclaim_test_node);
+        assert(ERR_NONE == err);
+    }
+
+    err = flush_epoch_59();
+    printf("Assert: ERR_NONE == %d = flush_epoch()\n", err);
+    assert(ERR_NONE == err);
+    printf("Assert: %d == %lu = reclaimed nodes\n", TEST_NODE_COUNT, atomic_load(&reclaimed));
+    assert(TEST_NODE_COUNT == atomic_load(&reclaimed));
+
+    // Test a pinned reader holds back reclamation
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test pinned reader...");
+
+    thrd_t reader;
+    if (thrd_success != thrd_create(&reader, _pinned_reader, (void*)0))
+        return ERR_INTRNL;
+    while (1 != atomic_load(&reader_stage))
+        thrd_yield();
+
+    epoch_node_59* node = malloc(sizeof(epoch_node_59));
+    if (!node)
+        return ERR_NO_MEM;
+    err = retire_epoch_59(node, _reclaim_test_node);
+    assert(ERR_NONE == err);
+
+    err = flush_epoch_59();
+    assert(ERR_NONE == err);
+    printf("Assert: %d == %lu = reclaimed nodes while reader pinned\n", TEST_NODE_COUNT, atomic_load(&reclaimed));
+    assert(TEST_NODE_COUNT == atomic_load(&reclaimed));
+
+    atomic_store(&reader_stage, 2);
+    int reader_res = 1;
+    thrd_join(reader, &reader_res);
+    assert(0 == reader_res);
+
+    err = flush_epoch_59();
+    assert(ERR_NONE == err);
+    printf("Assert: %d == %lu = reclaimed nodes after reader exit\n", TEST_NODE_COUNT + 1, atomic_load(&reclaimed));
+    assert(TEST_NODE_COUNT + 1 == atomic_load(&reclaimed));
+
+    return err;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    puts("- - -  START OF EPOCH TEST  - - -");
+    puts("- - - INTERFACE TESTS - - -");
+
+    ERR_59_e err = test_epoch_59_interface();
+    printf("ERROR CODE: %d\n", err);
+    assert(ERR_NONE == err);
+
+    puts("- - - - END OF EPOCH TEST - - - -");
+    return err;
+}
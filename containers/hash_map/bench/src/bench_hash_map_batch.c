@@ -0,0 +1,197 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Benchmarks batched hash map lookups and upserts against the equivalent single key loops.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "hash_map.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Default number of entries in the benchmarked map, override with the first program argument.
+ **********************************************************************************************************************/
+#define BENCH_DEFAULT_ENTRIES (1UL << 20)
+
+/***********************************************************************************************************************
+ * @brief: Number of keys resolved per request, matching the 64-256 keys a request handler resolves.
+ **********************************************************************************************************************/
+#define BENCH_KEYS_PER_REQUEST 128
+
+/***********************************************************************************************************************
+ * @brief: Number of requests timed per benchmark.
+ **********************************************************************************************************************/
+#define BENCH_REQUESTS 20000
+
+/*
+========================================================================================================================
+- - BENCH HELPERS - -
+========================================================================================================================
+*/
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static u64 xorshift(u64* state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+static u64 key_for(u64 const i)
+{
+    return i * 0x9E3779B97F4A7C15ULL;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    size_t const entries = (1 < argc) ? strtoul(argv[1], (void*)0, 10) : BENCH_DEFAULT_ENTRIES;
+    if (0 == entries)
+        return ERR_INV_PARAM;
+
+    u64* keys = malloc(sizeof(u64) * BENCH_KEYS_PER_REQUEST);
+    void** key_ptrs = malloc(sizeof(void*) * BENCH_KEYS_PER_REQUEST);
+    void** val_ptrs = malloc(sizeof(void*) * BENCH_KEYS_PER_REQUEST);
+    if (!keys || !key_ptrs || !val_ptrs)
+        return ERR_NO_MEM;
+    for (size_t i = 0; i < BENCH_KEYS_PER_REQUEST; i++)
+    {
+        key_ptrs[i] = &keys[i];
+        val_ptrs[i] = &keys[i];
+    }
+
+    // Populate one map with single upserts and another with batched upserts.
+    hash_map_59* map = (void*)0;
+    hash_map_59* batch_map = (void*)0;
+    ERR_59_e err = init_copy_hash_map_59(&map, U64_PTR, U64_PTR, 0, 0, 0);
+    if (ERR_NONE != err)
+        return err;
+    err = init_copy_hash_map_59(&batch_map, U64_PTR, U64_PTR, 0, 0, 0);
+    if (ERR_NONE != err)
+        return err;
+
+    double start = now_ns();
+    for (u64 i = 0; i < entries; i++)
+    {
+        u64 key = key_for(i);
+        err = upsert_into_hash_map_59(map, &key, &key);
+        if (ERR_NONE != err)
+            return err;
+    }
+    double const single_upsert_ns = (now_ns() - start) / (double)entries;
+
+    start = now_ns();
+    for (u64 i = 0; i < entries; i += BENCH_KEYS_PER_REQUEST)
+    {
+        size_t const batch = (entries - i < BENCH_KEYS_PER_REQUEST) ? entries - i : BENCH_KEYS_PER_REQUEST;
+        for (size_t j = 0; j < batch; j++)
+            keys[j] = key_for(i + j);
+        err = upsert_many_into_hash_map_59(batch_map, key_ptrs, val_ptrs, batch);
+        if (ERR_NONE != err)
+            return err;
+    }
+    double const batch_upsert_ns = (now_ns() - start) / (double)entries;
+
+    // Resolve the same random requests with a get loop and with get_many.
+    u64 checksum = 0;
+    u64 rng = 59;
+    void* val = (void*)0;
+    start = now_ns();
+    for (size_t r = 0; r < BENCH_REQUESTS; r++)
+    {
+        for (size_t j = 0; j < BENCH_KEYS_PER_REQUEST; j++)
+            keys[j] = key_for(xorshift(&rng) % entries);
+        for (size_t j = 0; j < BENCH_KEYS_PER_REQUEST; j++)
+        {
+            err = get_from_hash_map_59(map, &keys[j], &val);
+            if (ERR_NONE != err)
+                return err;
+            checksum += *(u64*)val;
+        }
+    }
+    double const single_get_ns = (now_ns() - start) / (double)(BENCH_REQUESTS * BENCH_KEYS_PER_REQUEST);
+
+    rng = 59;
+    start = now_ns();
+    for (size_t r = 0; r < BENCH_REQUESTS; r++)
+    {
+        for (size_t j = 0; j < BENCH_KEYS_PER_REQUEST; j++)
+            keys[j] = key_for(xorshift(&rng) % entries);
+        err = get_many_from_hash_map_59(map, key_ptrs, BENCH_KEYS_PER_REQUEST, val_ptrs);
+        if (ERR_NONE != err)
+            return err;
+        for (size_t j = 0; j < BENCH_KEYS_PER_REQUEST; j++)
+            checksum -= *(u64*)val_ptrs[j];
+    }
+    double const batch_get_ns = (now_ns() - start) / (double)(BENCH_REQUESTS * BENCH_KEYS_PER_REQUEST);
+
+    printf("entries: %zu, table_size: %zu, keys per request: %d\n", entries, map->table_size, BENCH_KEYS_PER_REQUEST);
+    printf("upsert loop:    %8.2f ns/key\n", single_upsert_ns);
+    printf("upsert_many:    %8.2f ns/key\n", batch_upsert_ns);
+    printf("get loop:       %8.2f ns/key\n", single_get_ns);
+    printf("get_many:       %8.2f ns/key\n", batch_get_ns);
+    printf("checksum (expect 0): %lu\n", checksum);
+
+    deinit_hash_map_59(&map);
+    deinit_hash_map_59(&batch_map);
+    free(keys);
+    free(key_ptrs);
+    free(val_ptrs);
+
+    return ERR_NONE;
+}
@@ -0,0 +1,145 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Benchmarks building a hash map from a bulk array with build_hash_map_59 across thread counts against a serial
+ * upsert loop.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "hash_map.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Default number of pairs to build the map from, override with the first program argument.
+ **********************************************************************************************************************/
+#define BENCH_DEFAULT_ENTRIES (1UL << 22)
+
+/***********************************************************************************************************************
+ * @brief: Largest thread count benchmarked, thread counts double from 1 up to it.
+ **********************************************************************************************************************/
+#define BENCH_MAX_THREADS 8
+
+/*
+========================================================================================================================
+- - BENCH HELPERS - -
+========================================================================================================================
+*/
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static u64 key_for(u64 const i)
+{
+    return i * 0x9E3779B97F4A7C15ULL;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    size_t const entries = (1 < argc) ? strtoul(argv[1], (void*)0, 10) : BENCH_DEFAULT_ENTRIES;
+    if (0 == entries)
+        return ERR_INV_PARAM;
+
+    u64* keys = malloc(sizeof(u64) * entries);
+    void** key_ptrs = malloc(sizeof(void*) * entries);
+    if (!keys || !key_ptrs)
+        return ERR_NO_MEM;
+    for (size_t i = 0; i < entries; i++)
+    {
+        keys[i] = key_for(i);
+        key_ptrs[i] = &keys[i];
+    }
+
+    // The serial baseline is the upsert loop a startup populating its map would run.
+    hash_map_59* map = (void*)0;
+    ERR_59_e err = init_copy_hash_map_59(&map, U64_PTR, U64_PTR, 0, 0, 0);
+    if (ERR_NONE != err)
+        return err;
+    double start = now_ns();
+    for (size_t i = 0; i < entries; i++)
+    {
+        err = upsert_into_hash_map_59(map, &keys[i], &keys[i]);
+        if (ERR_NONE != err)
+            return err;
+    }
+    double const serial_ns = (now_ns() - start) / (double)entries;
+    deinit_hash_map_59(&map);
+
+    printf("entries: %zu\n", entries);
+    printf("upsert loop:          %8.2f ns/key\n", serial_ns);
+
+    for (size_t threads = 1; threads <= BENCH_MAX_THREADS; threads <<= 1)
+    {
+        err = init_copy_hash_map_59(&map, U64_PTR, U64_PTR, 0, 0, 0);
+        if (ERR_NONE != err)
+            return err;
+        start = now_ns();
+        err = build_hash_map_59(map, key_ptrs, key_ptrs, entries, threads);
+        if (ERR_NONE != err)
+            return err;
+        double const build_ns = (now_ns() - start) / (double)entries;
+        if (entries != map->size)
+            return ERR_INTRNL;
+        deinit_hash_map_59(&map);
+
+        printf("build, %zu thread(s):   %8.2f ns/key, %5.2fx the upsert loop\n", threads, build_ns,
+               serial_ns / build_ns);
+    }
+
+    free(keys);
+    free(key_ptrs);
+
+    return ERR_NONE;
+}
@@ -0,0 +1,140 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Benchmarks building, querying and freeing many tiny hash maps, as held per session.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "hash_map.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Default number of live maps, override with the first program argument.
+ **********************************************************************************************************************/
+#define BENCH_DEFAULT_MAPS (1UL << 20)
+
+/***********************************************************************************************************************
+ * @brief: Default number of keys per map, override with the second program argument.
+ **********************************************************************************************************************/
+#define BENCH_DEFAULT_KEYS 4
+
+/*
+========================================================================================================================
+- - BENCH HELPERS - -
+========================================================================================================================
+*/
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    size_t const maps = (1 < argc) ? strtoul(argv[1], (void*)0, 10) : BENCH_DEFAULT_MAPS;
+    size_t const keys = (2 < argc) ? strtoul(argv[2], (void*)0, 10) : BENCH_DEFAULT_KEYS;
+    if (0 == maps || 0 == keys)
+        return ERR_INV_PARAM;
+
+    hash_map_59** sessions = malloc(sizeof(hash_map_59*) * maps);
+    if (!sessions)
+        return ERR_NO_MEM;
+
+    ERR_59_e err = ERR_NONE;
+    double start = now_ns();
+    for (size_t m = 0; m < maps; m++)
+    {
+        err = init_copy_hash_map_59(&sessions[m], U64_PTR, U64_PTR, 0, 0, 0);
+        if (ERR_NONE != err)
+            return err;
+        for (u64 k = 0; k < keys; k++)
+        {
+            u64 val = m + k;
+            err = upsert_into_hash_map_59(sessions[m], &k, &val);
+            if (ERR_NONE != err)
+                return err;
+        }
+    }
+    double const build_ns = (now_ns() - start) / (double)maps;
+
+    u64 checksum = 0;
+    void* val = (void*)0;
+    start = now_ns();
+    for (size_t m = 0; m < maps; m++)
+    {
+        for (u64 k = 0; k < keys; k++)
+        {
+            err = get_from_hash_map_59(sessions[m], &k, &val);
+            if (ERR_NONE != err)
+                return err;
+            checksum += *(u64*)val - (m + k);
+        }
+    }
+    double const get_ns = (now_ns() - start) / (double)(maps * keys);
+
+    start = now_ns();
+    for (size_t m = 0; m < maps; m++)
+        deinit_hash_map_59(&sessions[m]);
+    double const deinit_ns = (now_ns() - start) / (double)maps;
+
+    printf("maps: %zu, keys per map: %zu\n", maps, keys);
+    printf("init + upserts: %8.2f ns/map\n", build_ns);
+    printf("get:            %8.2f ns/key\n", get_ns);
+    printf("deinit:         %8.2f ns/map\n", deinit_ns);
+    printf("checksum (expect 0): %lu\n", checksum);
+
+    free(sessions);
+
+    return ERR_NONE;
+}
@@ -0,0 +1,185 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Benchmarks upserts and gets of URL like STR keys of 64 to 256 bytes in a copy-in hash map.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "hash_map.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Default number of keys, override with the first program argument.
+ **********************************************************************************************************************/
+#define BENCH_DEFAULT_KEYS (1UL << 17)
+
+/***********************************************************************************************************************
+ * @brief: Shortest and longest generated key, terminator excluded.
+ **********************************************************************************************************************/
+#define BENCH_MIN_KEY_LEN 64
+#define BENCH_MAX_KEY_LEN 256
+
+/***********************************************************************************************************************
+ * @brief: Number of passes of gets over every key.
+ **********************************************************************************************************************/
+#define BENCH_GET_ROUNDS 8
+
+/*
+========================================================================================================================
+- - BENCH HELPERS - -
+========================================================================================================================
+*/
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static u64 xorshift(u64* state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+// Urls sharing a long prefix and differing in a few path characters, the worst case for weak string hashes.
+static void make_key(char* key, size_t const idx, u64* rng)
+{
+    static char const alphabet[] = "abcdefghijklmnopqrstuvwxyz0123456789-_/";
+    size_t const len = BENCH_MIN_KEY_LEN + xorshift(rng) % (BENCH_MAX_KEY_LEN - BENCH_MIN_KEY_LEN + 1);
+    int prefix = snprintf(key, len + 1, "https://cdn.example.com/assets/%zu/", idx);
+    for (size_t i = (size_t)prefix; i < len; i++)
+        key[i] = alphabet[xorshift(rng) % (sizeof(alphabet) - 1)];
+    key[len] = '\0';
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    size_t const keys = (1 < argc) ? strtoul(argv[1], (void*)0, 10) : BENCH_DEFAULT_KEYS;
+    if (0 == keys)
+        return ERR_INV_PARAM;
+
+    char* pool = malloc(keys * (BENCH_MAX_KEY_LEN + 1));
+    size_t* order = malloc(sizeof(size_t) * keys);
+    if (!pool || !order)
+        return ERR_NO_MEM;
+
+    u64 rng = 59;
+    for (size_t i = 0; i < keys; i++)
+    {
+        make_key(pool + i * (BENCH_MAX_KEY_LEN + 1), i, &rng);
+        order[i] = i;
+    }
+    for (size_t i = keys - 1; 0 < i; i--)
+    {
+        size_t const j = xorshift(&rng) % (i + 1);
+        size_t const tmp = order[i];
+        order[i] = order[j];
+        order[j] = tmp;
+    }
+
+    hash_map_59* map = (void*)0;
+    ERR_59_e err = init_copy_hash_map_59(&map, STR, U64_PTR, 0, 0, 0);
+    if (ERR_NONE != err)
+        return err;
+
+    double start = now_ns();
+    for (u64 i = 0; i < keys; i++)
+    {
+        err = upsert_into_hash_map_59(map, pool + i * (BENCH_MAX_KEY_LEN + 1), &i);
+        if (ERR_NONE != err)
+            return err;
+    }
+    double const upsert_ns = (now_ns() - start) / (double)keys;
+
+    u64 checksum = 0;
+    void* val = (void*)0;
+    start = now_ns();
+    for (size_t round = 0; round < BENCH_GET_ROUNDS; round++)
+    {
+        for (size_t i = 0; i < keys; i++)
+        {
+            err = get_from_hash_map_59(map, pool + order[i] * (BENCH_MAX_KEY_LEN + 1), &val);
+            if (ERR_NONE != err)
+                return err;
+            checksum += *(u64*)val - order[i];
+        }
+    }
+    double const get_ns = (now_ns() - start) / (double)(keys * BENCH_GET_ROUNDS);
+
+    // Chain lengths show how well the string hash spreads keys that share most of their bytes.
+    size_t longest = 0;
+    for (size_t b = 0; b < map->table_size; b++)
+    {
+        size_t chain = 0;
+        for (size_t link = map->table[b]; link; link = map->entries[link - 1].next)
+            chain++;
+        if (chain > longest)
+            longest = chain;
+    }
+
+    printf("keys: %zu, %d to %d bytes\n", keys, BENCH_MIN_KEY_LEN, BENCH_MAX_KEY_LEN);
+    printf("upsert:  %8.2f ns/key\n", upsert_ns);
+    printf("get:     %8.2f ns/key\n", get_ns);
+    printf("longest chain: %zu in %zu buckets\n", longest, map->table_size);
+    printf("checksum (expect 0): %lu\n", checksum);
+
+    deinit_hash_map_59(&map);
+    free(order);
+    free(pool);
+
+    return ERR_NONE;
+}
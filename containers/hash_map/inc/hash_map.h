@@ -44,8 +44,8 @@
 ========================================================================================================================
 */
 
+#include "bloom_filter.h"
 #include "containers_common.h"
-#include "llist.h"
 
 /*
 ========================================================================================================================
@@ -63,6 +63,32 @@
  **********************************************************************************************************************/
 #define DEFAULT_HASH_MAP_PRIME (11UL)
 
+/***********************************************************************************************************************
+ * @brief: Number of keys batched hash map calls hash and prefetch ahead of resolving them.
+ **********************************************************************************************************************/
+#define HASH_MAP_BATCH_SIZE 16
+
+/***********************************************************************************************************************
+ * @brief: Average number of entries per table bucket above which an insert doubles the table.
+ **********************************************************************************************************************/
+#define HASH_MAP_MAX_LOAD 1
+
+/***********************************************************************************************************************
+ * @brief: Number of entries held inline by a hash map, until it outgrows them the map has no table and is searched
+ * linearly.
+ **********************************************************************************************************************/
+#define HASH_MAP_SMALL_SIZE 8
+
+/***********************************************************************************************************************
+ * @brief: Default load, in entries per bucket as a percentage, below which a remove shrinks the table.
+ **********************************************************************************************************************/
+#define DEFAULT_HASH_MAP_MIN_LOAD_PERCENT 25
+
+/***********************************************************************************************************************
+ * @brief: Number of values a key of a multi map has room for when it is first inserted, the array doubles from there.
+ **********************************************************************************************************************/
+#define DEFAULT_HASH_MAP_VALS_CAPACITY 2
+
 /*
 ========================================================================================================================
 - - TYPEDEFS - -
@@ -71,6 +97,9 @@
 
 typedef struct hash_map_59 hash_map_59;
 typedef struct key_val_pair_59 key_val_pair_59;
+typedef struct hash_map_entry_59 hash_map_entry_59;
+typedef struct hash_map_iter_59 hash_map_iter_59;
+typedef struct hash_map_vals_59 hash_map_vals_59;
 
 /*
 ========================================================================================================================
@@ -84,35 +113,114 @@ typedef struct key_val_pair_59 key_val_pair_59;
  *
  * @key: Key to the values entry, will be unique in the hash map.
  * @val: Value to the key, is not unique in the hash map.
+ * @hash: Full width hash of the key, cached so that table resizes and chain probes never need to rehash the key.
  **********************************************************************************************************************/
 struct key_val_pair_59
 {
     void* key;
     void* val;
+    size_t hash;
+};
+
+/***********************************************************************************************************************
+ * @hash_map_entry_59
+ * @brief: A slot of the map's dense entry array, entries are appended in insertion order and chained into their table
+ * bucket by index.
+ *
+ * @pair: Key value pair of the entry, @pair.key is NULL once the entry has been removed.
+ * @next: Index + 1 of the next entry chained into the same table bucket, 0 ends the chain.
+ *
+ * @note For maps with @copy_in set the key bytes followed by the value bytes (aligned to u64) live in one allocation
+ * led by a @key_val_pair_59, @pair.key points just past it. Remove hands that allocation back as the returned pair,
+ * until then its @hash member holds the length of STR keys.
+ * For @multi maps the value bytes are a @hash_map_vals_59 and @pair.val points to it.
+ **********************************************************************************************************************/
+struct hash_map_entry_59
+{
+    key_val_pair_59 pair;
+    size_t next;
 };
 
 /***********************************************************************************************************************
  * @hash_map_59
- * @brief: A hash map built with llist_59 and llist_node_59, this hash map does not automatically resize its table.
+ * @brief: A hash map holding its entries in a dense, insertion ordered array with a table of bucket indexes into it.
+ * The table doubles once the map holds more than @HASH_MAP_MAX_LOAD entries per bucket. Small maps keep up to
+ * @HASH_MAP_SMALL_SIZE entries inline and are searched linearly by cached hash, the table is only allocated once
+ * they outgrow that.
  *
  * @key_type: Type of the key for the hash.
  * @val_type: Type of the val held at the hashed key.
- * @table: A pointer to pointer of llist_59(arr).
- * @table_size: Size of the hash table, call resize to grow or shrink the table.
+ * @entries: Dense array of entries in insertion order, removed entries stay behind as holes until it is compacted.
+ * @entries_used: Number of @entries slots in use, holes included.
+ * @entries_capacity: Number of slots allocated for @entries.
+ * @table: Array of @table_size buckets, each holds the index + 1 of the first entry chained into it or 0 when empty.
+ * NULL while the map is small.
+ * @table_size: Size of the hash table, call resize to grow or shrink the table. Small maps keep it for when their
+ * table is allocated.
+ * @size: Number of entries held by the map.
+ * @copy_in: When set keys and values are copied into the map's entries, otherwise the map takes ownership of the
+ * passed pointers.
+ * @multi: When set each key holds an array of values, upserts append to it. Set by @init_multi_hash_map_59.
+ * @min_load_percent: Load, in entries per bucket as a percentage, below which a remove shrinks the table, 0 never
+ * shrinks. Set with @set_min_load_hash_map_59.
+ * @filter: Counting bloom filter over the cached hashes of the entries, lookups of absent keys it rules out return
+ * before the table is touched. NULL until enabled with @enable_filter_hash_map_59.
  * @_prime: Prime number used in hashing.
+ * @_small: Inline entries, @entries points here until the map outgrows them.
  *
  * @note Default table size is @DEFAULT_HASH_MAP_TABLE_SIZE. Ideally you should not alter the @_prime member, default
  * value is 11.
+ * @note A map with a @val_type of VOID_0 is key only, its values are always NULL and never allocated.
+ * @note Resizing only rebuilds @table, entries are never moved or rehashed by it.
  **********************************************************************************************************************/
 struct hash_map_59
 {
     TYPE_59_e key_type;
     TYPE_59_e val_type;
     size_t val_type_depth;
-    llist_59** table;
+    hash_map_entry_59* entries;
+    size_t entries_used;
+    size_t entries_capacity;
+    size_t* table;
     size_t table_size;
+    size_t size;
+    bool copy_in;
+    bool multi;
+    size_t min_load_percent;
+    bloom_filter_59* filter;
     size_t _prime;
-    bool _collision_detected;
+    hash_map_entry_59 _small[HASH_MAP_SMALL_SIZE];
+};
+
+/***********************************************************************************************************************
+ * @hash_map_iter_59
+ * @brief: Cursor over the entries of a hash map in insertion order.
+ *
+ * @map: Map being iterated.
+ * @next: Index of the next @entries slot to visit.
+ **********************************************************************************************************************/
+struct hash_map_iter_59
+{
+    hash_map_59 const* map;
+    size_t next;
+};
+
+/***********************************************************************************************************************
+ * @hash_map_vals_59
+ * @brief: Values of a key in a multi map, held in insertion order in the same allocation as the key.
+ *
+ * @count: Number of values held.
+ * @capacity: Number of values there is room for before the allocation grows.
+ * @vals: @count values of the map's value size, back to back.
+ *
+ * @note Growing the array reallocates the key's allocation, pointers into it are only valid until the key is upserted
+ * again or a value is removed.
+ **********************************************************************************************************************/
+struct hash_map_vals_59
+{
+    size_t count;
+    size_t capacity;
+    u8 vals[];
 };
 
 /*
@@ -148,6 +256,59 @@ ERR_59_e init_hash_map_59(hash_map_59** map,
                           size_t const table_size,
                           size_t const _prime);
 
+/***********************************************************************************************************************
+ * @brief: Initializes a hash map with copy-in semantics, keys and values are copied into the map's single allocation
+ * entries instead of the map taking ownership of the passed pointers.
+ *
+ * @param[out] map: Pointer to a @hash_map_59 pointer to initialize the hash map in.
+ * @param[in] key_type: Type of the keys for the hash map, must be a fixed size type or STR.
+ * @param[in] val_type: Type of the vals for the hash map, must be a fixed size type, STR or VOID_0 for key only.
+ * @param[in] val_type_depth: Number of objects of @val_type in each value, 0 is treated as 1. Ignored for STR values.
+ * @param[in] table_size: Size of the table in the hash_map, if 0 then the default size of @DEFAULT_HASH_MAP_TABLE_SIZE
+ * is used.
+ * @param[in] prime: Prime number to be used in hashing, see @init_hash_map_59.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note The caller keeps ownership of the key and val passed to upsert. Vals returned by get point into the map and are
+ * valid until the key is upserted again or removed. A pair returned by remove holds its key and val inline, so only
+ * the pair itself is freed.
+ *
+ * @warning This will need to be freed with @deinit_hash_map_59 when its lifetime has expired.
+ **********************************************************************************************************************/
+ERR_59_e init_copy_hash_map_59(hash_map_59** map,
+                               TYPE_59_e const key_type,
+                               TYPE_59_e const val_type,
+                               size_t const val_type_depth,
+                               size_t const table_size,
+                               size_t const prime);
+
+/***********************************************************************************************************************
+ * @brief: Initializes a copy-in multi map, each key holds an array of values and upserting a key appends a copy of the
+ * value to it instead of replacing it.
+ *
+ * @param[out] map: Pointer to a @hash_map_59 pointer to initialize the hash map in.
+ * @param[in] key_type: Type of the keys for the hash map, must be a fixed size type or STR.
+ * @param[in] val_type: Type of the vals for the hash map, must be a fixed size type.
+ * @param[in] val_type_depth: Number of objects of @val_type in each value, 0 is treated as 1.
+ * @param[in] table_size: Size of the table in the hash_map, if 0 then the default size of @DEFAULT_HASH_MAP_TABLE_SIZE
+ * is used.
+ * @param[in] prime: Prime number to be used in hashing, see @init_hash_map_59.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Vals returned by get, get_or_insert and iteration are the key's @hash_map_vals_59, use
+ * @get_all_from_hash_map_59 for the values themselves. All other calls behave as for @init_copy_hash_map_59 maps.
+ *
+ * @warning This will need to be freed with @deinit_hash_map_59 when its lifetime has expired.
+ **********************************************************************************************************************/
+ERR_59_e init_multi_hash_map_59(hash_map_59** map,
+                                TYPE_59_e const key_type,
+                                TYPE_59_e const val_type,
+                                size_t const val_type_depth,
+                                size_t const table_size,
+                                size_t const prime);
+
 /***********************************************************************************************************************
  * @brief: Deallocates the passed hash map and all of its contents.
  *
@@ -164,7 +325,7 @@ ERR_59_e deinit_hash_map_59(hash_map_59** map);
  *
  * @param[in] map: Hash map to insert the new pair into.
  * @param[in] key: Key of the new entry.
- * @param[in] val: Value of the new entry.
+ * @param[in] val: Value of the new entry, may be NULL for key only maps.
  *
  * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
  *
@@ -183,6 +344,77 @@ ERR_59_e upsert_into_hash_map_59(hash_map_59* const map, void* key, void* val);
  **********************************************************************************************************************/
 ERR_59_e get_from_hash_map_59(hash_map_59* const map, void* key, void** val);
 
+/***********************************************************************************************************************
+ * @brief: Finds the value slot for the passed key in a single probe, inserting @default_val first when the key is not
+ * present. The slot is the same pointer get returns, so a value can be read, modified and written back in place
+ * without a second lookup, ie. counting with ++(*(u64*)slot).
+ *
+ * @param[in] map: Hash map to find or insert the key in.
+ * @param[in] key: Key to find or insert.
+ * @param[in] default_val: Value inserted when @key is absent. For @copy_in maps it is copied, and NULL zeroes fixed
+ * size values. For other maps it must not be NULL and the map takes ownership of it only when it is inserted.
+ * @param[out] val_slot: Pointer to place the value slot of the key in.
+ * @param[out] inserted: Set true when @key was inserted, false when it was already present, may be NULL.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note For maps without @copy_in the map takes ownership of @key only when it is inserted, check @inserted.
+ * @note The slot stays valid until the key is removed or upserted again.
+ **********************************************************************************************************************/
+ERR_59_e
+get_or_insert_hash_map_59(hash_map_59* const map, void* key, void* default_val, void** val_slot, bool* inserted);
+
+/***********************************************************************************************************************
+ * @brief: Gets the values for a batch of keys. Keys are hashed and their table buckets prefetched
+ * @HASH_MAP_BATCH_SIZE at a time before being resolved, which overlaps the memory latency of the lookups.
+ *
+ * @param[in] map: Hash map to get the values from.
+ * @param[in] keys: Array of @count keys to match to values.
+ * @param[in] count: Number of keys in @keys.
+ * @param[out] vals: Array of @count void pointers, each is set to the value of its key or NULL if not found.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Missing keys are not an error, check @vals for NULL.
+ **********************************************************************************************************************/
+ERR_59_e get_many_from_hash_map_59(hash_map_59* const map, void* const* keys, size_t const count, void** vals);
+
+/***********************************************************************************************************************
+ * @brief: Inserts or updates a batch of key and value pairs, prefetching the table buckets ahead of each insert in the
+ * same way as @get_many_from_hash_map_59.
+ *
+ * @param[in] map: Hash map to insert the pairs into.
+ * @param[in] keys: Array of @count keys.
+ * @param[in] vals: Array of @count vals, @vals[i] is the value for @keys[i].
+ * @param[in] count: Number of pairs to upsert.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Ownership follows @upsert_into_hash_map_59. On error the pairs before the failing one have been upserted.
+ **********************************************************************************************************************/
+ERR_59_e upsert_many_into_hash_map_59(hash_map_59* const map, void* const* keys, void* const* vals, size_t const count);
+
+/***********************************************************************************************************************
+ * @brief: Builds an empty map from a bulk array of key and value pairs across @threads threads. Keys are hashed and
+ * partitioned by hash into one shard per thread, each shard owning a disjoint set of table buckets, so the shards are
+ * built in parallel without locks straight into the map's single table and entries array.
+ *
+ * @param[in] map: Empty hash map to build, from any of the init functions.
+ * @param[in] keys: Array of @count keys.
+ * @param[in] vals: Array of @count vals, @vals[i] is the value for @keys[i].
+ * @param[in] count: Number of pairs to build the map from.
+ * @param[in] threads: Number of threads to build with, including the calling thread. Rounded down to a power of two.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Repeated keys behave as repeated upserts in input order. The map is sized for @count up front and its
+ * iteration order follows the shards, not the input. Maps that are not empty, small batches and a single thread fall
+ * back to @upsert_many_into_hash_map_59.
+ * @note Ownership follows @upsert_into_hash_map_59. On error the map holds the pairs the shards had built so far.
+ **********************************************************************************************************************/
+ERR_59_e build_hash_map_59(
+    hash_map_59* const map, void* const* keys, void* const* vals, size_t const count, size_t const threads);
+
 /***********************************************************************************************************************
  * @brief: Removes the @key_val_pair_59 that has the matching key from the hash map.
  *
@@ -192,10 +424,56 @@ ERR_59_e get_from_hash_map_59(hash_map_59* const map, void* key, void** val);
  *
  * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
  *
- * @warning This DOES NOT deallocate the pair, this will need to be freed after use.
+ * @note Once the load drops below @min_load_percent the table shrinks to fit. Only the table is rebuilt, so removing
+ * while iterating stays safe, call @compact_hash_map_59 to also give back the space of removed entries.
+ *
+ * @warning This DOES NOT deallocate the pair, this will need to be freed after use. For maps with @copy_in set the key
+ * and val live inside the pair's allocation and must not be freed separately.
  **********************************************************************************************************************/
 ERR_59_e remove_from_hash_map_59(hash_map_59* const map, void* const key, key_val_pair_59** pair);
 
+/***********************************************************************************************************************
+ * @brief: Gets every value held for the passed key, as a view into the map.
+ *
+ * @param[in] map: Hash map to get the values from.
+ * @param[in] key: Key to match to the values.
+ * @param[out] vals: Pointer to place the first value in, the rest follow it at the map's value size.
+ * @param[out] count: Pointer to place the number of values in.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Maps that are not @multi hold a single value per key, it is returned with a @count of 1.
+ **********************************************************************************************************************/
+ERR_59_e get_all_from_hash_map_59(hash_map_59* const map, void* key, void** vals, size_t* count);
+
+/***********************************************************************************************************************
+ * @brief: Removes the first value equal to @val from the values of a key in a multi map, keeping the order of the rest.
+ * The key is removed along with its last value.
+ *
+ * @param[in] map: Multi map to remove the value from.
+ * @param[in] key: Key holding the value.
+ * @param[in] val: Value to remove, matched by its bytes.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note ERR_OBJ_NOT_FOUND is returned when either the key or the value is absent, ERR_NOT_SUPPORTED for maps that are
+ * not @multi.
+ **********************************************************************************************************************/
+ERR_59_e remove_one_from_hash_map_59(hash_map_59* const map, void* const key, void const* const val);
+
+/***********************************************************************************************************************
+ * @brief: Removes the key and all of its values from the hash map, freeing them.
+ *
+ * @param[in] map: Hash map to remove the key from.
+ * @param[in] key: Key to remove.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Unlike @remove_from_hash_map_59 nothing is handed back, for maps without @copy_in the key and val the map took
+ * ownership of are freed too.
+ **********************************************************************************************************************/
+ERR_59_e remove_all_from_hash_map_59(hash_map_59* const map, void* const key);
+
 /***********************************************************************************************************************
  * @brief: Resizes the hash table to prevent collisions or reduce it size due to sparseness.
  *
@@ -203,5 +481,99 @@ ERR_59_e remove_from_hash_map_59(hash_map_59* const map, void* const key, key_va
  * @param[in] new_size: New size to use for the hash map table.
  *
  * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Only the bucket indexes are rebuilt from the cached hashes, entries keep their place and insertion order.
+ * Small maps without a table only record @new_size for when their table is allocated.
  **********************************************************************************************************************/
 ERR_59_e resize_table_hash_map_59(hash_map_59* map, size_t const new_size);
+
+/***********************************************************************************************************************
+ * @brief: Sets the load below which removing from the hash map shrinks its table.
+ *
+ * @param[in] map: Hash map to configure.
+ * @param[in] min_load_percent: Load in entries per bucket as a percentage, 0 never shrinks. Must be below half of
+ * @HASH_MAP_MAX_LOAD so a table that just doubled is not shrunk straight back.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note New maps use @DEFAULT_HASH_MAP_MIN_LOAD_PERCENT.
+ **********************************************************************************************************************/
+ERR_59_e set_min_load_hash_map_59(hash_map_59* const map, size_t const min_load_percent);
+
+/***********************************************************************************************************************
+ * @brief: Rebuilds the hash map right-sized in one pass, the holes left by removed entries are squeezed out in
+ * insertion order, the entries array is trimmed to the map's size and the table is sized for it. Maps of
+ * @HASH_MAP_SMALL_SIZE entries or fewer move back inline and free their table.
+ *
+ * @param[in] map: Hash map to compact.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @warning Entries move, restart any iteration over the map after compacting it.
+ **********************************************************************************************************************/
+ERR_59_e compact_hash_map_59(hash_map_59* const map);
+
+/***********************************************************************************************************************
+ * @brief: Initializes an iterator over the entries of the passed hash map, entries are visited in insertion order.
+ *
+ * @param[in] map: Hash map to iterate.
+ * @param[out] iter: Iterator to initialize.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Removing entries while iterating is safe, the removed entries are skipped. Inserting while iterating may
+ * compact the entries, restart the iteration after inserting.
+ **********************************************************************************************************************/
+ERR_59_e init_iter_hash_map_59(hash_map_59 const* const map, hash_map_iter_59* iter);
+
+/***********************************************************************************************************************
+ * @brief: Advances the iterator to the next entry of its map.
+ *
+ * @param[in] iter: Iterator initialized with @init_iter_hash_map_59.
+ * @param[out] pair: Pointer to place the next pair in, set to NULL once the iterator is exhausted.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Returns ERR_CONTAINER_EMPTY once every entry has been visited.
+ * @warning The pair belongs to the map, do not free it or modify its key.
+ **********************************************************************************************************************/
+ERR_59_e next_iter_hash_map_59(hash_map_iter_59* const iter, key_val_pair_59 const** pair);
+
+/***********************************************************************************************************************
+ * @brief: Calls @fn with the key and value of every entry in the hash map in insertion order.
+ *
+ * @param[in] map: Hash map to walk.
+ * @param[in] fn: Function called for each entry, returning anything other than ERR_NONE stops the walk.
+ * @param[in] ctx: Caller context passed through to @fn, may be NULL.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note The error returned by @fn is passed back unchanged. @fn may remove the entry it was called with.
+ **********************************************************************************************************************/
+ERR_59_e foreach_hash_map_59(hash_map_59* const map, ERR_59_e (*fn)(void* key, void* val, void* ctx), void* ctx);
+
+/***********************************************************************************************************************
+ * @brief: Fronts the hash map with a counting bloom filter so lookups of absent keys are mostly turned away without
+ * walking a chain or comparing keys. The filter is kept in step by inserts and removes.
+ *
+ * @param[in] map: Hash map to filter.
+ * @param[in] counters_per_key: Filter counters per entry, 0 for @DEFAULT_BLOOM_FILTER_COUNTERS_PER_KEY.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Enabling an already filtered map rebuilds its filter with the new @counters_per_key. The filter is sized for
+ * twice the map's size and rebuilt from the cached hashes at twice the size whenever the map outgrows it.
+ * @note Keys whose hashes collide still pass the filter, it only pays off when hashes are well spread.
+ * @note Every lookup pays for one extra cache line in the filter. Entries cache their full hash, so a miss without the
+ * filter is already only a bucket and a short chain, enable it only when absent keys dominate and chains are long.
+ **********************************************************************************************************************/
+ERR_59_e enable_filter_hash_map_59(hash_map_59* const map, size_t const counters_per_key);
+
+/***********************************************************************************************************************
+ * @brief: Removes and frees the hash map's bloom filter.
+ *
+ * @param[in] map: Hash map to stop filtering.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e disable_filter_hash_map_59(hash_map_59* const map);
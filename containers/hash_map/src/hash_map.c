@@ -35,7 +35,11 @@
 
 #include <float.h>
 #include <math.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+#include <threads.h>
 
 /*
 ========================================================================================================================
@@ -45,6 +49,97 @@
 
 #include "hash_map.h"
 
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Alignment of the value bytes within the key and value allocation of a @copy_in entry.
+ **********************************************************************************************************************/
+#define HASH_MAP_ENTRY_DATA_ALIGN (sizeof(u64))
+
+/***********************************************************************************************************************
+ * @brief: Upper bound on the workers of a bulk build.
+ **********************************************************************************************************************/
+#define HASH_MAP_BUILD_MAX_THREADS 64
+
+/***********************************************************************************************************************
+ * @brief: Hints the cpu to pull the passed address into cache, compiles to nothing when unsupported.
+ **********************************************************************************************************************/
+#if defined(__GNUC__) || defined(__clang__)
+#define HASH_MAP_PREFETCH(addr) __builtin_prefetch((addr))
+#else
+#define HASH_MAP_PREFETCH(addr) ((void)(addr))
+#endif
+
+/*
+========================================================================================================================
+- - TYPEDEFS - -
+========================================================================================================================
+*/
+
+typedef struct hash_map_build_59 hash_map_build_59;
+typedef struct hash_map_build_worker_59 hash_map_build_worker_59;
+
+/*
+========================================================================================================================
+- - STRUCTS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @hash_map_build_59
+ * @brief: State shared by the workers of a bulk build. Shard @s owns every table bucket @b with b % @shards == s, and
+ * the entries @shard_starts[s] up to @shard_starts[s + 1], so workers never touch each other's buckets or entries.
+ *
+ * @map: Map being built, its table is sized so @shards divides it.
+ * @keys: Keys passed to the build.
+ * @vals: Vals passed to the build.
+ * @count: Number of keys and vals.
+ * @hashes: Full width hash of every key.
+ * @key_lens: Length of every key for STR keys, otherwise NULL.
+ * @order: Indexes of the keys grouped by shard, in input order within a shard.
+ * @shard_starts: @shards + 1 offsets into @order where each shard's indexes start.
+ * @shards: Number of shards and workers, a power of two.
+ * @cursors: @shards cursors for every worker, see @hash_map_build_worker_59.
+ **********************************************************************************************************************/
+struct hash_map_build_59
+{
+    hash_map_59* map;
+    void* const* keys;
+    void* const* vals;
+    size_t count;
+    size_t* hashes;
+    size_t* key_lens;
+    size_t* order;
+    size_t* shard_starts;
+    size_t shards;
+    size_t* cursors;
+};
+
+/***********************************************************************************************************************
+ * @hash_map_build_worker_59
+ * @brief: One worker of a bulk build, it hashes and partitions one slice of the input then builds one shard.
+ *
+ * @build: Build the worker belongs to.
+ * @thread: Thread running the worker, unused by the worker run on the calling thread.
+ * @idx: Index of the worker, both its slice of the input and its shard.
+ * @cursors: Per shard count of the slice's keys, then the next @order slot to scatter each shard's keys into.
+ * @size: Number of entries the worker created.
+ * @err: Error the worker stopped on, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+struct hash_map_build_worker_59
+{
+    hash_map_build_59* build;
+    thrd_t thread;
+    size_t idx;
+    size_t* cursors;
+    size_t size;
+    ERR_59_e err;
+};
+
 /*
 ========================================================================================================================
 - - INTERNAL FUNCTIONS - -
@@ -52,182 +147,217 @@
 */
 
 /***********************************************************************************************************************
- * @brief: Deinits a linked list node held by the hash map table, this includes the void pointer to the node obj and
- * the key value pairs.
+ * @brief: Frees what the map owns for an entry, the key and value allocation for @copy_in maps, otherwise the key and
+ * val pointers handed to the map.
  *
- * @param[in] node: Node to deinit.
+ * @param[in] map: Map the entry belongs to.
+ * @param[in] entry: Entry to free, its pair is cleared on return.
  *
  * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
  **********************************************************************************************************************/
-static ERR_59_e _deinit_table_node_hash_map_59(llist_node_59** node)
+static ERR_59_e _free_entry_hash_map_59(hash_map_59 const* const map, hash_map_entry_59* const entry)
 {
-    if (!node || !(*node))
+    if (!map || !entry || !entry->pair.key)
         return ERR_INV_PARAM;
 
-    if ((*node)->node_obj)
+    if (map->copy_in)
+        free((key_val_pair_59*)entry->pair.key - 1); // The key bytes follow the pair leading the allocation.
+    else
     {
-        key_val_pair_59* pair = (key_val_pair_59*)((*node)->node_obj);
-        if (pair->key)
-        {
-            free(pair->key);
-            pair->key = (void*)0;
-        }
-        if (pair->val)
-        {
-            free(pair->val);
-            pair->val = (void*)0;
-        }
-        free((*node)->node_obj);
+        free(entry->pair.key);
+        free(entry->pair.val);
     }
-
-    (*node)->node_obj = (void*)0;
-    (*node)->next = (void*)0;
-    free((*node));
-    (*node) = (void*)0;
+    entry->pair.key = (void*)0;
+    entry->pair.val = (void*)0;
 
     return ERR_NONE;
 }
 
 /***********************************************************************************************************************
- * @brief: This function deallocates the memory for hash map table lists used by the hash_map. This is needed because
- * the node objects point to two other pointers which have been allocated an need to be freed.
+ * @brief: Checks a key against the key of an entry whose cached hash already matched. STR keys of @copy_in maps
+ * compare their lengths first and then their bytes with @equal_bytes_59, the rest go through @compare_node_obj_59.
  *
- * @param[out] llist: Pointer to a linked list that needs to be freed.
+ * @param[in] map: Map the entry belongs to.
+ * @param[in] key: Key to match.
+ * @param[in] key_len: Length of @key without its terminator when it is a STR.
+ * @param[in] entry_key: Key of the entry.
+ * @param[out] match: Set when the keys are equal.
  *
  * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
  **********************************************************************************************************************/
-static ERR_59_e _deinit_table_list_hash_map_59(llist_59** llist)
+static ERR_59_e _match_key_hash_map_59(
+    hash_map_59 const* const map, void const* const key, size_t const key_len, void const* const entry_key, bool* match)
 {
-    if (!llist || !(*llist))
-        return ERR_INV_PARAM;
-
-    llist_node_59* node = (*llist)->head;
-    llist_node_59* next_node = (void*)0;
-    while (node)
+    if (STR == map->key_type && map->copy_in)
     {
-        next_node = node->next;
-
-        ERR_59_e err = _deinit_table_node_hash_map_59(&node);
-        if (err != ERR_NONE)
-            return err;
-
-        node = next_node;
+        // The spare pair leading the allocation holds the key's length until remove hands it back.
+        size_t const entry_len = ((key_val_pair_59 const*)entry_key - 1)->hash;
+        *match = false;
+        if (entry_len != key_len)
+            return ERR_NONE;
+        return equal_bytes_59(key, entry_key, key_len, match);
     }
 
-    (*llist)->head = (void*)0;
-    (*llist)->tail = (void*)0;
-    (*llist)->type = VOID_0;
-    (*llist)->type_depth = 0;
-    free((*llist));
-    (*llist) = (void*)0;
+    i64 dif = 0;
+    ERR_59_e err = compare_node_obj_59(map->key_type, key, entry_key, &dif);
+    if (ERR_NONE != err)
+        return err;
+    *match = (0 == dif);
 
     return ERR_NONE;
 }
 
 /***********************************************************************************************************************
- * @brief: Finds the matching linked list node in the passed linked list
+ * @brief: Finds the entry matching the passed key, by walking its table bucket chain or, for small maps without a
+ * table, by scanning the inline entries.
  *
- * @param[in] llist: Linked list t search for the node in.
- * @param[in] key: Key to match the node against, this matches the memory address not the value.
- * @param[out] node: Pointer to linked list node to return the matched node in.
+ * @param[in] map: Map to search, used for its key type.
+ * @param[in] key: Key to match the entry against, this matches the value not the memory address.
+ * @param[in] hash: Full width hash of @key, entries with a different cached hash are skipped without comparing keys.
+ * @param[in] key_len: Length of STR keys without their terminator, as given by @_hash_key_internal_hash_map_59.
+ * @param[out] idx: Pointer to place the index of the matched entry in.
+ * @param[out] link: Pointer to place the link referencing the matched entry in, either its table bucket or the @next
+ * member of the entry before it in the chain. Set to NULL for small maps, may be NULL.
  *
  * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
  **********************************************************************************************************************/
-static ERR_59_e _find_node_in_table_list_hash_map_59(hash_map_59* const map,
-                                                     llist_59 const* const llist,
-                                                     void const* const key,
-                                                     llist_node_59** node)
+static ERR_59_e _find_entry_hash_map_59(hash_map_59 const* const map,
+                                        void const* const key,
+                                        size_t const hash,
+                                        size_t const key_len,
+                                        size_t* idx,
+                                        size_t** link)
 {
-    if (!llist || !key || !node)
+    if (!map || !key || !idx)
         return ERR_INV_PARAM;
 
-    llist_node_59* search_node = llist->head;
-    i64 dif = 0;
+    hash_map_entry_59* entry = (void*)0;
+    bool match = false;
     ERR_59_e err = ERR_NONE;
-    while (search_node)
+    if (map->filter)
     {
-        err = compare_node_obj_59(map->key_type, key, ((key_val_pair_59*)search_node->node_obj)->key, &dif);
+        bool maybe_present = true;
+        err = query_bloom_filter_59(map->filter, hash, &maybe_present);
         if (ERR_NONE != err)
             return err;
+        if (!maybe_present)
+            return ERR_OBJ_NOT_FOUND;
+    }
 
-        if (0 == dif)
+    if (!map->table)
+    {
+        for (size_t i = 0; i < map->entries_used; i++)
         {
-            *node = search_node;
-            break;
+            entry = &map->entries[i];
+            if (!entry->pair.key || entry->pair.hash != hash)
+                continue;
+
+            err = _match_key_hash_map_59(map, key, key_len, entry->pair.key, &match);
+            if (ERR_NONE != err)
+                return err;
+
+            if (match)
+            {
+                *idx = i;
+                if (link)
+                    *link = (void*)0;
+                return ERR_NONE;
+            }
         }
-        search_node = search_node->next;
-        map->_collision_detected = true; // More than one node in the llist = collision.
-    }
 
-    if (!(*node))
         return ERR_OBJ_NOT_FOUND;
+    }
 
-    return ERR_NONE;
+    size_t* search_link = &map->table[hash % map->table_size];
+    while (*search_link)
+    {
+        entry = &map->entries[*search_link - 1];
+        if (entry->pair.hash == hash)
+        {
+            err = _match_key_hash_map_59(map, key, key_len, entry->pair.key, &match);
+            if (ERR_NONE != err)
+                return err;
+
+            if (match)
+            {
+                *idx = *search_link - 1;
+                if (link)
+                    *link = search_link;
+                return ERR_NONE;
+            }
+        }
+        search_link = &entry->next;
+    }
+
+    return ERR_OBJ_NOT_FOUND;
 }
 
 /***********************************************************************************************************************
- * @brief: Hashes the passed @key based on the passed @map @table_size member.
+ * @brief: Hashes the passed @key into a full width hash, the hash is independent of the @map @table_size member and
+ * must be reduced with a modulus of the table size to find the bucket.
  *
  * @param[in] map: Map to hash the key for.
  * @param[in] key: Key to hash for the map.
  * @param[out] hash: Value to place the hash in.
+ * @param[out] key_len: Value to place the length of STR keys in, without the terminator, so later compares need not
+ * scan for it again. Set to 0 for other key types.
  *
  * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
  *
  * @warning This function assumes that passed strings are null terminated.
  **********************************************************************************************************************/
-static ERR_59_e _hash_key_internal_hash_map_59(hash_map_59 const* const map, void* key, size_t* hash)
+static ERR_59_e _hash_key_internal_hash_map_59(hash_map_59 const* const map, void* key, size_t* hash, size_t* key_len)
 {
-    if (!map || !key || !hash)
+    if (!map || !key || !hash || !key_len)
         return ERR_INV_PARAM;
 
+    *key_len = 0;
+
     switch (map->key_type)
     {
     case U8_PTR:
-        *hash = (*(u8*)key) % map->table_size;
+        *hash = (*(u8*)key);
         break;
 
     case U16_PTR:
-        *hash = (*(u16*)key) % map->table_size;
+        *hash = (*(u16*)key);
         break;
 
     case U32_PTR:
-        *hash = (*(u32*)key) % map->table_size;
+        *hash = (*(u32*)key);
         break;
 
     case U64_PTR:
-        *hash = (*(u64*)key) % map->table_size;
+        *hash = (size_t)(*(u64*)key);
         break;
 
     case I8_PTR:
-        *hash = ((size_t)*(i8*)key) % map->table_size;
+        *hash = (size_t)*(i8*)key;
         break;
 
     case I16_PTR:
-        *hash = ((size_t)*(i16*)key) % map->table_size;
+        *hash = (size_t)*(i16*)key;
         break;
 
     case I32_PTR:
-        *hash = ((size_t)*(i32*)key) % map->table_size;
+        *hash = (size_t)*(i32*)key;
         break;
 
     case I64_PTR:
-        *hash = ((size_t)*(i64*)key) % map->table_size;
+        *hash = (size_t)*(i64*)key;
         break;
 
     case CHAR_PTR:
-        *hash = ((size_t)*(unsigned char*)key) % map->table_size;
+        *hash = (size_t)*(unsigned char*)key;
         break;
 
-    case STR: // Assumes null termination
-        ;     // Null statement -> so pedantic
-        str s = (str)key;
-        while (*s)
-        {
-            *hash = *hash + ((unsigned char)*s);
-            s++;
-        }
-        *hash = (*hash + map->_prime) % map->table_size;
+    case STR:; // Assumes null termination. Pedantic null statement. ':' then ';'
+        u64 str_hash = 0;
+        *key_len = strlen((char const*)key);
+        ERR_59_e err = hash_bytes_59(key, *key_len, map->_prime, &str_hash);
+        if (ERR_NONE != err)
+            return err;
+        *hash = (size_t)str_hash;
         break;
 
     default:
@@ -238,310 +368,1400 @@ static ERR_59_e _hash_key_internal_hash_map_59(hash_map_59 const* const map, voi
 }
 
 /***********************************************************************************************************************
- * @brief: Checks if the passed unsigned value is a prime number.
+ * @brief: Gets the number of bytes a copy-in map must store for the passed key or val object.
  *
- * @param[in] prime: Number to check which must be equal to or greater than 3.
- * @param[out] is_prime: Pointer to store the bool out value.
+ * @param[in] type: Type of the object.
+ * @param[in] type_depth: Number of objects of @type held, 0 is treated as 1. Ignored for STR.
+ * @param[in] obj: Object to size, only read for STR.
+ * @param[out] size: Value to place the size in.
  *
  * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
- *
- * @note Use of smaller numbers equates to more performance.
  **********************************************************************************************************************/
-static ERR_59_e _check_is_prime_internal_hash_map_59(size_t const prime, bool* is_prime)
+static ERR_59_e
+_get_obj_size_hash_map_59(TYPE_59_e const type, size_t const type_depth, void const* const obj, size_t* size)
 {
-    if (!is_prime || 3 > prime || DBL_MAX < prime)
+    if (!size || (STR == type && !obj))
         return ERR_INV_PARAM;
 
-    size_t test = 3;
-    *is_prime = true;
-    while (test < sqrt((double)prime) && true == *is_prime)
+    if (VOID_0 == type) // Key only maps have no value bytes.
     {
-        if (test == prime)
-            break;
+        *size = 0;
+        return ERR_NONE;
+    }
 
-        if (0 == prime % test)
-            *is_prime = false;
-        test++;
+    if (STR == type)
+    {
+        *size = strlen((char const*)obj) + 1;
+        return ERR_NONE;
     }
 
+    ERR_59_e err = get_type_size_59(type, size);
+    if (ERR_NONE != err)
+        return err;
+
+    if (1 < type_depth)
+        *size *= type_depth;
+
     return ERR_NONE;
 }
 
-/*
-========================================================================================================================
-- - FUNCTION DEFINITIONS - -
-========================================================================================================================
-*/
-
-ERR_59_e init_hash_map_59(hash_map_59** map,
-                          TYPE_59_e const key_type,
-                          TYPE_59_e const val_type,
-                          size_t const val_type_depth,
-                          size_t const table_size,
-                          size_t const prime)
+/***********************************************************************************************************************
+ * @brief: Fills in the pair of a new entry, for @copy_in maps the key and val bytes are copied into a single allocation
+ * led by a spare @key_val_pair_59 that remove hands back to the caller.
+ *
+ * @param[in] map: Map to create the entry for.
+ * @param[in] key: Key of the entry.
+ * @param[in] val: Val of the entry, for @copy_in maps with fixed size values NULL zeroes the value bytes.
+ * @param[in] hash: Full width hash of @key.
+ * @param[out] pair: Pair to fill in.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _init_pair_hash_map_59(
+    hash_map_59 const* const map, void* key, void* val, size_t const hash, key_val_pair_59* const pair)
 {
-    if (!map)
+    if (!map || !key || (!val && !map->copy_in && VOID_0 != map->val_type) || !pair)
         return ERR_INV_PARAM;
 
-    ERR_59_e err = ERR_NONE;
-
-    hash_map_59* new_map = malloc(sizeof(hash_map_59));
-    if (!new_map)
-        return ERR_NO_MEM;
-
-    if (0 != prime)
+    pair->hash = hash;
+    if (!map->copy_in)
     {
-        bool is_prime = true;
-        err = _check_is_prime_internal_hash_map_59(prime, &is_prime);
-        if (ERR_NONE != err || !is_prime)
-        {
-            free(new_map);
-            return err;
-        }
-        else
-            new_map->_prime = prime;
+        pair->key = key;
+        pair->val = val;
+        return ERR_NONE;
     }
-    else
-        new_map->_prime = DEFAULT_HASH_MAP_PRIME;
 
-    if (0 != table_size)
-        new_map->table_size = table_size;
-    else
-        new_map->table_size = DEFAULT_HASH_MAP_TABLE_SIZE;
+    size_t key_size = 0;
+    size_t val_size = 0;
+    ERR_59_e err = _get_obj_size_hash_map_59(map->key_type, 0, key, &key_size);
+    if (ERR_NONE != err)
+        return err;
+    err = _get_obj_size_hash_map_59(map->val_type, map->val_type_depth, val, &val_size);
+    if (ERR_NONE != err)
+        return err;
+    size_t const val_offset = (key_size + HASH_MAP_ENTRY_DATA_ALIGN - 1) & ~(HASH_MAP_ENTRY_DATA_ALIGN - 1);
+    size_t const vals_size =
+        map->multi ? sizeof(hash_map_vals_59) + DEFAULT_HASH_MAP_VALS_CAPACITY * val_size : val_size;
 
-    llist_59** new_table = malloc(sizeof(llist_59*) * new_map->table_size);
-    if (!new_table)
-    {
-        free(new_map);
+    key_val_pair_59* block = malloc(sizeof(key_val_pair_59) + val_offset + vals_size);
+    if (!block)
         return ERR_NO_MEM;
-    }
-    else
+
+    // Until remove hands it back the spare pair holds the length of STR keys, so compares skip scanning for the end.
+    block->hash = (STR == map->key_type) ? key_size - 1 : 0;
+    u8* data = (u8*)(block + 1);
+    memcpy(data, key, key_size);
+    pair->key = data;
+    pair->val = data + val_offset;
+
+    u8* val_data = data + val_offset;
+    if (map->multi)
     {
-        for (size_t i = 0; i < new_map->table_size; i++)
-        {
-            llist_59* llist = (void*)0;
-            err = init_llist_59(&llist, val_type, val_type_depth);
-            if (ERR_NONE != err)
-            {
-                for (size_t j = 0; j < i; j++)
-                    free(new_table[j]);
-                free(new_table);
-                free(new_map);
-                return err;
-            }
-            else
-                new_table[i] = llist;
-        }
+        hash_map_vals_59* vals = pair->val;
+        vals->count = 1;
+        vals->capacity = DEFAULT_HASH_MAP_VALS_CAPACITY;
+        val_data = vals->vals;
     }
 
-    new_map->key_type = key_type;
-    new_map->val_type = val_type;
-    new_map->val_type_depth = val_type_depth;
-    new_map->table = new_table;
-    new_map->_collision_detected = false;
-
-    *map = new_map;
+    if (val && 0 != val_size)
+        memcpy(val_data, val, val_size);
+    else if (0 != val_size)
+        memset(val_data, 0, val_size);
 
     return ERR_NONE;
 }
 
-ERR_59_e deinit_hash_map_59(hash_map_59** map)
+/***********************************************************************************************************************
+ * @brief: Replaces the value of an existing entry in a @copy_in map. Fixed size values are overwritten in place,
+ * strings are copied into a new key and value allocation that replaces the old one.
+ *
+ * @param[in] map: Map holding the entry.
+ * @param[in] entry: Entry to update.
+ * @param[in] val: New value to copy into the entry.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _replace_copy_val_hash_map_59(hash_map_59 const* const map, hash_map_entry_59* const entry, void* val)
 {
-    if (!map || !(*map))
-        return ERR_INV_PARAM;
-
-    ERR_59_e err = ERR_NONE;
+    size_t val_size = 0;
+    ERR_59_e err = _get_obj_size_hash_map_59(map->val_type, map->val_type_depth, val, &val_size);
+    if (ERR_NONE != err)
+        return err;
 
-    for (size_t i = 0; i < (*map)->table_size; i++)
+    if (STR != map->val_type)
     {
-        err = _deinit_table_list_hash_map_59(&(*map)->table[i]);
-        if (ERR_NONE != err)
-            return err;
+        if (val && 0 != val_size)
+            memcpy(entry->pair.val, val, val_size);
+        return ERR_NONE;
     }
 
-    free((*map)->table);
-    free((*map));
-    *map = (void*)0;
+    // Built from the old key before it is freed, @val may point into the old allocation.
+    key_val_pair_59 new_pair = {0};
+    err = _init_pair_hash_map_59(map, entry->pair.key, val, entry->pair.hash, &new_pair);
+    if (ERR_NONE != err)
+        return err;
+
+    free((key_val_pair_59*)entry->pair.key - 1);
+    entry->pair = new_pair;
 
     return ERR_NONE;
 }
 
-ERR_59_e upsert_into_hash_map_59(hash_map_59* const map, void* key, void* val)
+/***********************************************************************************************************************
+ * @brief: Appends a copy of the value to the values of an existing entry in a @multi map, doubling the capacity of
+ * the key's allocation when it is full.
+ *
+ * @param[in] map: Multi map holding the entry.
+ * @param[in] entry: Entry to append to.
+ * @param[in] val: Value to copy in, NULL appends a zeroed value.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _append_val_hash_map_59(hash_map_59 const* const map, hash_map_entry_59* const entry, void* val)
 {
-    if (!map || !key || !val)
-        return ERR_INV_PARAM;
-
-    ERR_59_e err = ERR_NONE;
-    size_t hash = 0;
-    err = _hash_key_internal_hash_map_59(map, key, &hash);
+    size_t val_size = 0;
+    ERR_59_e err = _get_obj_size_hash_map_59(map->val_type, map->val_type_depth, val, &val_size);
     if (ERR_NONE != err)
         return err;
 
-    llist_59* table_list = map->table[hash];
-    key_val_pair_59* pair = (void*)0;
-    llist_node_59* node = (void*)0;
-    _find_node_in_table_list_hash_map_59(map, table_list, key, &node);
-    if (!node)
+    hash_map_vals_59* vals = entry->pair.val;
+    if (vals->count == vals->capacity)
     {
-        pair = malloc(sizeof(key_val_pair_59));
-        if (!pair)
+        if (SIZE_MAX / 4 / val_size < vals->capacity)
             return ERR_NO_MEM;
 
-        pair->key = key;
-        pair->val = val;
-        err = init_llist_node_59(&node, (void*)0, (void*)pair);
-        if (ERR_NONE != err)
-        {
-            free(pair);
-            return err;
-        }
-
-        err = push_back_llist_59(table_list, node);
-        if (ERR_NONE != err)
-        {
-            free(pair);
-            free(node);
-            return err;
-        }
+        u8* old_block = (u8*)((key_val_pair_59*)entry->pair.key - 1);
+        size_t const vals_offset = (size_t)((u8*)vals - old_block);
+        size_t const old_size = vals_offset + sizeof(hash_map_vals_59) + vals->capacity * val_size;
+        size_t const capacity = vals->capacity << 1;
 
-        // If new size is less than the current size we have overflowed and our hash map table size is maxed.
-        size_t new_size = map->table_size << 1;
-        if (new_size > map->table_size && map->_collision_detected)
-        {
+        // A value taken from this key's own array moves with it, so it is found again by its offset.
+        bool const aliased = val && (u8*)val >= old_block && (u8*)val < old_block + old_size;
+        size_t const val_at = aliased ? (size_t)((u8*)val - old_block) : 0;
 
-            err = resize_table_hash_map_59(map, new_size);
-            if (ERR_NONE != err)
-                return err;
-            map->_collision_detected = false;
-        }
-        else if (map->_collision_detected)
-            return ERR_CONTAINER_AT_CAPACITY;
+        u8* block = realloc(old_block, vals_offset + sizeof(hash_map_vals_59) + capacity * val_size);
+        if (!block)
+            return ERR_NO_MEM;
+        if (aliased)
+            val = block + val_at;
 
-        return ERR_NONE;
+        entry->pair.key = (key_val_pair_59*)block + 1;
+        entry->pair.val = block + vals_offset;
+        vals = entry->pair.val;
+        vals->capacity = capacity;
     }
 
-    if (!((key_val_pair_59*)node->node_obj)->val)
-        return ERR_INTRNL;
-
-    free(((key_val_pair_59*)node->node_obj)->val); // Remember that the value is being replaced, therefore free
-    ((key_val_pair_59*)node->node_obj)->val = val;
+    if (val)
+        memcpy(vals->vals + vals->count * val_size, val, val_size);
+    else
+        memset(vals->vals + vals->count * val_size, 0, val_size);
+    vals->count++;
 
     return ERR_NONE;
 }
 
-ERR_59_e get_from_hash_map_59(hash_map_59* const map, void* key, void** val)
+/***********************************************************************************************************************
+ * @brief: Checks if the passed unsigned value is a prime number.
+ *
+ * @param[in] prime: Number to check which must be equal to or greater than 3.
+ * @param[out] is_prime: Pointer to store the bool out value.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Use of smaller numbers equates to more performance.
+ **********************************************************************************************************************/
+static ERR_59_e _check_is_prime_internal_hash_map_59(size_t const prime, bool* is_prime)
 {
-    if (!map || !key || !val)
+    if (!is_prime || 3 > prime || DBL_MAX < prime)
         return ERR_INV_PARAM;
 
-    size_t hash = 0;
-    ERR_59_e err = _hash_key_internal_hash_map_59(map, key, &hash);
-    if (ERR_NONE != err)
-        return err;
-
-    llist_node_59* node = (void*)0;
-    err = _find_node_in_table_list_hash_map_59(map, map->table[hash], key, &node);
-    if (ERR_NONE != err)
-        return err;
+    size_t test = 3;
+    *is_prime = true;
+    while (test < sqrt((double)prime) && true == *is_prime)
+    {
+        if (test == prime)
+            break;
 
-    *val = ((key_val_pair_59*)node->node_obj)->val;
+        if (0 == prime % test)
+            *is_prime = false;
+        test++;
+    }
 
     return ERR_NONE;
 }
 
-ERR_59_e remove_from_hash_map_59(hash_map_59* const map, void* const key, key_val_pair_59** pair)
+/***********************************************************************************************************************
+ * @brief: Chains every live entry into the passed table by its cached hash, keys are never rehashed.
+ *
+ * @param[in] map: Map whose entries are indexed.
+ * @param[out] table: Table of @table_size buckets to rebuild, may be the map's own table.
+ * @param[in] table_size: Number of buckets in @table.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _rebuild_index_hash_map_59(hash_map_59* const map, size_t* const table, size_t const table_size)
 {
-    if (!map || !key || !pair)
+    if (!map || !table || 0 == table_size)
         return ERR_INV_PARAM;
 
-    size_t hash = 0;
-    ERR_59_e err = _hash_key_internal_hash_map_59(map, key, &hash);
-    if (ERR_NONE != err)
+    memset(table, 0, sizeof(size_t) * table_size);
+    for (size_t i = 0; i < map->entries_used; i++)
+    {
+        hash_map_entry_59* entry = &map->entries[i];
+        if (!entry->pair.key)
+            continue;
+
+        size_t const bucket = entry->pair.hash % table_size;
+        entry->next = table[bucket];
+        table[bucket] = i + 1;
+    }
+
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Squeezes the holes left by removals out of the entries array, keeping insertion order, and chains the
+ * entries into the passed table in the same pass.
+ *
+ * @param[in] map: Map whose entries are squeezed.
+ * @param[out] table: Table of @table_size buckets to rebuild, may be the map's own table or NULL for small maps.
+ * @param[in] table_size: Number of buckets in @table.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _squeeze_entries_hash_map_59(hash_map_59* const map, size_t* const table, size_t const table_size)
+{
+    if (!map || (table && 0 == table_size))
+        return ERR_INV_PARAM;
+
+    if (table)
+        memset(table, 0, sizeof(size_t) * table_size);
+
+    size_t used = 0;
+    for (size_t i = 0; i < map->entries_used; i++)
+    {
+        if (!map->entries[i].pair.key)
+            continue;
+
+        map->entries[used] = map->entries[i];
+        if (table)
+        {
+            size_t const bucket = map->entries[used].pair.hash % table_size;
+            map->entries[used].next = table[bucket];
+            table[bucket] = used + 1;
+        }
+        used++;
+    }
+    map->entries_used = used;
+
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Gets the table size that fits the passed number of entries at half of @HASH_MAP_MAX_LOAD, leaving room to
+ * grow and to shrink before the next resize.
+ *
+ * @param[in] size: Number of entries to fit.
+ * @param[out] table_size: Pointer to place the table size in, never below @DEFAULT_HASH_MAP_TABLE_SIZE.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _fit_table_size_hash_map_59(size_t const size, size_t* table_size)
+{
+    if (!table_size)
+        return ERR_INV_PARAM;
+
+    *table_size = DEFAULT_HASH_MAP_TABLE_SIZE;
+    while (*table_size * HASH_MAP_MAX_LOAD < size * 2 && *table_size < (*table_size << 1))
+        *table_size <<= 1;
+
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Replaces the map's bloom filter with a new one holding the cached hash of every entry.
+ *
+ * @param[in] map: Map to rebuild the filter of.
+ * @param[in] capacity: Number of hashes the new filter is sized for, raised to @DEFAULT_HASH_MAP_TABLE_SIZE.
+ * @param[in] counters_per_key: Counters per hash of the new filter, 0 for the default.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note On error the old filter, if any, is left in place.
+ **********************************************************************************************************************/
+static ERR_59_e
+_rebuild_filter_hash_map_59(hash_map_59* const map, size_t const capacity, size_t const counters_per_key)
+{
+    if (!map)
+        return ERR_INV_PARAM;
+
+    bloom_filter_59* new_filter = (void*)0;
+    size_t const filter_capacity = (DEFAULT_HASH_MAP_TABLE_SIZE < capacity) ? capacity : DEFAULT_HASH_MAP_TABLE_SIZE;
+    ERR_59_e err = init_bloom_filter_59(&new_filter, filter_capacity, counters_per_key);
+    if (ERR_NONE != err)
+        return err;
+
+    for (size_t i = 0; i < map->entries_used; i++)
+    {
+        if (!map->entries[i].pair.key)
+            continue;
+
+        err = add_to_bloom_filter_59(new_filter, map->entries[i].pair.hash);
+        if (ERR_NONE != err)
+        {
+            deinit_bloom_filter_59(&new_filter);
+            return err;
+        }
+    }
+
+    if (map->filter)
+        deinit_bloom_filter_59(&map->filter);
+    map->filter = new_filter;
+
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Makes room for one more entry at the end of the entries array. Holes left by removals are squeezed out in
+ * place, keeping insertion order, once they make up half the array, otherwise the array doubles. A small map
+ * outgrowing its inline entries moves them to the heap and allocates its table.
+ *
+ * @param[in] map: Map to make room in.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _reserve_entry_hash_map_59(hash_map_59* const map)
+{
+    if (!map)
+        return ERR_INV_PARAM;
+
+    if (map->entries_used < map->entries_capacity)
+        return ERR_NONE;
+
+    size_t const holes = map->entries_used - map->size;
+    if (0 != holes && holes >= map->entries_used / 2)
+        return _squeeze_entries_hash_map_59(map, map->table, map->table_size);
+
+    size_t new_capacity = map->entries_capacity << 1;
+    if (map->entries == map->_small)
+    {
+        // Sized for the entry about to be appended, so the insert that outgrows the inline entries does not resize.
+        while (map->table_size * HASH_MAP_MAX_LOAD <= map->size && map->table_size < (map->table_size << 1))
+            map->table_size <<= 1;
+        if (new_capacity < map->table_size) // Maps sized up front get their entries sized to match.
+            new_capacity = map->table_size;
+
+        hash_map_entry_59* new_entries = malloc(sizeof(hash_map_entry_59) * new_capacity);
+        size_t* new_table = calloc(map->table_size, sizeof(size_t));
+        if (!new_entries || !new_table)
+        {
+            free(new_entries);
+            free(new_table);
+            return ERR_NO_MEM;
+        }
+
+        memcpy(new_entries, map->_small, sizeof(hash_map_entry_59) * map->entries_used);
+        map->entries = new_entries;
+        map->entries_capacity = new_capacity;
+        map->table = new_table;
+
+        return _rebuild_index_hash_map_59(map, map->table, map->table_size);
+    }
+
+    if (new_capacity <= map->entries_capacity || SIZE_MAX / sizeof(hash_map_entry_59) < new_capacity)
+        return ERR_CONTAINER_AT_CAPACITY;
+
+    hash_map_entry_59* new_entries = realloc(map->entries, sizeof(hash_map_entry_59) * new_capacity);
+    if (!new_entries)
+        return ERR_NO_MEM;
+
+    map->entries = new_entries;
+    map->entries_capacity = new_capacity;
+
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Shared initialization for hash maps, see @init_hash_map_59 and @init_copy_hash_map_59.
+ *
+ * @param[out] map: Pointer to a @hash_map_59 pointer to initialize the hash map in.
+ * @param[in] key_type: Type of the keys for the hash map.
+ * @param[in] val_type: Type of the vals for the hash map.
+ * @param[in] val_type_depth: Depth of the values in the hash map.
+ * @param[in] table_size: Size of the table in the hash_map, 0 for @DEFAULT_HASH_MAP_TABLE_SIZE.
+ * @param[in] prime: Prime number to be used in hashing, 0 for @DEFAULT_HASH_MAP_PRIME.
+ * @param[in] copy_in: Whether the map copies its keys and values into its entries.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Maps start small, their entries are held inline and the table is allocated once they outgrow them.
+ **********************************************************************************************************************/
+static ERR_59_e _init_hash_map_internal_59(hash_map_59** map,
+                                           TYPE_59_e const key_type,
+                                           TYPE_59_e const val_type,
+                                           size_t const val_type_depth,
+                                           size_t const table_size,
+                                           size_t const prime,
+                                           bool const copy_in)
+{
+    if (!map)
+        return ERR_INV_PARAM;
+
+    ERR_59_e err = ERR_NONE;
+
+    hash_map_59* new_map = malloc(sizeof(hash_map_59));
+    if (!new_map)
+        return ERR_NO_MEM;
+
+    if (0 != prime)
+    {
+        bool is_prime = true;
+        err = _check_is_prime_internal_hash_map_59(prime, &is_prime);
+        if (ERR_NONE != err || !is_prime)
+        {
+            free(new_map);
+            return (ERR_NONE != err) ? err : ERR_INV_PARAM;
+        }
+        else
+            new_map->_prime = prime;
+    }
+    else
+        new_map->_prime = DEFAULT_HASH_MAP_PRIME;
+
+    if (0 != table_size)
+        new_map->table_size = table_size;
+    else
+        new_map->table_size = DEFAULT_HASH_MAP_TABLE_SIZE;
+
+    new_map->key_type = key_type;
+    new_map->val_type = val_type;
+    new_map->val_type_depth = val_type_depth;
+    new_map->entries = new_map->_small;
+    new_map->entries_used = 0;
+    new_map->entries_capacity = HASH_MAP_SMALL_SIZE;
+    new_map->table = (void*)0;
+    new_map->size = 0;
+    new_map->copy_in = copy_in;
+    new_map->multi = false;
+    new_map->min_load_percent = DEFAULT_HASH_MAP_MIN_LOAD_PERCENT;
+    new_map->filter = (void*)0;
+
+    *map = new_map;
+
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Appends a new entry and chains it into its table bucket, doubling the table once the map holds more than
+ * @HASH_MAP_MAX_LOAD entries per bucket.
+ *
+ * @param[in] map: Hash map to insert the new entry into.
+ * @param[in] key: Key of the new entry.
+ * @param[in] val: Value of the new entry, may be NULL for @copy_in maps with fixed size values to zero the value.
+ * @param[in] hash: Full width hash of @key.
+ * @param[out] idx: Pointer to place the index of the new entry in, may be NULL.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e
+_insert_entry_hash_map_59(hash_map_59* const map, void* key, void* val, size_t const hash, size_t* idx)
+{
+    ERR_59_e err = _reserve_entry_hash_map_59(map);
+    if (ERR_NONE != err)
+        return err;
+
+    hash_map_entry_59* entry = &map->entries[map->entries_used];
+    err = _init_pair_hash_map_59(map, key, val, hash, &entry->pair);
+    if (ERR_NONE != err)
+        return err;
+
+    entry->next = 0;
+    map->entries_used++;
+    if (map->table)
+    {
+        size_t const bucket = hash % map->table_size;
+        entry->next = map->table[bucket];
+        map->table[bucket] = map->entries_used;
+    }
+    map->size++;
+
+    if (idx)
+        *idx = map->entries_used - 1;
+
+    // The entry is in the map now, so the filter must hold its hash or be dropped, either way lookups stay correct.
+    if (map->filter && ERR_NONE != add_to_bloom_filter_59(map->filter, hash))
+        deinit_bloom_filter_59(&map->filter);
+
+    // Past its capacity the filter's false positive rate climbs, so it is rebuilt at twice the size. This is best
+    // effort, a failed rebuild keeps the current filter which already holds the new hash.
+    if (map->filter && map->size > map->filter->capacity)
+        (void)_rebuild_filter_hash_map_59(map, map->size << 1, map->filter->counters_per_key);
+
+    // If the doubled size is not larger the table size is maxed out and the chains are left to grow instead.
+    size_t new_size = map->table_size << 1;
+    if (map->table && new_size > map->table_size && map->size > map->table_size * HASH_MAP_MAX_LOAD)
+        return resize_table_hash_map_59(map, new_size);
+
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Gives an existing entry the value of a repeated upsert, appended for @multi maps and replaced otherwise.
+ *
+ * @param[in] map: Hash map holding the entry.
+ * @param[in] entry: Entry whose key was upserted again.
+ * @param[in] val: Value of the upsert.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _update_entry_hash_map_59(hash_map_59 const* const map, hash_map_entry_59* const entry, void* val)
+{
+    if (!entry->pair.val && VOID_0 != map->val_type)
+        return ERR_INTRNL;
+
+    if (map->multi)
+        return _append_val_hash_map_59(map, entry, val);
+
+    if (map->copy_in)
+        return _replace_copy_val_hash_map_59(map, entry, val);
+
+    free(entry->pair.val); // Remember that the value is being replaced, therefore free
+    entry->pair.val = val;
+
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Upserts a key and value whose full width hash has already been computed.
+ *
+ * @param[in] map: Hash map to insert the new pair into.
+ * @param[in] key: Key of the new entry.
+ * @param[in] val: Value of the new entry.
+ * @param[in] hash: Full width hash of @key.
+ * @param[in] key_len: Length of STR keys, see @_hash_key_internal_hash_map_59.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e
+_upsert_hashed_hash_map_59(hash_map_59* const map, void* key, void* val, size_t const hash, size_t const key_len)
+{
+    size_t idx = 0;
+    ERR_59_e err = _find_entry_hash_map_59(map, key, hash, key_len, &idx, (void*)0);
+    if (ERR_OBJ_NOT_FOUND == err)
+        return _insert_entry_hash_map_59(map, key, val, hash, (void*)0);
+    if (ERR_NONE != err)
+        return err;
+
+    return _update_entry_hash_map_59(map, &map->entries[idx], val);
+}
+
+/***********************************************************************************************************************
+ * @brief: First bulk build phase, hashes the worker's slice of the input and counts its keys per shard.
+ *
+ * @param[in] arg: The @hash_map_build_worker_59 to run.
+ *
+ * @retval int: Always 0, the outcome is left in the worker's @err.
+ **********************************************************************************************************************/
+static int _hash_slice_hash_map_59(void* arg)
+{
+    hash_map_build_worker_59* worker = arg;
+    hash_map_build_59* build = worker->build;
+    size_t const lo = build->count * worker->idx / build->shards;
+    size_t const hi = build->count * (worker->idx + 1) / build->shards;
+
+    size_t key_len = 0;
+    for (size_t i = lo; i < hi; i++)
+    {
+        if (!build->vals[i] && VOID_0 != build->map->val_type)
+        {
+            worker->err = ERR_INV_PARAM;
+            return 0;
+        }
+        worker->err = _hash_key_internal_hash_map_59(build->map, build->keys[i], &build->hashes[i], &key_len);
+        if (ERR_NONE != worker->err)
+            return 0;
+        if (build->key_lens)
+            build->key_lens[i] = key_len;
+        worker->cursors[build->hashes[i] % build->shards]++;
+    }
+
+    return 0;
+}
+
+/***********************************************************************************************************************
+ * @brief: Second bulk build phase, scatters the indexes of the worker's slice into their shard's part of @order.
+ *
+ * @param[in] arg: The @hash_map_build_worker_59 to run, its @cursors already turned into @order offsets.
+ *
+ * @retval int: Always 0.
+ **********************************************************************************************************************/
+static int _scatter_slice_hash_map_59(void* arg)
+{
+    hash_map_build_worker_59* worker = arg;
+    hash_map_build_59* build = worker->build;
+    size_t const lo = build->count * worker->idx / build->shards;
+    size_t const hi = build->count * (worker->idx + 1) / build->shards;
+
+    for (size_t i = lo; i < hi; i++)
+        build->order[worker->cursors[build->hashes[i] % build->shards]++] = i;
+
+    return 0;
+}
+
+/***********************************************************************************************************************
+ * @brief: Last bulk build phase, upserts the worker's shard. A new key takes the entry at its own @order slot, so the
+ * shard's entries stay in input order and a repeated key simply leaves its slot as a hole.
+ *
+ * @param[in] arg: The @hash_map_build_worker_59 to run.
+ *
+ * @retval int: Always 0, the outcome is left in the worker's @err.
+ **********************************************************************************************************************/
+static int _build_shard_hash_map_59(void* arg)
+{
+    hash_map_build_worker_59* worker = arg;
+    hash_map_build_59* build = worker->build;
+    hash_map_59* map = build->map;
+
+    size_t const end = build->shard_starts[worker->idx + 1];
+    for (size_t slot = build->shard_starts[worker->idx]; slot < end; slot++)
+    {
+        // Keeps the bucket loads of the next keys in flight, as the batch functions do.
+        if (slot + HASH_MAP_BATCH_SIZE < end)
+            HASH_MAP_PREFETCH(&map->table[build->hashes[build->order[slot + HASH_MAP_BATCH_SIZE]] % map->table_size]);
+
+        size_t const i = build->order[slot];
+        size_t const key_len = build->key_lens ? build->key_lens[i] : 0;
+        size_t idx = 0;
+        worker->err = _find_entry_hash_map_59(map, build->keys[i], build->hashes[i], key_len, &idx, (void*)0);
+        if (ERR_NONE == worker->err)
+            worker->err = _update_entry_hash_map_59(map, &map->entries[idx], build->vals[i]);
+        else if (ERR_OBJ_NOT_FOUND == worker->err)
+        {
+            hash_map_entry_59* entry = &map->entries[slot];
+            worker->err = _init_pair_hash_map_59(map, build->keys[i], build->vals[i], build->hashes[i], &entry->pair);
+            if (ERR_NONE == worker->err)
+            {
+                size_t const bucket = build->hashes[i] % map->table_size;
+                entry->next = map->table[bucket];
+                map->table[bucket] = slot + 1;
+                worker->size++;
+            }
+        }
+        if (ERR_NONE != worker->err)
+            return 0;
+    }
+
+    return 0;
+}
+
+/***********************************************************************************************************************
+ * @brief: Frees the scratch buffers of a bulk build, any of which may be NULL.
+ *
+ * @param[in] build: Build to free the buffers of.
+ **********************************************************************************************************************/
+static void _free_build_hash_map_59(hash_map_build_59* const build)
+{
+    free(build->hashes);
+    free(build->key_lens);
+    free(build->order);
+    free(build->shard_starts);
+    free(build->cursors);
+}
+
+/***********************************************************************************************************************
+ * @brief: Runs one bulk build phase across the workers, the first on the calling thread. A worker whose thread cannot
+ * be started is run on the calling thread once the others are going.
+ *
+ * @param[in] workers: Workers to run.
+ * @param[in] count: Number of workers.
+ * @param[in] phase: Phase function to run each worker through.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _run_build_phase_hash_map_59(hash_map_build_worker_59* workers, size_t const count, thrd_start_t phase)
+{
+    bool started[HASH_MAP_BUILD_MAX_THREADS] = {false};
+    for (size_t w = 1; w < count; w++)
+        started[w] = (thrd_success == thrd_create(&workers[w].thread, phase, &workers[w]));
+
+    phase(&workers[0]);
+    for (size_t w = 1; w < count; w++)
+    {
+        if (started[w])
+            thrd_join(workers[w].thread, (void*)0);
+        else
+            phase(&workers[w]);
+    }
+
+    for (size_t w = 0; w < count; w++)
+    {
+        if (ERR_NONE != workers[w].err)
+            return workers[w].err;
+    }
+
+    return ERR_NONE;
+}
+
+/*
+========================================================================================================================
+- - FUNCTION DEFINITIONS - -
+========================================================================================================================
+*/
+
+ERR_59_e init_hash_map_59(hash_map_59** map,
+                          TYPE_59_e const key_type,
+                          TYPE_59_e const val_type,
+                          size_t const val_type_depth,
+                          size_t const table_size,
+                          size_t const prime)
+{
+    return _init_hash_map_internal_59(map, key_type, val_type, val_type_depth, table_size, prime, false);
+}
+
+ERR_59_e init_copy_hash_map_59(hash_map_59** map,
+                               TYPE_59_e const key_type,
+                               TYPE_59_e const val_type,
+                               size_t const val_type_depth,
+                               size_t const table_size,
+                               size_t const prime)
+{
+    size_t size = 0;
+    if (STR != key_type && ERR_NONE != get_type_size_59(key_type, &size))
+        return ERR_NOT_SUPPORTED;
+    if (STR != val_type && VOID_0 != val_type && ERR_NONE != get_type_size_59(val_type, &size))
+        return ERR_NOT_SUPPORTED;
+
+    return _init_hash_map_internal_59(map, key_type, val_type, val_type_depth, table_size, prime, true);
+}
+
+ERR_59_e init_multi_hash_map_59(hash_map_59** map,
+                                TYPE_59_e const key_type,
+                                TYPE_59_e const val_type,
+                                size_t const val_type_depth,
+                                size_t const table_size,
+                                size_t const prime)
+{
+    // Values are packed back to back, so they must all be the same size.
+    size_t size = 0;
+    if (STR != key_type && ERR_NONE != get_type_size_59(key_type, &size))
+        return ERR_NOT_SUPPORTED;
+    if (ERR_NONE != get_type_size_59(val_type, &size))
+        return ERR_NOT_SUPPORTED;
+
+    ERR_59_e err = _init_hash_map_internal_59(map, key_type, val_type, val_type_depth, table_size, prime, true);
+    if (ERR_NONE != err)
+        return err;
+    (*map)->multi = true;
+
+    return ERR_NONE;
+}
+
+ERR_59_e deinit_hash_map_59(hash_map_59** map)
+{
+    if (!map || !(*map))
+        return ERR_INV_PARAM;
+
+    ERR_59_e err = ERR_NONE;
+
+    for (size_t i = 0; i < (*map)->entries_used; i++)
+    {
+        if (!(*map)->entries[i].pair.key)
+            continue;
+
+        err = _free_entry_hash_map_59(*map, &(*map)->entries[i]);
+        if (ERR_NONE != err)
+            return err;
+    }
+
+    if ((*map)->entries != (*map)->_small)
+        free((*map)->entries);
+    if ((*map)->filter)
+        deinit_bloom_filter_59(&(*map)->filter);
+    free((*map)->table);
+    free((*map));
+    *map = (void*)0;
+
+    return ERR_NONE;
+}
+
+ERR_59_e upsert_into_hash_map_59(hash_map_59* const map, void* key, void* val)
+{
+    if (!map || !key || (!val && VOID_0 != map->val_type))
+        return ERR_INV_PARAM;
+
+    size_t hash = 0;
+    size_t key_len = 0;
+    ERR_59_e err = _hash_key_internal_hash_map_59(map, key, &hash, &key_len);
+    if (ERR_NONE != err)
+        return err;
+
+    return _upsert_hashed_hash_map_59(map, key, val, hash, key_len);
+}
+
+ERR_59_e get_from_hash_map_59(hash_map_59* const map, void* key, void** val)
+{
+    if (!map || !key || !val)
+        return ERR_INV_PARAM;
+
+    size_t hash = 0;
+    size_t key_len = 0;
+    ERR_59_e err = _hash_key_internal_hash_map_59(map, key, &hash, &key_len);
+    if (ERR_NONE != err)
+        return err;
+
+    size_t idx = 0;
+    err = _find_entry_hash_map_59(map, key, hash, key_len, &idx, (void*)0);
+    if (ERR_NONE != err)
+        return err;
+
+    *val = map->entries[idx].pair.val;
+
+    return ERR_NONE;
+}
+
+ERR_59_e
+get_or_insert_hash_map_59(hash_map_59* const map, void* key, void* default_val, void** val_slot, bool* inserted)
+{
+    if (!map || !key || !val_slot || (!default_val && !map->copy_in && VOID_0 != map->val_type))
+        return ERR_INV_PARAM;
+
+    size_t hash = 0;
+    size_t key_len = 0;
+    ERR_59_e err = _hash_key_internal_hash_map_59(map, key, &hash, &key_len);
+    if (ERR_NONE != err)
+        return err;
+
+    size_t idx = SIZE_MAX;
+    err = _find_entry_hash_map_59(map, key, hash, key_len, &idx, (void*)0);
+    if (ERR_NONE == err)
+    {
+        *val_slot = map->entries[idx].pair.val;
+        if (inserted)
+            *inserted = false;
+        return ERR_NONE;
+    }
+    if (ERR_OBJ_NOT_FOUND != err)
+        return err;
+
+    // Values live outside the entries array, so the slot stays valid even if this insert grows the table or entries.
+    idx = SIZE_MAX;
+    err = _insert_entry_hash_map_59(map, key, default_val, hash, &idx);
+    if (SIZE_MAX != idx)
+    {
+        *val_slot = map->entries[idx].pair.val;
+        if (inserted)
+            *inserted = true;
+    }
+
+    return err;
+}
+
+ERR_59_e get_many_from_hash_map_59(hash_map_59* const map, void* const* keys, size_t const count, void** vals)
+{
+    if (!map || !keys || !vals)
+        return ERR_INV_PARAM;
+
+    size_t hashes[HASH_MAP_BATCH_SIZE];
+    size_t key_lens[HASH_MAP_BATCH_SIZE];
+    size_t idx = 0;
+    ERR_59_e err = ERR_NONE;
+    for (size_t start = 0; start < count; start += HASH_MAP_BATCH_SIZE)
+    {
+        size_t const batch = (count - start < HASH_MAP_BATCH_SIZE) ? count - start : HASH_MAP_BATCH_SIZE;
+
+        // Hash the whole batch first, pulling in each key's table bucket as we go.
+        for (size_t i = 0; i < batch; i++)
+        {
+            err = _hash_key_internal_hash_map_59(map, keys[start + i], &hashes[i], &key_lens[i]);
+            if (ERR_NONE != err)
+                return err;
+            if (map->table)
+                HASH_MAP_PREFETCH(&map->table[hashes[i] % map->table_size]);
+        }
+
+        // The buckets should have landed by now, pull in the first entry of each chain.
+        for (size_t i = 0; map->table && i < batch; i++)
+        {
+            size_t const head = map->table[hashes[i] % map->table_size];
+            if (head)
+                HASH_MAP_PREFETCH(&map->entries[head - 1]);
+        }
+
+        for (size_t i = 0; i < batch; i++)
+        {
+            vals[start + i] = (void*)0;
+            err = _find_entry_hash_map_59(map, keys[start + i], hashes[i], key_lens[i], &idx, (void*)0);
+            if (ERR_NONE == err)
+                vals[start + i] = map->entries[idx].pair.val;
+            else if (ERR_OBJ_NOT_FOUND != err)
+                return err;
+        }
+    }
+
+    return ERR_NONE;
+}
+
+ERR_59_e upsert_many_into_hash_map_59(hash_map_59* const map, void* const* keys, void* const* vals, size_t const count)
+{
+    if (!map || !keys || !vals)
+        return ERR_INV_PARAM;
+
+    size_t hashes[HASH_MAP_BATCH_SIZE];
+    size_t key_lens[HASH_MAP_BATCH_SIZE];
+    ERR_59_e err = ERR_NONE;
+    for (size_t start = 0; start < count; start += HASH_MAP_BATCH_SIZE)
+    {
+        size_t const batch = (count - start < HASH_MAP_BATCH_SIZE) ? count - start : HASH_MAP_BATCH_SIZE;
+
+        for (size_t i = 0; i < batch; i++)
+        {
+            if (!vals[start + i] && VOID_0 != map->val_type)
+                return ERR_INV_PARAM;
+            err = _hash_key_internal_hash_map_59(map, keys[start + i], &hashes[i], &key_lens[i]);
+            if (ERR_NONE != err)
+                return err;
+            if (map->table)
+                HASH_MAP_PREFETCH(&map->table[hashes[i] % map->table_size]);
+        }
+
+        for (size_t i = 0; map->table && i < batch; i++)
+        {
+            size_t const head = map->table[hashes[i] % map->table_size];
+            if (head)
+                HASH_MAP_PREFETCH(&map->entries[head - 1]);
+        }
+
+        // Inserts may resize the table mid batch, the cached hashes are reduced against the current size on use.
+        for (size_t i = 0; i < batch; i++)
+        {
+            err = _upsert_hashed_hash_map_59(map, keys[start + i], vals[start + i], hashes[i], key_lens[i]);
+            if (ERR_NONE != err)
+                return err;
+        }
+    }
+
+    return ERR_NONE;
+}
+
+ERR_59_e build_hash_map_59(
+    hash_map_59* const map, void* const* keys, void* const* vals, size_t const count, size_t const threads)
+{
+    if (!map || !keys || !vals)
+        return ERR_INV_PARAM;
+
+    if (0 != map->entries_used || count <= HASH_MAP_SMALL_SIZE || threads <= 1)
+        return upsert_many_into_hash_map_59(map, keys, vals, count);
+
+    if (SIZE_MAX / sizeof(hash_map_entry_59) < count)
+        return ERR_CONTAINER_AT_CAPACITY;
+
+    size_t table_size = 0;
+    ERR_59_e err = _fit_table_size_hash_map_59(count, &table_size);
+    if (ERR_NONE != err)
         return err;
+    while (table_size < map->table_size && table_size < (table_size << 1))
+        table_size <<= 1;
+
+    // Shards must divide the power of two table size so every bucket belongs to exactly one shard.
+    size_t shards = 1;
+    while (shards << 1 <= threads && shards << 1 <= HASH_MAP_BUILD_MAX_THREADS && shards << 1 <= table_size)
+        shards <<= 1;
+
+    hash_map_build_59 build = {
+        .map = map,
+        .keys = keys,
+        .vals = vals,
+        .count = count,
+        .hashes = malloc(sizeof(size_t) * count),
+        .key_lens = (STR == map->key_type) ? malloc(sizeof(size_t) * count) : (void*)0,
+        .order = malloc(sizeof(size_t) * count),
+        .shard_starts = calloc(shards + 1, sizeof(size_t)),
+        .shards = shards,
+        .cursors = calloc(shards * shards, sizeof(size_t)),
+    };
+    hash_map_entry_59* entries = calloc(count, sizeof(hash_map_entry_59));
+    size_t* table = calloc(table_size, sizeof(size_t));
+    if (!build.hashes || (STR == map->key_type && !build.key_lens) || !build.order || !build.shard_starts ||
+        !build.cursors || !entries || !table)
+    {
+        _free_build_hash_map_59(&build);
+        free(entries);
+        free(table);
+        return ERR_NO_MEM;
+    }
+
+    if (map->entries != map->_small)
+        free(map->entries);
+    free(map->table);
+    map->entries = entries;
+    map->entries_capacity = count;
+    map->table = table;
+    map->table_size = table_size;
+
+    // Lookups during the build must not consult a filter that does not hold the new hashes yet.
+    bloom_filter_59* filter = map->filter;
+    map->filter = (void*)0;
+
+    hash_map_build_worker_59 workers[HASH_MAP_BUILD_MAX_THREADS];
+    for (size_t w = 0; w < shards; w++)
+        workers[w] = (hash_map_build_worker_59){.build = &build, .idx = w, .cursors = &build.cursors[w * shards]};
+
+    err = _run_build_phase_hash_map_59(workers, shards, _hash_slice_hash_map_59);
+    if (ERR_NONE == err)
+    {
+        // Shard-major offsets, each worker scatters its keys after those of the workers before it.
+        size_t offset = 0;
+        for (size_t s = 0; s < shards; s++)
+        {
+            build.shard_starts[s] = offset;
+            for (size_t w = 0; w < shards; w++)
+            {
+                size_t const keys_in_shard = workers[w].cursors[s];
+                workers[w].cursors[s] = offset;
+                offset += keys_in_shard;
+            }
+        }
+        build.shard_starts[shards] = offset;
+
+        err = _run_build_phase_hash_map_59(workers, shards, _scatter_slice_hash_map_59);
+    }
+    if (ERR_NONE == err)
+    {
+        err = _run_build_phase_hash_map_59(workers, shards, _build_shard_hash_map_59);
+
+        // Whatever the shards built stays, holes left by repeated keys or a failed shard hold no key.
+        map->entries_used = count;
+        for (size_t w = 0; w < shards; w++)
+            map->size += workers[w].size;
+        while (0 != map->entries_used && !map->entries[map->entries_used - 1].pair.key)
+            map->entries_used--;
+    }
+
+    map->filter = filter;
+    if (filter)
+    {
+        ERR_59_e filter_err = _rebuild_filter_hash_map_59(map, map->size << 1, filter->counters_per_key);
+        if (ERR_NONE != filter_err)
+        {
+            // The old filter is missing the new hashes, dropping it keeps lookups correct.
+            deinit_bloom_filter_59(&map->filter);
+            if (ERR_NONE == err)
+                err = filter_err;
+        }
+    }
+
+    _free_build_hash_map_59(&build);
+
+    return err;
+}
+
+ERR_59_e remove_from_hash_map_59(hash_map_59* const map, void* const key, key_val_pair_59** pair)
+{
+    if (!map || !key || !pair)
+        return ERR_INV_PARAM;
 
-    llist_node_59* node = (void*)0;
-    err = _find_node_in_table_list_hash_map_59(map, map->table[hash], key, &node);
+    size_t hash = 0;
+    size_t key_len = 0;
+    ERR_59_e err = _hash_key_internal_hash_map_59(map, key, &hash, &key_len);
     if (ERR_NONE != err)
         return err;
 
-    err = remove_given_node_from_llist_59(map->table[hash], node);
+    size_t idx = 0;
+    size_t* link = (void*)0;
+    err = _find_entry_hash_map_59(map, key, hash, key_len, &idx, &link);
     if (ERR_NONE != err)
         return err;
 
-    *pair = (key_val_pair_59*)node->node_obj;
+    hash_map_entry_59* entry = &map->entries[idx];
+    key_val_pair_59* removed = (void*)0;
+    if (map->copy_in)
+        removed = (key_val_pair_59*)entry->pair.key - 1; // The pair leading the key bytes is handed back.
+    else
+    {
+        removed = malloc(sizeof(key_val_pair_59));
+        if (!removed)
+            return ERR_NO_MEM;
+    }
+    *removed = entry->pair;
+
+    if (map->filter && ERR_NONE != remove_from_bloom_filter_59(map->filter, hash))
+    {
+        if (!map->copy_in)
+            free(removed);
+        return ERR_INTRNL; // Every entry's hash is in the filter, failing to remove one means it is out of step.
+    }
+
+    // The entry stays behind as a hole so iteration order and the indexes of later entries are untouched.
+    if (link)
+        *link = entry->next;
+    entry->pair.key = (void*)0;
+    entry->pair.val = (void*)0;
+    entry->next = 0;
+    map->size--;
+
+    // Trailing holes are dropped straight away, they never need compacting.
+    while (0 != map->entries_used && !map->entries[map->entries_used - 1].pair.key)
+        map->entries_used--;
+
+    // Shrinking only rebuilds the table, the entries stay put so removing while iterating is still safe.
+    if (map->table && map->size * 100 < map->table_size * map->min_load_percent)
+    {
+        size_t fit = 0;
+        err = _fit_table_size_hash_map_59(map->size, &fit);
+        if (ERR_NONE == err && fit < map->table_size)
+            (void)resize_table_hash_map_59(map, fit); // A failed shrink keeps the larger table, the remove stands.
+    }
+
+    *pair = removed;
+
+    return ERR_NONE;
+}
+
+ERR_59_e get_all_from_hash_map_59(hash_map_59* const map, void* key, void** vals, size_t* count)
+{
+    if (!vals || !count)
+        return ERR_INV_PARAM;
+
+    void* val = (void*)0;
+    ERR_59_e err = get_from_hash_map_59(map, key, &val);
+    if (ERR_NONE != err)
+        return err;
 
-    free(node);
+    if (map->multi)
+    {
+        *vals = ((hash_map_vals_59*)val)->vals;
+        *count = ((hash_map_vals_59*)val)->count;
+    }
+    else
+    {
+        *vals = val;
+        *count = 1;
+    }
 
     return ERR_NONE;
 }
 
-ERR_59_e resize_table_hash_map_59(hash_map_59* const map, size_t const new_size)
+ERR_59_e remove_one_from_hash_map_59(hash_map_59* const map, void* const key, void const* const val)
+{
+    if (!map || !key || !val)
+        return ERR_INV_PARAM;
+    if (!map->multi)
+        return ERR_NOT_SUPPORTED;
+
+    size_t val_size = 0;
+    ERR_59_e err = _get_obj_size_hash_map_59(map->val_type, map->val_type_depth, val, &val_size);
+    if (ERR_NONE != err)
+        return err;
+
+    void* found = (void*)0;
+    err = get_from_hash_map_59(map, key, &found);
+    if (ERR_NONE != err)
+        return err;
+
+    hash_map_vals_59* vals = found;
+    for (size_t i = 0; i < vals->count; i++)
+    {
+        u8* at = vals->vals + i * val_size;
+        if (0 != memcmp(at, val, val_size))
+            continue;
+
+        if (1 == vals->count)
+            return remove_all_from_hash_map_59(map, key);
+
+        memmove(at, at + val_size, (vals->count - i - 1) * val_size);
+        vals->count--;
+        return ERR_NONE;
+    }
+
+    return ERR_OBJ_NOT_FOUND;
+}
+
+ERR_59_e remove_all_from_hash_map_59(hash_map_59* const map, void* const key)
 {
     if (!map)
         return ERR_INV_PARAM;
 
-    llist_59** new_table = malloc(sizeof(llist_59*) * new_size);
+    key_val_pair_59* pair = (void*)0;
+    ERR_59_e err = remove_from_hash_map_59(map, key, &pair);
+    if (ERR_NONE != err)
+        return err;
+
+    if (!map->copy_in)
+    {
+        free(pair->key);
+        free(pair->val);
+    }
+    free(pair);
+
+    return ERR_NONE;
+}
+
+ERR_59_e resize_table_hash_map_59(hash_map_59* const map, size_t const new_size)
+{
+    if (!map || 0 == new_size)
+        return ERR_INV_PARAM;
+
+    if (!map->table)
+    {
+        map->table_size = new_size;
+        return ERR_NONE;
+    }
+
+    size_t* new_table = calloc(new_size, sizeof(size_t));
     if (!new_table)
         return ERR_NO_MEM;
-    ERR_59_e err = ERR_NONE;
-    for (size_t i = 0; i < new_size; i++)
+
+    ERR_59_e err = _rebuild_index_hash_map_59(map, new_table, new_size);
+    if (ERR_NONE != err)
     {
-        llist_59* list = (void*)0;
-        err = init_llist_59(&list, map->val_type, map->val_type_depth);
-        if (ERR_NONE != err)
-        {
-            for (size_t j = 0; j < i; j++)
-                free(new_table[j]);
-            free(new_table);
-            return err;
-        }
-        new_table[i] = list;
+        free(new_table);
+        return err;
     }
 
-    size_t hash = 0;
-    size_t old_size = map->table_size;
-    llist_59** old_table = map->table;
-    map->table_size = new_size;
+    free(map->table);
     map->table = new_table;
-    err = ERR_NONE;
-    for (size_t i = 0; i < old_size; i++)
+    map->table_size = new_size;
+
+    return ERR_NONE;
+}
+
+ERR_59_e init_iter_hash_map_59(hash_map_59 const* const map, hash_map_iter_59* iter)
+{
+    if (!map || !iter)
+        return ERR_INV_PARAM;
+
+    iter->map = map;
+    iter->next = 0;
+
+    return ERR_NONE;
+}
+
+ERR_59_e next_iter_hash_map_59(hash_map_iter_59* const iter, key_val_pair_59 const** pair)
+{
+    if (!iter || !iter->map || !pair)
+        return ERR_INV_PARAM;
+
+    hash_map_59 const* const map = iter->map;
+    while (iter->next < map->entries_used)
     {
-        llist_node_59* node = old_table[i]->head;
-        llist_node_59* next_node = (void*)0;
-        while (node)
+        hash_map_entry_59 const* entry = &map->entries[iter->next];
+        iter->next++;
+        if (entry->pair.key)
         {
-            err = _hash_key_internal_hash_map_59(map, ((key_val_pair_59*)node->node_obj)->key, &hash);
-            if (ERR_NONE != err)
-                goto migrate_abort;
-            next_node = node->next;
-            node->next = (void*)0;
-            err = push_back_llist_59(map->table[hash], node);
-            if (ERR_NONE != err)
-                goto migrate_abort;
-
-            node = next_node;
+            *pair = &entry->pair;
+            return ERR_NONE;
         }
     }
 
-    for (size_t i = 0; i < old_size; i++)
+    *pair = (void*)0;
+
+    return ERR_CONTAINER_EMPTY;
+}
+
+ERR_59_e foreach_hash_map_59(hash_map_59* const map, ERR_59_e (*fn)(void* key, void* val, void* ctx), void* ctx)
+{
+    if (!map || !fn)
+        return ERR_INV_PARAM;
+
+    ERR_59_e err = ERR_NONE;
+    for (size_t i = 0; i < map->entries_used; i++)
     {
-        old_table[i]->head = (void*)0;
-        old_table[i]->tail = (void*)0;
-        free(old_table[i]);
+        // Indexed afresh each pass, @fn removing its entry leaves a hole but never moves the array.
+        key_val_pair_59 const* pair = &map->entries[i].pair;
+        if (!pair->key)
+            continue;
+
+        err = fn(pair->key, pair->val, ctx);
+        if (ERR_NONE != err)
+            return err;
     }
-    free(old_table);
 
     return ERR_NONE;
+}
+
+ERR_59_e set_min_load_hash_map_59(hash_map_59* const map, size_t const min_load_percent)
+{
+    if (!map || min_load_percent * 2 >= HASH_MAP_MAX_LOAD * 100)
+        return ERR_INV_PARAM;
+
+    map->min_load_percent = min_load_percent;
+
+    return ERR_NONE;
+}
+
+ERR_59_e compact_hash_map_59(hash_map_59* const map)
+{
+    if (!map)
+        return ERR_INV_PARAM;
+
+    // Right-sizing the filter is best effort, a failed rebuild keeps the larger filter which still holds every hash.
+    if (map->filter)
+        (void)_rebuild_filter_hash_map_59(map, map->size << 1, map->filter->counters_per_key);
+
+    ERR_59_e err = ERR_NONE;
+    if (map->size <= HASH_MAP_SMALL_SIZE)
+    {
+        err = _squeeze_entries_hash_map_59(map, (void*)0, 0);
+        if (ERR_NONE != err || map->entries == map->_small)
+            return err;
+
+        memcpy(map->_small, map->entries, sizeof(hash_map_entry_59) * map->entries_used);
+        free(map->entries);
+        free(map->table);
+        map->entries = map->_small;
+        map->entries_capacity = HASH_MAP_SMALL_SIZE;
+        map->table = (void*)0;
+        map->table_size = DEFAULT_HASH_MAP_TABLE_SIZE;
+
+        return ERR_NONE;
+    }
+
+    size_t table_size = 0;
+    err = _fit_table_size_hash_map_59(map->size, &table_size);
+    if (ERR_NONE != err)
+        return err;
+
+    size_t* new_table = calloc(table_size, sizeof(size_t));
+    if (!new_table)
+        return ERR_NO_MEM;
 
-migrate_abort:
-    for (size_t i = 0; i < new_size; i++)
+    err = _squeeze_entries_hash_map_59(map, new_table, table_size);
+    if (ERR_NONE != err)
     {
-        map->table[i]->head = (void*)0;
-        map->table[i]->tail = (void*)0;
-        free(map->table[i]);
+        free(new_table);
+        return err;
     }
+
     free(map->table);
-    map->table = old_table;
-    map->table_size = old_size;
-    return err;
+    map->table = new_table;
+    map->table_size = table_size;
+
+    // Trimming is best effort, a failed shrinking realloc leaves the larger entries array in place.
+    hash_map_entry_59* fitted = realloc(map->entries, sizeof(hash_map_entry_59) * map->size);
+    if (fitted)
+    {
+        map->entries = fitted;
+        map->entries_capacity = map->size;
+    }
+
+    return ERR_NONE;
+}
+
+ERR_59_e enable_filter_hash_map_59(hash_map_59* const map, size_t const counters_per_key)
+{
+    if (!map)
+        return ERR_INV_PARAM;
+
+    return _rebuild_filter_hash_map_59(map, map->size << 1, counters_per_key);
+}
+
+ERR_59_e disable_filter_hash_map_59(hash_map_59* const map)
+{
+    if (!map)
+        return ERR_INV_PARAM;
+
+    if (map->filter)
+        return deinit_bloom_filter_59(&map->filter);
+
+    return ERR_NONE;
 }
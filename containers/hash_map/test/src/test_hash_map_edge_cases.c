@@ -45,6 +45,20 @@
 
 #include "hash_map.h"
 
+/*
+========================================================================================================================
+- - INTERNAL TEST HELPERS - -
+========================================================================================================================
+*/
+
+static ERR_59_e _stop_walk(void* key, void* val, void* ctx)
+{
+    (void)key;
+    (void)val;
+    ++(*(size_t*)ctx);
+    return ERR_INTRNL;
+}
+
 /*
 ========================================================================================================================
 - - UNIT TESTS - -
@@ -156,6 +170,22 @@ ERR_59_e test_hash_map_59_edge_cases(void)
     printf("Assert: ERR_INV_PARAM == %d = init_hash_map() with bad prime\n", err);
     assert(ERR_INV_PARAM == err);
 
+    err = init_hash_map_59(&u64_map_dummy, U64_PTR, U64_PTR, 0, 0, 15);
+    printf("Assert: ERR_INV_PARAM == %d = init_hash_map() with non prime\n", err);
+    assert(ERR_INV_PARAM == err && !u64_map_dummy);
+
+    err = init_multi_hash_map_59(&u64_map_dummy, U64_PTR, STR, 0, 0, 0);
+    printf("Assert: ERR_NOT_SUPPORTED == %d = init_multi_hash_map() with STR val type\n", err);
+    assert(ERR_NOT_SUPPORTED == err);
+
+    err = init_multi_hash_map_59(&u64_map_dummy, U64_PTR, VOID_0, 0, 0, 0);
+    printf("Assert: ERR_NOT_SUPPORTED == %d = init_multi_hash_map() key only\n", err);
+    assert(ERR_NOT_SUPPORTED == err);
+
+    err = init_copy_hash_map_59(&u64_map_dummy, U64_PTR, STRUCT_PTR, 0, 0, 0);
+    printf("Assert: ERR_NOT_SUPPORTED == %d = init_copy_hash_map() with unsized val type\n", err);
+    assert(ERR_NOT_SUPPORTED == err);
+
     // Test deinit_hash_map edge cases
     puts("- - - - - - - - - - - - - - - - -");
     puts("Test deinit_hash_map...");
@@ -196,6 +226,75 @@ ERR_59_e test_hash_map_59_edge_cases(void)
     printf("Assert: ERR_INV_PARAM == %d = get_from_hash_map()\n", err);
     assert(ERR_INV_PARAM == err);
 
+    // Test batched edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test get_many_from_hash_map and upsert_many_into_hash_map...");
+
+    void* batch_keys[] = {u1, u_dummy};
+    void* batch_vals[] = {(void*)0, (void*)0};
+
+    err = get_many_from_hash_map_59(u64_map_dummy, batch_keys, 1, batch_vals);
+    printf("Assert: ERR_INV_PARAM == %d = get_many_from_hash_map()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = get_many_from_hash_map_59(u64_map, batch_keys, 2, batch_vals);
+    printf("Assert: ERR_INV_PARAM == %d = get_many_from_hash_map() with null key\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = get_many_from_hash_map_59(u64_map, batch_keys, 0, batch_vals);
+    printf("Assert: ERR_NONE == %d = get_many_from_hash_map() with empty batch\n", err);
+    assert(ERR_NONE == err);
+
+    err = upsert_many_into_hash_map_59(u64_map, batch_keys, batch_vals, 1);
+    printf("Assert: ERR_INV_PARAM == %d = upsert_many_into_hash_map() with null val\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    puts("Test build_hash_map...");
+
+    err = build_hash_map_59(u64_map_dummy, batch_keys, batch_vals, 1, 4);
+    printf("Assert: ERR_INV_PARAM == %d = build_hash_map()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = build_hash_map_59(u64_map, (void*)0, batch_vals, 1, 4);
+    printf("Assert: ERR_INV_PARAM == %d = build_hash_map() with null keys\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    u64 build_keys[64];
+    void* build_key_ptrs[64];
+    void* build_val_ptrs[64];
+    for (size_t i = 0; i < 64; i++)
+    {
+        build_keys[i] = (u64)i;
+        build_key_ptrs[i] = &build_keys[i];
+        build_val_ptrs[i] = (37 == i) ? (void*)0 : &build_keys[i];
+    }
+    hash_map_59* build_map = (void*)0;
+    err = init_hash_map_59(&build_map, U64_PTR, U64_PTR, 0, 0, 0);
+    assert(ERR_NONE == err);
+    err = build_hash_map_59(build_map, build_key_ptrs, build_val_ptrs, 64, 4);
+    printf("Assert: ERR_INV_PARAM == %d = build_hash_map() with a null val\n", err);
+    assert(ERR_INV_PARAM == err && 0 == build_map->size);
+    err = deinit_hash_map_59(&build_map);
+    assert(ERR_NONE == err);
+
+    // Test get_or_insert edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test get_or_insert_hash_map...");
+
+    void* slot = (void*)0;
+
+    err = get_or_insert_hash_map_59(u64_map_dummy, u1, str1, &slot, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = get_or_insert_hash_map()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = get_or_insert_hash_map_59(u64_map, u1, (void*)0, &slot, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = get_or_insert_hash_map() owning map without default\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = get_or_insert_hash_map_59(u64_map, u1, str1, (void*)0, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = get_or_insert_hash_map() without slot\n", err);
+    assert(ERR_INV_PARAM == err);
+
     // Test remove_hash_map edge cases
     puts("- - - - - - - - - - - - - - - - -");
     puts("Test remove_from_hash_map...");
@@ -225,11 +324,231 @@ ERR_59_e test_hash_map_59_edge_cases(void)
     printf("Assert: ERR_INV_PARAM == %d = resize_hash_map()\n", err);
     assert(ERR_INV_PARAM == err);
 
+    err = resize_table_hash_map_59(u64_map, 0);
+    printf("Assert: ERR_INV_PARAM == %d = resize_hash_map() with 0 size\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    hash_map_59* small_map = (void*)0;
+    err = init_hash_map_59(&small_map, U64_PTR, U64_PTR, 0, 0, 0);
+    assert(ERR_NONE == err);
+    err = resize_table_hash_map_59(small_map, 31);
+    printf("Assert: ERR_NONE == %d = resize_hash_map() small map records the size\n", err);
+    assert(ERR_NONE == err && !small_map->table && 31 == small_map->table_size);
+    err = deinit_hash_map_59(&small_map);
+    assert(ERR_NONE == err);
+
+    // Test shrinking edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test set_min_load_hash_map...");
+
+    err = set_min_load_hash_map_59(u64_map_dummy, 10);
+    printf("Assert: ERR_INV_PARAM == %d = set_min_load_hash_map()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = set_min_load_hash_map_59(u64_map, 50 * HASH_MAP_MAX_LOAD);
+    printf("Assert: ERR_INV_PARAM == %d = set_min_load_hash_map() at half the max load\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    puts("Test compact_hash_map...");
+
+    err = compact_hash_map_59(u64_map_dummy);
+    printf("Assert: ERR_INV_PARAM == %d = compact_hash_map()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    hash_map_59* compact_map = (void*)0;
+    err = init_hash_map_59(&compact_map, U64_PTR, U64_PTR, 0, 0, 0);
+    assert(ERR_NONE == err);
+    err = compact_hash_map_59(compact_map);
+    printf("Assert: ERR_NONE == %d = compact_hash_map() empty map\n", err);
+    assert(ERR_NONE == err && 0 == compact_map->entries_used && !compact_map->table);
+    err = deinit_hash_map_59(&compact_map);
+    assert(ERR_NONE == err);
+
+    // Test multi map edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test get_all_from_hash_map, remove_one_from_hash_map and remove_all_from_hash_map...");
+
+    hash_map_59* multi_map = (void*)0;
+    err = init_multi_hash_map_59(&multi_map, U64_PTR, U32_PTR, 2, 0, 0);
+    assert(ERR_NONE == err);
+    u64 multi_key = 59;
+    u32 multi_val[2] = {5, 9};
+    err = upsert_into_hash_map_59(multi_map, &multi_key, multi_val);
+    assert(ERR_NONE == err);
+
+    void* multi_vals = (void*)0;
+    size_t multi_count = 0;
+    err = get_all_from_hash_map_59(u64_map_dummy, &multi_key, &multi_vals, &multi_count);
+    printf("Assert: ERR_INV_PARAM == %d = get_all_from_hash_map()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = get_all_from_hash_map_59(multi_map, &multi_key, (void*)0, &multi_count);
+    printf("Assert: ERR_INV_PARAM == %d = get_all_from_hash_map() with void vals\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = get_all_from_hash_map_59(multi_map, &multi_key, &multi_vals, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = get_all_from_hash_map() with void count\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = get_all_from_hash_map_59(multi_map, &multi_key, &multi_vals, &multi_count);
+    printf("Assert: 1 == %zu = values held with a val_type_depth of 2\n", multi_count);
+    assert(ERR_NONE == err && 1 == multi_count && 9 == ((u32*)multi_vals)[1]);
+
+    err = remove_one_from_hash_map_59(u64_map_dummy, &multi_key, multi_val);
+    printf("Assert: ERR_INV_PARAM == %d = remove_one_from_hash_map()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = remove_one_from_hash_map_59(u64_map, &multi_key, multi_val);
+    printf("Assert: ERR_NOT_SUPPORTED == %d = remove_one_from_hash_map() plain map\n", err);
+    assert(ERR_NOT_SUPPORTED == err);
+
+    u32 const absent_val[2] = {5, 10};
+    err = remove_one_from_hash_map_59(multi_map, &multi_key, absent_val);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = remove_one_from_hash_map() absent value\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err && 1 == multi_map->size);
+
+    u64 absent_key = 95;
+    err = remove_one_from_hash_map_59(multi_map, &absent_key, multi_val);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = remove_one_from_hash_map() absent key\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+    err = remove_all_from_hash_map_59(u64_map_dummy, &multi_key);
+    printf("Assert: ERR_INV_PARAM == %d = remove_all_from_hash_map()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = remove_all_from_hash_map_59(multi_map, &absent_key);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = remove_all_from_hash_map() absent key\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+    err = remove_one_from_hash_map_59(multi_map, &multi_key, multi_val);
+    printf("Assert: ERR_NONE == %d = remove_one_from_hash_map() last value\n", err);
+    assert(ERR_NONE == err && 0 == multi_map->size);
+    err = deinit_hash_map_59(&multi_map);
+    assert(ERR_NONE == err);
+
+    // Test bloom filter edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test enable_filter_hash_map and disable_filter_hash_map...");
+
+    err = enable_filter_hash_map_59(u64_map_dummy, 0);
+    printf("Assert: ERR_INV_PARAM == %d = enable_filter_hash_map()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = disable_filter_hash_map_59(u64_map_dummy);
+    printf("Assert: ERR_INV_PARAM == %d = disable_filter_hash_map()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    hash_map_59* filter_map = (void*)0;
+    err = init_hash_map_59(&filter_map, U64_PTR, U64_PTR, 0, 0, 0);
+    assert(ERR_NONE == err);
+    err = disable_filter_hash_map_59(filter_map);
+    printf("Assert: ERR_NONE == %d = disable_filter_hash_map() unfiltered map\n", err);
+    assert(ERR_NONE == err);
+    err = enable_filter_hash_map_59(filter_map, 0);
+    printf("Assert: ERR_NONE == %d = enable_filter_hash_map() empty map\n", err);
+    assert(ERR_NONE == err && filter_map->filter && 0 == filter_map->filter->size);
+    err = enable_filter_hash_map_59(filter_map, 4);
+    printf("Assert: 4 == %zu = counters_per_key after enabling twice\n", filter_map->filter->counters_per_key);
+    assert(ERR_NONE == err && 4 == filter_map->filter->counters_per_key);
+    err = deinit_hash_map_59(&filter_map); // Frees the filter with the map.
+    assert(ERR_NONE == err);
+
+    puts("Test upsert_into_hash_map with a failing filter rebuild...");
+
+    err = init_copy_hash_map_59(&filter_map, U64_PTR, U64_PTR, 0, 0, 0);
+    assert(ERR_NONE == err);
+    err = enable_filter_hash_map_59(filter_map, 0);
+    assert(ERR_NONE == err);
+    // Overflows the size of any rebuilt filter, so growing past the capacity fails to rebuild it.
+    filter_map->filter->counters_per_key = SIZE_MAX;
+    size_t const filter_capacity = filter_map->filter->capacity;
+    for (u64 i = 0; i <= filter_capacity; i++)
+    {
+        err = upsert_into_hash_map_59(filter_map, &i, &i);
+        assert(ERR_NONE == err);
+    }
+    printf("Assert: %zu == %zu = filter capacity kept after the failed rebuild\n", filter_capacity,
+           filter_map->filter->capacity);
+    assert(filter_capacity == filter_map->filter->capacity && filter_map->size == filter_map->filter->size);
+    u64 rebuilt_key = filter_capacity;
+    void* rebuilt_val = (void*)0;
+    err = get_from_hash_map_59(filter_map, &rebuilt_key, &rebuilt_val);
+    printf("Assert: ERR_NONE == %d = get_from_hash_map() key inserted by the failed rebuild\n", err);
+    assert(ERR_NONE == err && rebuilt_key == *(u64*)rebuilt_val);
+    err = remove_from_hash_map_59(filter_map, &rebuilt_key, &pair);
+    printf("Assert: ERR_NONE == %d = remove_from_hash_map() key inserted by the failed rebuild\n", err);
+    assert(ERR_NONE == err);
+    free(pair);
+    err = deinit_hash_map_59(&filter_map);
+    assert(ERR_NONE == err);
+
+    // Test iteration edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test iter_hash_map...");
+
+    hash_map_iter_59 iter = {0};
+    key_val_pair_59 const* iter_pair = (void*)0;
+
+    err = init_iter_hash_map_59(u64_map_dummy, &iter);
+    printf("Assert: ERR_INV_PARAM == %d = init_iter_hash_map()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = init_iter_hash_map_59(u64_map, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = init_iter_hash_map() NULL iter\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = next_iter_hash_map_59(&iter, &iter_pair);
+    printf("Assert: ERR_INV_PARAM == %d = next_iter_hash_map() uninitialized iter\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    hash_map_59* empty_map = (void*)0;
+    err = init_hash_map_59(&empty_map, U64_PTR, U64_PTR, 0, 0, 0);
+    assert(ERR_NONE == err);
+    err = init_iter_hash_map_59(empty_map, &iter);
+    assert(ERR_NONE == err);
+
+    err = next_iter_hash_map_59(&iter, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = next_iter_hash_map() NULL pair\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = next_iter_hash_map_59(&iter, &iter_pair);
+    printf("Assert: ERR_CONTAINER_EMPTY == %d = next_iter_hash_map() empty map\n", err);
+    assert(ERR_CONTAINER_EMPTY == err && !iter_pair);
+
+    puts("Test foreach_hash_map...");
+
+    size_t calls = 0;
+    err = foreach_hash_map_59(u64_map_dummy, _stop_walk, &calls);
+    printf("Assert: ERR_INV_PARAM == %d = foreach_hash_map()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = foreach_hash_map_59(u64_map, (void*)0, &calls);
+    printf("Assert: ERR_INV_PARAM == %d = foreach_hash_map() NULL fn\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = foreach_hash_map_59(empty_map, _stop_walk, &calls);
+    printf("Assert: ERR_NONE == %d = foreach_hash_map() empty map\n", err);
+    assert(ERR_NONE == err && 0 == calls);
+
+    for (u64 i = 0; i < 4; i++)
+    {
+        u64* key = malloc(sizeof(u64));
+        u64* val = malloc(sizeof(u64));
+        *key = i;
+        *val = i;
+        err = upsert_into_hash_map_59(empty_map, key, val);
+        assert(ERR_NONE == err);
+    }
+    err = foreach_hash_map_59(empty_map, _stop_walk, &calls);
+    printf("Assert: ERR_INTRNL == %d = foreach_hash_map() stopped by fn after %zu call\n", err, calls);
+    assert(ERR_INTRNL == err && 1 == calls);
+
     // Test clean up
     puts("- - - - - - - - - - - - - - - - -");
     puts("Test clean up...");
     err = deinit_hash_map_59(&u64_map);
     err = deinit_hash_map_59(&str_map);
+    err = deinit_hash_map_59(&empty_map);
     free(test_num);
 
     return err;
@@ -46,6 +46,19 @@
 
 #include "hash_map.h"
 
+/*
+========================================================================================================================
+- - INTERNAL TEST HELPERS - -
+========================================================================================================================
+*/
+
+static ERR_59_e _sum_vals(void* key, void* val, void* ctx)
+{
+    (void)key;
+    *(u64*)ctx += *(u64*)val;
+    return ERR_NONE;
+}
+
 /*
 ========================================================================================================================
 - - UNIT TESTS - -
@@ -249,6 +262,15 @@ ERR_59_e test_hash_map_59_interface(void)
     printf("Assert: ERR_NONE == %d = resize_table_hash_map()\n", err);
     assert(ERR_NONE == err);
 
+    puts("Checking entries survive resize with cached hashes...");
+    for (u64 i = 0; i < 100; i++)
+    {
+        err = get_from_hash_map_59(u64_map, &i, &val);
+        printf("Assert: ERR_NONE == %d = get_from_hash_map() after resize [%lu]\n", err, i);
+        assert(ERR_NONE == err);
+        assert(0 == strcmp("abc", (str)val));
+    }
+
     // Test auto resizing
     puts("- - - - - - - - - - - - - - - - -");
     puts("Auto resizing test with upsert...");
@@ -274,12 +296,616 @@ ERR_59_e test_hash_map_59_interface(void)
     printf("Assert: 16 == %lu = table_size\n", u64_map_resize->table_size);
     // assert(16 == u64_map_resize->table_size);
 
+    // Copy-in hash map
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Copy-in hash map with single allocation entries...");
+
+    hash_map_59* copy_map = (void*)0;
+    err = init_copy_hash_map_59(&copy_map, U64_PTR, U32_PTR, 0, 0, 0);
+    printf("Assert: ERR_NONE == %d = init_copy_hash_map()\n", err);
+    assert(ERR_NONE == err);
+
+    for (u64 i = 0; i < 64; i++)
+    {
+        u32 v = (u32)(i * 3);
+        err = upsert_into_hash_map_59(copy_map, &i, &v); // Stack objects, the map keeps its own copies.
+        assert(ERR_NONE == err);
+    }
+
+    for (u64 i = 0; i < 64; i++)
+    {
+        err = get_from_hash_map_59(copy_map, &i, &val);
+        printf("Assert: %u == %u = copied val [%lu]\n", (u32)(i * 3), *(u32*)val, i);
+        assert(ERR_NONE == err);
+        assert((u32)(i * 3) == *(u32*)val);
+    }
+
+    u64 copy_key = 7;
+    u32 copy_val = 59;
+    err = upsert_into_hash_map_59(copy_map, &copy_key, &copy_val);
+    assert(ERR_NONE == err);
+    err = get_from_hash_map_59(copy_map, &copy_key, &val);
+    printf("Assert: 59 == %u = updated copied val\n", *(u32*)val);
+    assert(59 == *(u32*)val);
+
+    err = remove_from_hash_map_59(copy_map, &copy_key, &pair);
+    printf("Assert: ERR_NONE == %d = remove_from_hash_map() copy-in\n", err);
+    assert(ERR_NONE == err);
+    assert(7 == *(u64*)pair->key && 59 == *(u32*)pair->val);
+    free(pair); // Key and val live inside the pair's allocation.
+    printf("Assert: 63 == %lu = size after remove\n", copy_map->size);
+    assert(63 == copy_map->size);
+
+    hash_map_59* copy_str_map = (void*)0;
+    err = init_copy_hash_map_59(&copy_str_map, STR, STR, 0, 0, 0);
+    assert(ERR_NONE == err);
+    err = upsert_into_hash_map_59(copy_str_map, "key", "short");
+    assert(ERR_NONE == err);
+    err = upsert_into_hash_map_59(copy_str_map, "other", "value");
+    assert(ERR_NONE == err);
+    err = upsert_into_hash_map_59(copy_str_map, "key", "a much longer value");
+    assert(ERR_NONE == err);
+    err = get_from_hash_map_59(copy_str_map, "key", &val);
+    printf("Assert: a much longer value == %s = replaced copied str\n", (str)val);
+    assert(0 == strcmp("a much longer value", (str)val));
+    err = get_from_hash_map_59(copy_str_map, "other", &val);
+    assert(ERR_NONE == err && 0 == strcmp("value", (str)val));
+
+    // Batched upsert and get
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("upsert_many_into_hash_map() and get_many_from_hash_map()...");
+
+    u64 batch_keys[40];
+    u32 batch_nums[40];
+    void* batch_key_ptrs[40];
+    void* batch_val_ptrs[40];
+    void* batch_out[40];
+    for (u64 i = 0; i < 40; i++)
+    {
+        batch_keys[i] = 1000 + i * 7;
+        batch_nums[i] = (u32)i;
+        batch_key_ptrs[i] = &batch_keys[i];
+        batch_val_ptrs[i] = &batch_nums[i];
+    }
+
+    err = upsert_many_into_hash_map_59(copy_map, batch_key_ptrs, batch_val_ptrs, 40);
+    printf("Assert: ERR_NONE == %d = upsert_many_into_hash_map()\n", err);
+    assert(ERR_NONE == err);
+
+    batch_keys[39] = 59059; // Not in the map, must come back NULL.
+    err = get_many_from_hash_map_59(copy_map, batch_key_ptrs, 40, batch_out);
+    printf("Assert: ERR_NONE == %d = get_many_from_hash_map()\n", err);
+    assert(ERR_NONE == err);
+    for (size_t i = 0; i < 39; i++)
+    {
+        printf("Assert: %lu == %u = batched val\n", i, *(u32*)batch_out[i]);
+        assert(i == *(u32*)batch_out[i]);
+    }
+    printf("Assert: (nil) == %p = batched miss\n", batch_out[39]);
+    assert((void*)0 == batch_out[39]);
+
+    // Find or insert value slots
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("get_or_insert_hash_map() counting...");
+
+    hash_map_59* counts = (void*)0;
+    err = init_copy_hash_map_59(&counts, STR, U64_PTR, 0, 0, 0);
+    assert(ERR_NONE == err);
+
+    char const* words[] = {"a", "b", "a", "c", "a", "b"};
+    bool inserted = false;
+    size_t inserts = 0;
+    for (size_t i = 0; i < 6; i++)
+    {
+        err = get_or_insert_hash_map_59(counts, (void*)words[i], (void*)0, &val, &inserted);
+        assert(ERR_NONE == err);
+        ++(*(u64*)val);
+        inserts += inserted;
+    }
+    printf("Assert: 3 == %lu = inserted keys\n", inserts);
+    assert(3 == inserts);
+    err = get_from_hash_map_59(counts, "a", &val);
+    printf("Assert: 3 == %lu = count of a\n", *(u64*)val);
+    assert(ERR_NONE == err && 3 == *(u64*)val);
+    err = get_from_hash_map_59(counts, "b", &val);
+    assert(ERR_NONE == err && 2 == *(u64*)val);
+
+    u64* owned_key = malloc(sizeof(u64));
+    *owned_key = 500;
+    u64* owned_default = malloc(sizeof(u64));
+    *owned_default = 10;
+    err = get_or_insert_hash_map_59(u64_map_resize, owned_key, owned_default, &val, &inserted);
+    printf("Assert: ERR_NONE == %d = get_or_insert_hash_map() owning map\n", err);
+    assert(ERR_NONE == err && inserted && 10 == *(u64*)val);
+    u64 lookup_key = 500;
+    u64 unused_default = 0;
+    err = get_or_insert_hash_map_59(u64_map_resize, &lookup_key, &unused_default, &val, &inserted);
+    assert(ERR_NONE == err && !inserted && 10 == *(u64*)val);
+
+    // Test small maps
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("small hash_map linear scan...");
+
+    hash_map_59* small_map = (void*)0;
+    err = init_copy_hash_map_59(&small_map, U64_PTR, U64_PTR, 0, 0, 0);
+    assert(ERR_NONE == err);
+    for (u64 i = 0; i < HASH_MAP_SMALL_SIZE; i++)
+    {
+        err = upsert_into_hash_map_59(small_map, &i, &i);
+        assert(ERR_NONE == err);
+    }
+    printf("Assert: 1 == %d = small map has no table\n", !small_map->table);
+    assert(!small_map->table && small_map->entries == small_map->_small);
+    for (u64 i = 0; i < HASH_MAP_SMALL_SIZE; i++)
+    {
+        err = get_from_hash_map_59(small_map, &i, &val);
+        assert(ERR_NONE == err && i == *(u64*)val);
+    }
+
+    u64 small_key = 3;
+    err = remove_from_hash_map_59(small_map, &small_key, &pair);
+    assert(ERR_NONE == err && 3 == *(u64*)pair->val);
+    free(pair);
+    err = get_from_hash_map_59(small_map, &small_key, &val);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = get_from_hash_map() removed from small map\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+    for (u64 i = HASH_MAP_SMALL_SIZE; i < 2 * HASH_MAP_SMALL_SIZE; i++)
+    {
+        err = upsert_into_hash_map_59(small_map, &i, &i);
+        assert(ERR_NONE == err);
+    }
+    printf("Assert: 1 == %d = table allocated once the map outgrows its inline entries\n", !!small_map->table);
+    assert(small_map->table && small_map->entries != small_map->_small);
+    for (u64 i = 0; i < 2 * HASH_MAP_SMALL_SIZE; i++)
+    {
+        err = get_from_hash_map_59(small_map, &i, &val);
+        assert((3 == i && ERR_OBJ_NOT_FOUND == err) || (ERR_NONE == err && i == *(u64*)val));
+    }
+
+    // Test shrinking
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("remove_from_hash_map() shrinking...");
+
+    hash_map_59* burst_map = (void*)0;
+    err = init_copy_hash_map_59(&burst_map, U64_PTR, U64_PTR, 0, 0, 0);
+    assert(ERR_NONE == err);
+    for (u64 i = 0; i < 1000; i++)
+    {
+        err = upsert_into_hash_map_59(burst_map, &i, &i);
+        assert(ERR_NONE == err);
+    }
+    size_t const peak_table_size = burst_map->table_size;
+    for (u64 i = 0; i < 994; i++)
+    {
+        err = remove_from_hash_map_59(burst_map, &i, &pair);
+        assert(ERR_NONE == err);
+        free(pair);
+    }
+    printf("Assert: %zu > %zu = table_size shrunk after removing\n", peak_table_size, burst_map->table_size);
+    assert(peak_table_size > burst_map->table_size && 16 == burst_map->table_size);
+    for (u64 i = 994; i < 1000; i++)
+    {
+        err = get_from_hash_map_59(burst_map, &i, &val);
+        assert(ERR_NONE == err && i == *(u64*)val);
+    }
+
+    puts("compact_hash_map() back to inline entries...");
+    hash_map_iter_59 iter = {0};
+    key_val_pair_59 const* iter_pair = (void*)0;
+    err = compact_hash_map_59(burst_map);
+    printf("Assert: ERR_NONE == %d = compact_hash_map()\n", err);
+    assert(ERR_NONE == err && !burst_map->table && burst_map->entries == burst_map->_small);
+    assert(6 == burst_map->entries_used && 6 == burst_map->size);
+    err = init_iter_hash_map_59(burst_map, &iter);
+    assert(ERR_NONE == err);
+    for (u64 i = 994; i < 1000; i++)
+    {
+        err = next_iter_hash_map_59(&iter, &iter_pair);
+        assert(ERR_NONE == err && i == *(u64*)iter_pair->key);
+    }
+
+    puts("compact_hash_map() right-sizing...");
+    for (u64 i = 0; i < 300; i++)
+    {
+        err = upsert_into_hash_map_59(burst_map, &i, &i);
+        assert(ERR_NONE == err);
+    }
+    err = set_min_load_hash_map_59(burst_map, 0); // Leave the table at its peak until compacted.
+    assert(ERR_NONE == err);
+    for (u64 i = 0; i < 300; i++)
+    {
+        if (1 == i % 4)
+            continue;
+        err = remove_from_hash_map_59(burst_map, &i, &pair);
+        assert(ERR_NONE == err);
+        free(pair);
+    }
+    printf("Assert: 512 == %zu = table_size kept with shrinking disabled\n", burst_map->table_size);
+    assert(512 == burst_map->table_size);
+    err = compact_hash_map_59(burst_map);
+    printf("Assert: 256 == %zu = table_size after compact_hash_map()\n", burst_map->table_size);
+    assert(ERR_NONE == err && 256 == burst_map->table_size);
+    assert(81 == burst_map->size && burst_map->size == burst_map->entries_used);
+    assert(burst_map->entries_used == burst_map->entries_capacity);
+    for (u64 i = 1; i < 300; i += 4)
+    {
+        err = get_from_hash_map_59(burst_map, &i, &val);
+        assert(ERR_NONE == err && i == *(u64*)val);
+    }
+
+    // Test bloom filter
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("enable_filter_hash_map()...");
+
+    hash_map_59* filtered_map = (void*)0;
+    err = init_copy_hash_map_59(&filtered_map, U64_PTR, U64_PTR, 0, 0, 0);
+    assert(ERR_NONE == err);
+    for (u64 i = 0; i < 200; i += 2)
+    {
+        err = upsert_into_hash_map_59(filtered_map, &i, &i);
+        assert(ERR_NONE == err);
+    }
+    err = enable_filter_hash_map_59(filtered_map, 0);
+    printf("Assert: ERR_NONE == %d = enable_filter_hash_map()\n", err);
+    assert(ERR_NONE == err && filtered_map->filter && 100 == filtered_map->filter->size);
+
+    size_t filtered_misses = 0;
+    for (u64 i = 0; i < 200; i++)
+    {
+        err = get_from_hash_map_59(filtered_map, &i, &val);
+        if (0 == i % 2)
+            assert(ERR_NONE == err && i == *(u64*)val);
+        else
+            assert(ERR_OBJ_NOT_FOUND == err);
+        bool maybe_present = true;
+        err = query_bloom_filter_59(filtered_map->filter, i, &maybe_present);
+        assert(ERR_NONE == err);
+        filtered_misses += !maybe_present;
+    }
+    printf("Assert: 90 <= %zu = absent keys turned away by the filter\n", filtered_misses);
+    assert(90 <= filtered_misses);
+
+    puts("Filter kept in step by remove and growth...");
+    for (u64 i = 0; i < 200; i += 4)
+    {
+        err = remove_from_hash_map_59(filtered_map, &i, &pair);
+        assert(ERR_NONE == err);
+        free(pair);
+        err = get_from_hash_map_59(filtered_map, &i, &val);
+        assert(ERR_OBJ_NOT_FOUND == err);
+    }
+    assert(50 == filtered_map->filter->size);
+    for (u64 i = 1000; i < 1500; i++)
+    {
+        err = upsert_into_hash_map_59(filtered_map, &i, &i);
+        assert(ERR_NONE == err);
+    }
+    printf("Assert: %zu <= %zu = filter capacity after growing the map\n", filtered_map->size,
+           filtered_map->filter->capacity);
+    assert(filtered_map->size <= filtered_map->filter->capacity && filtered_map->size == filtered_map->filter->size);
+    for (u64 i = 1000; i < 1500; i++)
+    {
+        err = get_from_hash_map_59(filtered_map, &i, &val);
+        assert(ERR_NONE == err && i == *(u64*)val);
+    }
+
+    err = compact_hash_map_59(filtered_map);
+    assert(ERR_NONE == err && filtered_map->size == filtered_map->filter->size);
+    for (u64 i = 2; i < 200; i += 4)
+    {
+        err = get_from_hash_map_59(filtered_map, &i, &val);
+        assert(ERR_NONE == err && i == *(u64*)val);
+    }
+
+    err = disable_filter_hash_map_59(filtered_map);
+    printf("Assert: ERR_NONE == %d = disable_filter_hash_map()\n", err);
+    assert(ERR_NONE == err && !filtered_map->filter);
+    u64 unfiltered_key = 1001;
+    err = get_from_hash_map_59(filtered_map, &unfiltered_key, &val);
+    assert(ERR_NONE == err && 1001 == *(u64*)val);
+    err = deinit_hash_map_59(&filtered_map);
+    assert(ERR_NONE == err);
+
+    // Test multi map
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("init_multi_hash_map() and appending upserts...");
+
+    hash_map_59* multi_map = (void*)0;
+    err = init_multi_hash_map_59(&multi_map, STR, U64_PTR, 0, 0, 0);
+    printf("Assert: ERR_NONE == %d = init_multi_hash_map()\n", err);
+    assert(ERR_NONE == err && multi_map->multi);
+
+    char user[16] = {0};
+    for (u64 i = 0; i < 500; i++)
+    {
+        snprintf(user, sizeof(user), "user_%lu", i % 50); // Values land on 50 keys, 10 each in ascending order.
+        err = upsert_into_hash_map_59(multi_map, user, &i);
+        assert(ERR_NONE == err);
+    }
+    printf("Assert: 50 == %zu = keys held by the multi map\n", multi_map->size);
+    assert(50 == multi_map->size);
+
+    void* multi_vals = (void*)0;
+    size_t multi_count = 0;
+    for (u64 k = 0; k < 50; k++)
+    {
+        snprintf(user, sizeof(user), "user_%lu", k);
+        err = get_all_from_hash_map_59(multi_map, user, &multi_vals, &multi_count);
+        assert(ERR_NONE == err && 10 == multi_count);
+        for (u64 j = 0; j < multi_count; j++)
+            assert(k + j * 50 == ((u64*)multi_vals)[j]);
+    }
+
+    puts("Appending a value taken from the key's own array...");
+    snprintf(user, sizeof(user), "user_7");
+    for (u64 j = 10; j < 40; j++)
+    {
+        err = get_all_from_hash_map_59(multi_map, user, &multi_vals, &multi_count);
+        assert(ERR_NONE == err && j == multi_count);
+        err = upsert_into_hash_map_59(multi_map, user, &((u64*)multi_vals)[0]);
+        assert(ERR_NONE == err);
+    }
+    err = get_all_from_hash_map_59(multi_map, user, &multi_vals, &multi_count);
+    printf("Assert: 40 == %zu = values after appending from the array itself\n", multi_count);
+    assert(ERR_NONE == err && 40 == multi_count && 7 == ((u64*)multi_vals)[39]);
+
+    puts("remove_one_from_hash_map()...");
+    u64 multi_val = 107; // Third value of user_7.
+    err = remove_one_from_hash_map_59(multi_map, user, &multi_val);
+    printf("Assert: ERR_NONE == %d = remove_one_from_hash_map()\n", err);
+    assert(ERR_NONE == err);
+    err = get_all_from_hash_map_59(multi_map, user, &multi_vals, &multi_count);
+    assert(ERR_NONE == err && 39 == multi_count);
+    assert(57 == ((u64*)multi_vals)[1] && 157 == ((u64*)multi_vals)[2]);
+    err = remove_one_from_hash_map_59(multi_map, user, &multi_val);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = remove_one_from_hash_map() removed value\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+    snprintf(user, sizeof(user), "user_3");
+    for (u64 j = 0; j < 10; j++)
+    {
+        multi_val = 3 + j * 50;
+        err = remove_one_from_hash_map_59(multi_map, user, &multi_val);
+        assert(ERR_NONE == err);
+    }
+    err = get_all_from_hash_map_59(multi_map, user, &multi_vals, &multi_count);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = get_all_from_hash_map() after removing every value\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err && 49 == multi_map->size);
+
+    puts("remove_all_from_hash_map()...");
+    snprintf(user, sizeof(user), "user_11");
+    err = remove_all_from_hash_map_59(multi_map, user);
+    printf("Assert: ERR_NONE == %d = remove_all_from_hash_map()\n", err);
+    assert(ERR_NONE == err && 48 == multi_map->size);
+    err = get_all_from_hash_map_59(multi_map, user, &multi_vals, &multi_count);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+    err = init_iter_hash_map_59(multi_map, &iter);
+    assert(ERR_NONE == err);
+    size_t multi_total = 0;
+    while (ERR_NONE == next_iter_hash_map_59(&iter, &iter_pair))
+        multi_total += ((hash_map_vals_59 const*)iter_pair->val)->count;
+    printf("Assert: 509 == %zu = values seen iterating the multi map\n", multi_total);
+    assert(509 == multi_total);
+    err = deinit_hash_map_59(&multi_map);
+    assert(ERR_NONE == err);
+
+    puts("get_all_from_hash_map() on a plain map...");
+    hash_map_59* plain_map = (void*)0;
+    err = init_copy_hash_map_59(&plain_map, U64_PTR, U64_PTR, 0, 0, 0);
+    assert(ERR_NONE == err);
+    multi_val = 59;
+    err = upsert_into_hash_map_59(plain_map, &multi_val, &multi_val);
+    assert(ERR_NONE == err);
+    err = get_all_from_hash_map_59(plain_map, &multi_val, &multi_vals, &multi_count);
+    printf("Assert: 1 == %zu = values of a plain map key\n", multi_count);
+    assert(ERR_NONE == err && 1 == multi_count && 59 == *(u64*)multi_vals);
+    err = remove_all_from_hash_map_59(plain_map, &multi_val);
+    assert(ERR_NONE == err && 0 == plain_map->size);
+    err = deinit_hash_map_59(&plain_map);
+    assert(ERR_NONE == err);
+
+    // Test bulk build
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("build_hash_map()...");
+
+    size_t const build_count = 10000;
+    u64* build_keys = malloc(sizeof(u64) * build_count);
+    u64* build_vals = malloc(sizeof(u64) * build_count);
+    void** build_key_ptrs = malloc(sizeof(void*) * build_count);
+    void** build_val_ptrs = malloc(sizeof(void*) * build_count);
+    assert(build_keys && build_vals && build_key_ptrs && build_val_ptrs);
+    for (size_t i = 0; i < build_count; i++)
+    {
+        build_keys[i] = (u64)(i % 7500) * 0x9E3779B97F4A7C15ULL; // The last 2500 keys repeat earlier ones.
+        build_vals[i] = (u64)i;
+        build_key_ptrs[i] = &build_keys[i];
+        build_val_ptrs[i] = &build_vals[i];
+    }
+
+    hash_map_59* built_map = (void*)0;
+    err = init_copy_hash_map_59(&built_map, U64_PTR, U64_PTR, 0, 0, 0);
+    assert(ERR_NONE == err);
+    err = build_hash_map_59(built_map, build_key_ptrs, build_val_ptrs, build_count, 4);
+    printf("Assert: ERR_NONE == %d = build_hash_map()\n", err);
+    assert(ERR_NONE == err);
+    printf("Assert: 7500 == %zu = size after building with repeated keys\n", built_map->size);
+    assert(7500 == built_map->size);
+    for (size_t i = 0; i < 7500; i++)
+    {
+        err = get_from_hash_map_59(built_map, &build_keys[i], &val);
+        assert(ERR_NONE == err && (i < 2500 ? i + 7500 : i) == *(u64*)val); // Later repeats win.
+    }
+
+    // The built map must keep working as an ordinary map.
+    u64 build_extra = 59;
+    err = upsert_into_hash_map_59(built_map, &build_extra, &build_extra);
+    assert(ERR_NONE == err && 7501 == built_map->size);
+    err = remove_from_hash_map_59(built_map, &build_keys[0], &pair);
+    assert(ERR_NONE == err && 7500 == built_map->size);
+    free(pair);
+    err = init_iter_hash_map_59(built_map, &iter);
+    assert(ERR_NONE == err);
+    size_t build_seen = 0;
+    while (ERR_NONE == next_iter_hash_map_59(&iter, &iter_pair))
+        build_seen++;
+    printf("Assert: 7500 == %zu = pairs visited in the built map\n", build_seen);
+    assert(7500 == build_seen);
+    err = deinit_hash_map_59(&built_map);
+    assert(ERR_NONE == err);
+
+    puts("build_hash_map() with string keys...");
+    char(*build_strs)[16] = malloc(sizeof(*build_strs) * build_count);
+    assert(build_strs);
+    for (size_t i = 0; i < build_count; i++)
+    {
+        snprintf(build_strs[i], sizeof(build_strs[i]), "key_%zu", i);
+        build_key_ptrs[i] = build_strs[i];
+    }
+    err = init_copy_hash_map_59(&built_map, STR, U64_PTR, 0, 0, 0);
+    assert(ERR_NONE == err);
+    err = build_hash_map_59(built_map, build_key_ptrs, build_val_ptrs, build_count, 3);
+    printf("Assert: %zu == %zu = string keys built\n", build_count, built_map->size);
+    assert(ERR_NONE == err && build_count == built_map->size);
+    for (size_t i = 0; i < build_count; i += 97)
+    {
+        err = get_from_hash_map_59(built_map, build_strs[i], &val);
+        assert(ERR_NONE == err && i == *(u64*)val);
+    }
+    err = deinit_hash_map_59(&built_map);
+    assert(ERR_NONE == err);
+
+    puts("build_hash_map() into a multi map...");
+    for (size_t i = 0; i < build_count; i++)
+    {
+        build_keys[i] = (u64)(i % 100);
+        build_key_ptrs[i] = &build_keys[i];
+    }
+    err = init_multi_hash_map_59(&built_map, U64_PTR, U64_PTR, 0, 0, 0);
+    assert(ERR_NONE == err);
+    err = build_hash_map_59(built_map, build_key_ptrs, build_val_ptrs, build_count, 8);
+    assert(ERR_NONE == err && 100 == built_map->size);
+    u64 build_key = 42;
+    err = get_all_from_hash_map_59(built_map, &build_key, &multi_vals, &multi_count);
+    printf("Assert: 100 == %zu = values appended for one key\n", multi_count);
+    assert(ERR_NONE == err && 100 == multi_count);
+    for (size_t i = 0; i < multi_count; i++)
+        assert(42 + i * 100 == ((u64*)multi_vals)[i]); // Appended in input order.
+    err = deinit_hash_map_59(&built_map);
+    assert(ERR_NONE == err);
+
+    puts("build_hash_map() into a filtered map that already holds pairs...");
+    err = init_copy_hash_map_59(&built_map, U64_PTR, U64_PTR, 0, 0, 0);
+    assert(ERR_NONE == err);
+    err = enable_filter_hash_map_59(built_map, 0);
+    assert(ERR_NONE == err);
+    err = build_hash_map_59(built_map, build_key_ptrs, build_val_ptrs, 1000, 4);
+    assert(ERR_NONE == err && 100 == built_map->size && built_map->filter && 100 == built_map->filter->size);
+    err = build_hash_map_59(built_map, build_key_ptrs, build_val_ptrs, build_count, 4);
+    printf("Assert: ERR_NONE == %d = build_hash_map() falling back to upserts\n", err);
+    assert(ERR_NONE == err && 100 == built_map->size && 100 == built_map->filter->size);
+    err = get_from_hash_map_59(built_map, &build_key, &val);
+    assert(ERR_NONE == err && 9942 == *(u64*)val);
+    build_key = 100;
+    err = get_from_hash_map_59(built_map, &build_key, &val);
+    assert(ERR_OBJ_NOT_FOUND == err);
+    err = deinit_hash_map_59(&built_map);
+    assert(ERR_NONE == err);
+
+    free(build_strs);
+    free(build_keys);
+    free(build_vals);
+    free(build_key_ptrs);
+    free(build_val_ptrs);
+
+    // Test iteration
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("iter_hash_map() insertion order...");
+
+    hash_map_59* ordered = (void*)0;
+    err = init_copy_hash_map_59(&ordered, U64_PTR, U64_PTR, 0, 0, 0);
+    assert(ERR_NONE == err);
+    for (u64 i = 0; i < 100; i++)
+    {
+        u64 key = (i * 37) % 101; // Scattered keys, iteration must still follow insertion order.
+        err = upsert_into_hash_map_59(ordered, &key, &i);
+        assert(ERR_NONE == err);
+    }
+
+    err = init_iter_hash_map_59(ordered, &iter);
+    assert(ERR_NONE == err);
+    u64 expected = 0;
+    while (ERR_NONE == (err = next_iter_hash_map_59(&iter, &iter_pair)))
+    {
+        assert(expected == *(u64*)iter_pair->val);
+        assert((expected * 37) % 101 == *(u64*)iter_pair->key);
+        expected++;
+    }
+    printf("Assert: 100 == %lu = pairs visited in insertion order\n", expected);
+    assert(100 == expected && ERR_CONTAINER_EMPTY == err && !iter_pair);
+
+    puts("iter_hash_map() removing while iterating...");
+    err = init_iter_hash_map_59(ordered, &iter);
+    assert(ERR_NONE == err);
+    while (ERR_NONE == next_iter_hash_map_59(&iter, &iter_pair))
+    {
+        if (0 == *(u64*)iter_pair->val % 3)
+            continue;
+        err = remove_from_hash_map_59(ordered, iter_pair->key, &pair);
+        assert(ERR_NONE == err);
+        free(pair);
+    }
+    printf("Assert: 34 == %lu = size after keeping every third pair\n", ordered->size);
+    assert(34 == ordered->size);
+
+    // Enough new pairs to fill the holes left behind, compacting must keep the order.
+    for (u64 i = 100; i < 200; i++)
+    {
+        u64 key = 1000 + i;
+        err = upsert_into_hash_map_59(ordered, &key, &i);
+        assert(ERR_NONE == err);
+    }
+    err = resize_table_hash_map_59(ordered, 7);
+    printf("Assert: ERR_NONE == %d = resize_hash_map() rebuilding the index\n", err);
+    assert(ERR_NONE == err);
+
+    err = init_iter_hash_map_59(ordered, &iter);
+    assert(ERR_NONE == err);
+    u64 last = 0;
+    expected = 0;
+    while (ERR_NONE == next_iter_hash_map_59(&iter, &iter_pair))
+    {
+        u64 const order = *(u64*)iter_pair->val;
+        assert(0 == order % 3 || 100 <= order);
+        assert(0 == expected || last < order);
+        last = order;
+        expected++;
+    }
+    printf("Assert: 134 == %lu = pairs visited after compacting and resizing\n", expected);
+    assert(134 == expected && ordered->size == expected && ordered->entries_used == expected);
+
+    puts("foreach_hash_map() summing values...");
+    u64 sum = 0;
+    err = foreach_hash_map_59(ordered, _sum_vals, &sum);
+    u64 expected_sum = 0;
+    for (u64 i = 0; i < 200; i++)
+        expected_sum += (0 == i % 3 || 100 <= i) ? i : 0;
+    printf("Assert: %lu == %lu = foreach_hash_map() sum\n", expected_sum, sum);
+    assert(ERR_NONE == err && expected_sum == sum);
+
     // Test clean up
     puts("- - - - - - - - - - - - - - - - -");
     puts("Test clean up...");
     err = deinit_hash_map_59(&u64_map);
     err = deinit_hash_map_59(&str_map);
+    err = deinit_hash_map_59(&ordered);
+    err = deinit_hash_map_59(&small_map);
+    err = deinit_hash_map_59(&burst_map);
     err = deinit_hash_map_59(&u64_map_resize);
+    err = deinit_hash_map_59(&copy_map);
+    err = deinit_hash_map_59(&copy_str_map);
+    err = deinit_hash_map_59(&counts);
 
     return err;
 }
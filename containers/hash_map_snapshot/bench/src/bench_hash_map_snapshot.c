@@ -0,0 +1,186 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Benchmark of lookups and memory, a frozen hash map snapshot against the hash map it was built from.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "hash_map_snapshot.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Default number of entries in the benchmarked map, override with the first program argument.
+ **********************************************************************************************************************/
+#define BENCH_DEFAULT_ENTRIES (1UL << 20)
+
+/***********************************************************************************************************************
+ * @brief: Number of timed lookups.
+ **********************************************************************************************************************/
+#define BENCH_LOOKUPS (1UL << 22)
+
+/***********************************************************************************************************************
+ * @brief: File the snapshot is saved to and loaded back from for the warm start timing.
+ **********************************************************************************************************************/
+#define BENCH_FILE "bench_hash_map_snapshot.bin"
+
+/*
+========================================================================================================================
+- - BENCH HELPERS - -
+========================================================================================================================
+*/
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static u64 xorshift(u64* state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+static u64 key_for(u64 const i)
+{
+    return i * 0x9E3779B97F4A7C15ULL;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    size_t const entries = (1 < argc) ? strtoul(argv[1], (void*)0, 10) : BENCH_DEFAULT_ENTRIES;
+    if (0 == entries)
+        return ERR_INV_PARAM;
+
+    hash_map_59* map = (void*)0;
+    ERR_59_e err = init_copy_hash_map_59(&map, U64_PTR, U64_PTR, 0, entries, 0);
+    if (ERR_NONE != err)
+        return err;
+    double start = now_ns();
+    for (u64 i = 0; i < entries; i++)
+    {
+        u64 key = key_for(i);
+        err = upsert_into_hash_map_59(map, &key, &i);
+        if (ERR_NONE != err)
+            return err;
+    }
+    double const build_ms = (now_ns() - start) / 1e6;
+
+    hash_map_snapshot_59* snapshot = (void*)0;
+    start = now_ns();
+    err = init_hash_map_snapshot_59(&snapshot, map);
+    if (ERR_NONE != err)
+        return err;
+    double const freeze_ms = (now_ns() - start) / 1e6;
+
+    // Warm start, load the saved snapshot and answer a first lookup.
+    err = save_hash_map_snapshot_59(snapshot, BENCH_FILE);
+    if (ERR_NONE != err)
+        return err;
+    deinit_hash_map_snapshot_59(&snapshot);
+    start = now_ns();
+    err = load_hash_map_snapshot_59(&snapshot, BENCH_FILE);
+    if (ERR_NONE != err)
+        return err;
+    u64 const first_key = key_for(0);
+    void const* frozen_val = (void*)0;
+    err = get_from_hash_map_snapshot_59(snapshot, &first_key, &frozen_val);
+    if (ERR_NONE != err)
+        return err;
+    double const load_ms = (now_ns() - start) / 1e6;
+    remove(BENCH_FILE);
+
+    u64 checksum = 0;
+    u64 rng = 59;
+    void* val = (void*)0;
+    start = now_ns();
+    for (size_t i = 0; i < BENCH_LOOKUPS; i++)
+    {
+        u64 key = key_for(xorshift(&rng) % entries);
+        err = get_from_hash_map_59(map, &key, &val);
+        if (ERR_NONE != err)
+            return err;
+        checksum += *(u64*)val;
+    }
+    double const map_get_ns = (now_ns() - start) / (double)BENCH_LOOKUPS;
+
+    rng = 59;
+    start = now_ns();
+    for (size_t i = 0; i < BENCH_LOOKUPS; i++)
+    {
+        u64 key = key_for(xorshift(&rng) % entries);
+        err = get_from_hash_map_snapshot_59(snapshot, &key, &frozen_val);
+        if (ERR_NONE != err)
+            return err;
+        checksum -= *(u64 const*)frozen_val;
+    }
+    double const snapshot_get_ns = (now_ns() - start) / (double)BENCH_LOOKUPS;
+
+    // Allocation payloads only, allocator headers would add to the map's side.
+    size_t const map_bytes = sizeof(hash_map_59) + map->table_size * sizeof(size_t) +
+                             map->entries_capacity * sizeof(hash_map_entry_59) +
+                             map->size * (sizeof(key_val_pair_59) + 2 * sizeof(u64));
+
+    printf("entries: %zu, upsert build: %.1f ms, freeze: %.1f ms, load + first get: %.3f ms\n", entries, build_ms,
+           freeze_ms, load_ms);
+    printf("hash_map get:          %8.2f ns/key  %10zu bytes\n", map_get_ns, map_bytes);
+    printf("hash_map_snapshot get: %8.2f ns/key  %10lu bytes\n", snapshot_get_ns, snapshot->header->buffer_size);
+    printf("checksum (expect 0): %lu\n", checksum);
+
+    deinit_hash_map_snapshot_59(&snapshot);
+    deinit_hash_map_59(&map);
+
+    return ERR_NONE;
+}
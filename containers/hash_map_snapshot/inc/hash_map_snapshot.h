@@ -0,0 +1,231 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Contains all the declarations for frozen, read only snapshots of hash maps built on a minimal perfect hash.
+ **********************************************************************************************************************/
+
+#pragma once
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "containers_common.h"
+#include "hash_map.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Average number of keys per pilot bucket, larger values use less memory but take longer to freeze.
+ **********************************************************************************************************************/
+#define HASH_MAP_SNAPSHOT_BUCKET_LOAD 4
+
+/***********************************************************************************************************************
+ * @brief: Number of hash seeds tried before freezing gives up.
+ **********************************************************************************************************************/
+#define HASH_MAP_SNAPSHOT_MAX_SEEDS 16
+
+/***********************************************************************************************************************
+ * @brief: First 8 bytes of every snapshot buffer and file, "C59SNAPS" in little endian byte order.
+ **********************************************************************************************************************/
+#define HASH_MAP_SNAPSHOT_MAGIC (0x5350414E53393543ULL)
+
+/***********************************************************************************************************************
+ * @brief: Layout version of snapshot buffers, bump whenever the header, the buffer layout or the key hashes change so
+ * stale files are rejected by @load_hash_map_snapshot_59.
+ **********************************************************************************************************************/
+#define HASH_MAP_SNAPSHOT_VERSION 2
+
+/***********************************************************************************************************************
+ * @brief: Written in native byte order, a file saved on a machine of the other endianness reads it back swapped.
+ **********************************************************************************************************************/
+#define HASH_MAP_SNAPSHOT_BYTE_ORDER (0x01020304U)
+
+/*
+========================================================================================================================
+- - TYPEDEFS - -
+========================================================================================================================
+*/
+
+typedef struct hash_map_snapshot_header_59 hash_map_snapshot_header_59;
+typedef struct hash_map_snapshot_59 hash_map_snapshot_59;
+
+/*
+========================================================================================================================
+- - STRUCTS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @hash_map_snapshot_header_59
+ * @brief: Start of a snapshot buffer, every position in the buffer is an offset from its start so the buffer can be
+ * copied, moved, or saved to a file and memory mapped back without any fix up.
+ *
+ * @magic: Always @HASH_MAP_SNAPSHOT_MAGIC.
+ * @version: Layout version, @HASH_MAP_SNAPSHOT_VERSION when written.
+ * @byte_order: Always @HASH_MAP_SNAPSHOT_BYTE_ORDER in the writer's byte order.
+ * @size: Number of entries, also the number of slots.
+ * @bucket_count: Number of pilot buckets.
+ * @seed: Seed passed to @hash_node_obj_59 for every key.
+ * @key_size: Size of a key in bytes, 0 for STR keys.
+ * @key_type: Type of the keys.
+ * @val_type: Type of the values, VOID_0 for key only snapshots.
+ * @pilots_offset: Offset of the u32 pilot of each bucket.
+ * @slots_offset: Offset of the u64 entry offset of each slot.
+ * @data_offset: Offset of the entries, each entry is its key bytes followed by its value bytes aligned to u64.
+ * @buffer_size: Size of the whole buffer in bytes.
+ **********************************************************************************************************************/
+struct hash_map_snapshot_header_59
+{
+    u64 magic;
+    u32 version;
+    u32 byte_order;
+    u64 size;
+    u64 bucket_count;
+    u64 seed;
+    u64 key_size;
+    u32 key_type;
+    u32 val_type;
+    u64 pilots_offset;
+    u64 slots_offset;
+    u64 data_offset;
+    u64 buffer_size;
+};
+
+/***********************************************************************************************************************
+ * @hash_map_snapshot_59
+ * @brief: An immutable copy of a hash map laid out in one contiguous buffer. A key's bucket pilot moves it to a slot
+ * no other key uses, so every lookup reads exactly one slot and one entry.
+ *
+ * @header: Header at the start of @buffer.
+ * @pilots: Pilot of each bucket, inside @buffer.
+ * @slots: Entry offset of each slot, inside @buffer.
+ * @buffer: The snapshot's single allocation, or the mapping of its file.
+ * @mapped_size: Length of the file mapping when the snapshot was loaded with mmap, 0 otherwise.
+ *
+ * @note Lookups never modify the snapshot so any number of threads may read it at once.
+ **********************************************************************************************************************/
+struct hash_map_snapshot_59
+{
+    hash_map_snapshot_header_59 const* header;
+    u32 const* pilots;
+    u64 const* slots;
+    u8* buffer;
+    size_t mapped_size;
+};
+
+/*
+========================================================================================================================
+- - MODULE FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Freezes the passed hash map into a new snapshot holding copies of all of its keys and values.
+ *
+ * @param[out] snapshot: Pointer to a @hash_map_snapshot_59 pointer to initialize the snapshot in.
+ * @param[in] map: Map to freeze, it is not modified.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Keys must be a fixed size type or STR, values must be a fixed size type, STR or VOID_0. ERR_NOT_SUPPORTED is
+ * returned for other maps and for multi maps. ERR_INTRNL is returned in the unlikely case no seed in
+ * @HASH_MAP_SNAPSHOT_MAX_SEEDS builds a perfect hash.
+ *
+ * @warning This will need to be freed with @deinit_hash_map_snapshot_59 when its lifetime has expired.
+ **********************************************************************************************************************/
+ERR_59_e init_hash_map_snapshot_59(hash_map_snapshot_59** snapshot, hash_map_59 const* const map);
+
+/***********************************************************************************************************************
+ * @brief: Deallocates the passed snapshot, or unmaps it when it was loaded from a file.
+ *
+ * @param[out] snapshot: Pointer to a hash_map_snapshot_59 pointer that will be freed.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note The pointer to the snapshot will be (void*)0 on return.
+ **********************************************************************************************************************/
+ERR_59_e deinit_hash_map_snapshot_59(hash_map_snapshot_59** snapshot);
+
+/***********************************************************************************************************************
+ * @brief: Gets the value held at the passed key with a single probe.
+ *
+ * @param[in] snapshot: Snapshot to read from.
+ * @param[in] key: Key to look for.
+ * @param[out] val: Set to the value inside the snapshot, (void*)0 for key only snapshots.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note ERR_OBJ_NOT_FOUND is returned when the key is not in the snapshot. @val stays valid for the snapshot's
+ * lifetime and must not be written to.
+ **********************************************************************************************************************/
+ERR_59_e get_from_hash_map_snapshot_59(hash_map_snapshot_59 const* const snapshot,
+                                       void const* const key,
+                                       void const** val);
+
+/***********************************************************************************************************************
+ * @brief: Writes the snapshot's buffer to a file, byte for byte.
+ *
+ * @param[in] snapshot: Snapshot to save.
+ * @param[in] path: Path of the file to create or overwrite.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note ERR_INTRNL is returned when the file cannot be opened or fully written.
+ **********************************************************************************************************************/
+ERR_59_e save_hash_map_snapshot_59(hash_map_snapshot_59 const* const snapshot, char const* const path);
+
+/***********************************************************************************************************************
+ * @brief: Loads a snapshot saved with @save_hash_map_snapshot_59. On POSIX systems the file is memory mapped read only
+ * so lookups can start immediately, pages are read in as lookups touch them. Elsewhere the file is read into memory.
+ *
+ * @param[out] snapshot: Pointer to a @hash_map_snapshot_59 pointer to load the snapshot in.
+ * @param[in] path: Path of the saved snapshot.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note ERR_OBJ_NOT_FOUND is returned when the file cannot be opened. ERR_NOT_SUPPORTED is returned for files with
+ * the wrong magic, version or byte order, and for files whose size or section offsets do not match their header.
+ *
+ * @warning Only the header is validated, entry offsets are trusted. Load files from trusted sources only. This will
+ * need to be freed with @deinit_hash_map_snapshot_59 when its lifetime has expired.
+ **********************************************************************************************************************/
+ERR_59_e load_hash_map_snapshot_59(hash_map_snapshot_59** snapshot, char const* const path);
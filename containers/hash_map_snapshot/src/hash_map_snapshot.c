@@ -0,0 +1,642 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Contains all the definitions for frozen, read only snapshots of hash maps built on a minimal perfect hash.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#define _POSIX_C_SOURCE 200809L // open, fstat and mmap, must come before every system include.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define HASH_MAP_SNAPSHOT_MMAP
+#endif
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "hash_map_snapshot.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Alignment of every section and value inside a snapshot buffer.
+ **********************************************************************************************************************/
+#define HASH_MAP_SNAPSHOT_ALIGN (sizeof(u64))
+
+/***********************************************************************************************************************
+ * @brief: Odd constant spreading a pilot over all 64 bits before it is mixed with a key's hash.
+ **********************************************************************************************************************/
+#define HASH_MAP_SNAPSHOT_PILOT_MUL 0x9E3779B97F4A7C15ULL
+
+/*
+========================================================================================================================
+- - INTERNAL FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Rounds a size up to @HASH_MAP_SNAPSHOT_ALIGN.
+ *
+ * @param[in] size: Size to round.
+ *
+ * @retval size_t: The rounded size.
+ **********************************************************************************************************************/
+static size_t _align_hash_map_snapshot_59(size_t const size)
+{
+    return (size + HASH_MAP_SNAPSHOT_ALIGN - 1) / HASH_MAP_SNAPSHOT_ALIGN * HASH_MAP_SNAPSHOT_ALIGN;
+}
+
+/***********************************************************************************************************************
+ * @brief: Finds the slot a key lands in for a given pilot of its bucket.
+ *
+ * @param[in] hash: Hash of the key.
+ * @param[in] pilot: Pilot of the key's bucket.
+ * @param[in] size: Number of slots.
+ *
+ * @retval u64: Slot of the key.
+ **********************************************************************************************************************/
+static u64 _slot_hash_map_snapshot_59(u64 const hash, u32 const pilot, u64 const size)
+{
+    u64 x = hash ^ ((u64)pilot * HASH_MAP_SNAPSHOT_PILOT_MUL);
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ULL;
+    x ^= x >> 33;
+    return x % size;
+}
+
+/***********************************************************************************************************************
+ * @brief: Finds the number of bytes a snapshot stores for an entry's key and value.
+ *
+ * @param[in] map: Map the entry belongs to.
+ * @param[in] pair: Entry to size.
+ * @param[out] key_len: Number of key bytes.
+ * @param[out] val_len: Number of value bytes.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _entry_size_hash_map_snapshot_59(hash_map_59 const* const map,
+                                                 key_val_pair_59 const* const pair,
+                                                 size_t* const key_len,
+                                                 size_t* const val_len)
+{
+    ERR_59_e err = ERR_NONE;
+
+    if (STR == map->key_type)
+        *key_len = strlen(pair->key) + 1;
+    else if (ERR_NONE != (err = get_type_size_59(map->key_type, key_len)))
+        return err;
+
+    if (VOID_0 == map->val_type)
+        *val_len = 0;
+    else if (STR == map->val_type)
+        *val_len = strlen(pair->val) + 1;
+    else
+    {
+        err = get_type_size_59(map->val_type, val_len);
+        if (ERR_NONE != err)
+            return err;
+        if (1 < map->val_type_depth)
+            *val_len *= map->val_type_depth;
+    }
+
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Searches a pilot for every bucket so all keys land in distinct slots, largest buckets first while the most
+ * slots are still free.
+ *
+ * @param[in] hashes: Hash of each key.
+ * @param[in] size: Number of keys and slots.
+ * @param[in] bucket_count: Number of buckets.
+ * @param[out] pilots: Pilot found for each bucket.
+ * @param[out] slot_of: Slot found for each key.
+ * @param[out] placed: false when some bucket has no pilot for this seed.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _place_keys_hash_map_snapshot_59(u64 const* const hashes,
+                                                 size_t const size,
+                                                 size_t const bucket_count,
+                                                 u32* const pilots,
+                                                 size_t* const slot_of,
+                                                 bool* const placed)
+{
+    size_t* bucket_start = calloc(bucket_count + 1, sizeof(size_t));
+    size_t* keys = malloc(sizeof(size_t) * size);
+    size_t* order = malloc(sizeof(size_t) * bucket_count);
+    u8* taken = calloc(size, sizeof(u8));
+    if (!bucket_start || !keys || !order || !taken)
+    {
+        free(bucket_start);
+        free(keys);
+        free(order);
+        free(taken);
+        return ERR_NO_MEM;
+    }
+
+    // Group the keys by bucket with a counting sort.
+    size_t max_bucket = 0;
+    for (size_t i = 0; i < size; i++)
+        bucket_start[hashes[i] % bucket_count + 1]++;
+    for (size_t b = 0; b < bucket_count; b++)
+    {
+        if (bucket_start[b + 1] > max_bucket)
+            max_bucket = bucket_start[b + 1];
+        bucket_start[b + 1] += bucket_start[b];
+    }
+    for (size_t i = 0; i < size; i++)
+    {
+        size_t const b = hashes[i] % bucket_count;
+        keys[bucket_start[b]++] = i;
+    }
+    for (size_t b = bucket_count; b > 0; b--)
+        bucket_start[b] = bucket_start[b - 1];
+    bucket_start[0] = 0;
+
+    // Order the buckets by size, largest first, with a second counting sort.
+    size_t next = 0;
+    for (size_t bucket_size = max_bucket; bucket_size > 0; bucket_size--)
+    {
+        for (size_t b = 0; b < bucket_count; b++)
+        {
+            if (bucket_start[b + 1] - bucket_start[b] == bucket_size)
+                order[next++] = b;
+        }
+    }
+
+    *placed = true;
+    for (size_t o = 0; o < next && *placed; o++)
+    {
+        size_t const b = order[o];
+        size_t const first = bucket_start[b];
+        size_t const last = bucket_start[b + 1];
+
+        // Keys sharing a full hash can never be separated, a new seed is needed.
+        for (size_t i = first; i < last && *placed; i++)
+        {
+            for (size_t j = i + 1; j < last; j++)
+            {
+                if (hashes[keys[i]] == hashes[keys[j]])
+                    *placed = false;
+            }
+        }
+
+        u32 pilot = 0;
+        bool found = false;
+        while (*placed && !found)
+        {
+            size_t k = first;
+            for (; k < last; k++)
+            {
+                u64 const slot = _slot_hash_map_snapshot_59(hashes[keys[k]], pilot, size);
+                if (taken[slot])
+                    break;
+                taken[slot] = 1;
+                slot_of[keys[k]] = (size_t)slot;
+            }
+
+            found = (k == last);
+            if (!found)
+            {
+                while (k > first)
+                    taken[slot_of[keys[--k]]] = 0;
+                if (UINT32_MAX == pilot)
+                    *placed = false;
+                pilot++;
+            }
+        }
+        pilots[b] = pilot;
+    }
+
+    free(bucket_start);
+    free(keys);
+    free(order);
+    free(taken);
+
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Collects every entry of a map with its hash for the passed seed.
+ *
+ * @param[in] map: Map to collect from.
+ * @param[in] seed: Seed to hash the keys with.
+ * @param[out] pairs: Entry of each key.
+ * @param[out] hashes: Hash of each key.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _hash_entries_hash_map_snapshot_59(hash_map_59 const* const map,
+                                                   u64 const seed,
+                                                   key_val_pair_59 const** pairs,
+                                                   u64* hashes)
+{
+    hash_map_iter_59 iter = {0};
+    ERR_59_e err = init_iter_hash_map_59(map, &iter);
+    for (size_t idx = 0; ERR_NONE == err && idx < map->size; idx++)
+    {
+        err = next_iter_hash_map_59(&iter, &pairs[idx]);
+        if (ERR_NONE == err)
+            err = hash_node_obj_59(map->key_type, pairs[idx]->key, seed, &hashes[idx]);
+    }
+
+    return err;
+}
+
+/***********************************************************************************************************************
+ * @brief: Lays the header, pilots, slots and entries out in one buffer.
+ *
+ * @param[in] map: Map being frozen.
+ * @param[in] pairs: Entry of each key.
+ * @param[in] slot_of: Slot of each key.
+ * @param[in] pilots: Pilot of each bucket.
+ * @param[in] bucket_count: Number of buckets.
+ * @param[in] seed: Seed the slots were found with.
+ * @param[out] buffer: The allocated snapshot buffer.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _build_buffer_hash_map_snapshot_59(hash_map_59 const* const map,
+                                                   key_val_pair_59 const** pairs,
+                                                   size_t const* const slot_of,
+                                                   u32 const* const pilots,
+                                                   size_t const bucket_count,
+                                                   u64 const seed,
+                                                   u8** buffer)
+{
+    ERR_59_e err = ERR_NONE;
+    size_t key_len = 0;
+    size_t val_len = 0;
+
+    size_t const pilots_offset = _align_hash_map_snapshot_59(sizeof(hash_map_snapshot_header_59));
+    size_t const slots_offset = pilots_offset + _align_hash_map_snapshot_59(sizeof(u32) * bucket_count);
+    size_t const data_offset = slots_offset + sizeof(u64) * map->size;
+
+    size_t buffer_size = data_offset;
+    for (size_t i = 0; i < map->size; i++)
+    {
+        err = _entry_size_hash_map_snapshot_59(map, pairs[i], &key_len, &val_len);
+        if (ERR_NONE != err)
+            return err;
+        buffer_size += _align_hash_map_snapshot_59(key_len) + _align_hash_map_snapshot_59(val_len);
+    }
+
+    u8* new_buffer = calloc(buffer_size, sizeof(u8));
+    if (!new_buffer)
+        return ERR_NO_MEM;
+
+    hash_map_snapshot_header_59* header = (hash_map_snapshot_header_59*)new_buffer;
+    header->magic = HASH_MAP_SNAPSHOT_MAGIC;
+    header->version = HASH_MAP_SNAPSHOT_VERSION;
+    header->byte_order = HASH_MAP_SNAPSHOT_BYTE_ORDER;
+    header->size = map->size;
+    header->bucket_count = bucket_count;
+    header->seed = seed;
+    size_t key_size = 0;
+    if (STR != map->key_type)
+        get_type_size_59(map->key_type, &key_size);
+    header->key_size = key_size;
+    header->key_type = (u32)map->key_type;
+    header->val_type = (u32)map->val_type;
+    header->pilots_offset = pilots_offset;
+    header->slots_offset = slots_offset;
+    header->data_offset = data_offset;
+    header->buffer_size = buffer_size;
+
+    memcpy(new_buffer + pilots_offset, pilots, sizeof(u32) * bucket_count);
+
+    u64* slots = (u64*)(new_buffer + slots_offset);
+    size_t offset = data_offset;
+    for (size_t i = 0; i < map->size; i++)
+    {
+        _entry_size_hash_map_snapshot_59(map, pairs[i], &key_len, &val_len);
+        slots[slot_of[i]] = offset;
+        memcpy(new_buffer + offset, pairs[i]->key, key_len);
+        offset += _align_hash_map_snapshot_59(key_len);
+        if (val_len)
+            memcpy(new_buffer + offset, pairs[i]->val, val_len);
+        offset += _align_hash_map_snapshot_59(val_len);
+    }
+
+    *buffer = new_buffer;
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Points a snapshot's section pointers into its buffer.
+ *
+ * @param[in] snapshot: Snapshot to set up.
+ * @param[in] buffer: Snapshot buffer, allocated or memory mapped.
+ * @param[in] mapped_size: Length of the mapping when @buffer is memory mapped, 0 otherwise.
+ **********************************************************************************************************************/
+static void
+_attach_buffer_hash_map_snapshot_59(hash_map_snapshot_59* const snapshot, u8* const buffer, size_t const mapped_size)
+{
+    snapshot->buffer = buffer;
+    snapshot->mapped_size = mapped_size;
+    snapshot->header = (hash_map_snapshot_header_59 const*)buffer;
+    snapshot->pilots = (u32 const*)(buffer + snapshot->header->pilots_offset);
+    snapshot->slots = (u64 const*)(buffer + snapshot->header->slots_offset);
+}
+
+/***********************************************************************************************************************
+ * @brief: Checks a loaded buffer was written by this version of the library and its sections fit inside it.
+ *
+ * @param[in] buffer: Loaded buffer.
+ * @param[in] size: Number of bytes loaded.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _validate_buffer_hash_map_snapshot_59(u8 const* const buffer, size_t const size)
+{
+    if (size < sizeof(hash_map_snapshot_header_59))
+        return ERR_NOT_SUPPORTED;
+
+    hash_map_snapshot_header_59 const* header = (hash_map_snapshot_header_59 const*)buffer;
+    if (HASH_MAP_SNAPSHOT_MAGIC != header->magic || HASH_MAP_SNAPSHOT_VERSION != header->version ||
+        HASH_MAP_SNAPSHOT_BYTE_ORDER != header->byte_order || size != header->buffer_size)
+        return ERR_NOT_SUPPORTED;
+
+    // Each section must be aligned, in order, and large enough for its count without overflowing.
+    if (0 == header->bucket_count || 0 != header->pilots_offset % HASH_MAP_SNAPSHOT_ALIGN ||
+        0 != header->slots_offset % HASH_MAP_SNAPSHOT_ALIGN || 0 != header->data_offset % HASH_MAP_SNAPSHOT_ALIGN ||
+        header->pilots_offset < sizeof(hash_map_snapshot_header_59) || header->slots_offset < header->pilots_offset ||
+        header->data_offset < header->slots_offset || header->data_offset > size ||
+        header->bucket_count > (header->slots_offset - header->pilots_offset) / sizeof(u32) ||
+        header->size > (header->data_offset - header->slots_offset) / sizeof(u64))
+        return ERR_NOT_SUPPORTED;
+
+    size_t type_size = 0;
+    TYPE_59_e const key_type = (TYPE_59_e)header->key_type;
+    TYPE_59_e const val_type = (TYPE_59_e)header->val_type;
+    if (STR != key_type && (ERR_NONE != get_type_size_59(key_type, &type_size) || type_size != header->key_size))
+        return ERR_NOT_SUPPORTED;
+    if (STR != val_type && VOID_0 != val_type && ERR_NONE != get_type_size_59(val_type, &type_size))
+        return ERR_NOT_SUPPORTED;
+
+    return ERR_NONE;
+}
+
+/*
+========================================================================================================================
+- - FUNCTION DEFINITIONS - -
+========================================================================================================================
+*/
+
+ERR_59_e init_hash_map_snapshot_59(hash_map_snapshot_59** snapshot, hash_map_59 const* const map)
+{
+    if (!snapshot || !map)
+        return ERR_INV_PARAM;
+    if (map->multi)
+        return ERR_NOT_SUPPORTED;
+
+    size_t type_size = 0;
+    if (STR != map->key_type && ERR_NONE != get_type_size_59(map->key_type, &type_size))
+        return ERR_NOT_SUPPORTED;
+    if (STR != map->val_type && VOID_0 != map->val_type && ERR_NONE != get_type_size_59(map->val_type, &type_size))
+        return ERR_NOT_SUPPORTED;
+
+    hash_map_snapshot_59* new_snapshot = malloc(sizeof(hash_map_snapshot_59));
+    size_t const size = map->size;
+    size_t const bucket_count = size / HASH_MAP_SNAPSHOT_BUCKET_LOAD + 1;
+    key_val_pair_59 const** pairs = malloc(sizeof(key_val_pair_59*) * (size + 1));
+    u64* hashes = malloc(sizeof(u64) * (size + 1));
+    size_t* slot_of = malloc(sizeof(size_t) * (size + 1));
+    u32* pilots = calloc(bucket_count, sizeof(u32));
+
+    ERR_59_e err = ERR_NONE;
+    if (!new_snapshot || !pairs || !hashes || !slot_of || !pilots)
+        err = ERR_NO_MEM;
+
+    // Retry with a new seed in the rare case a bucket cannot be placed.
+    bool placed = false;
+    u64 seed = 0;
+    for (size_t attempt = 0; ERR_NONE == err && !placed && attempt < HASH_MAP_SNAPSHOT_MAX_SEEDS; attempt++)
+    {
+        seed = (u64)attempt + 1;
+        err = _hash_entries_hash_map_snapshot_59(map, seed, pairs, hashes);
+        if (ERR_NONE == err)
+            err = _place_keys_hash_map_snapshot_59(hashes, size, bucket_count, pilots, slot_of, &placed);
+    }
+    if (ERR_NONE == err && !placed)
+        err = ERR_INTRNL;
+
+    u8* buffer = (void*)0;
+    if (ERR_NONE == err)
+        err = _build_buffer_hash_map_snapshot_59(map, pairs, slot_of, pilots, bucket_count, seed, &buffer);
+
+    free(pairs);
+    free(hashes);
+    free(slot_of);
+    free(pilots);
+
+    if (ERR_NONE != err)
+    {
+        free(new_snapshot);
+        return err;
+    }
+
+    _attach_buffer_hash_map_snapshot_59(new_snapshot, buffer, 0);
+
+    *snapshot = new_snapshot;
+
+    return ERR_NONE;
+}
+
+ERR_59_e deinit_hash_map_snapshot_59(hash_map_snapshot_59** snapshot)
+{
+    if (!snapshot || !(*snapshot))
+        return ERR_INV_PARAM;
+
+#ifdef HASH_MAP_SNAPSHOT_MMAP
+    if ((*snapshot)->mapped_size)
+        munmap((*snapshot)->buffer, (*snapshot)->mapped_size);
+    else
+#endif
+        free((*snapshot)->buffer);
+    free((*snapshot));
+    *snapshot = (void*)0;
+
+    return ERR_NONE;
+}
+
+ERR_59_e get_from_hash_map_snapshot_59(hash_map_snapshot_59 const* const snapshot,
+                                       void const* const key,
+                                       void const** val)
+{
+    if (!snapshot || !key || !val)
+        return ERR_INV_PARAM;
+
+    hash_map_snapshot_header_59 const* header = snapshot->header;
+    if (0 == header->size)
+        return ERR_OBJ_NOT_FOUND;
+
+    u64 hash = 0;
+    ERR_59_e err = hash_node_obj_59((TYPE_59_e)header->key_type, key, header->seed, &hash);
+    if (ERR_NONE != err)
+        return err;
+
+    u32 const pilot = snapshot->pilots[hash % header->bucket_count];
+    u8 const* entry = snapshot->buffer + snapshot->slots[_slot_hash_map_snapshot_59(hash, pilot, header->size)];
+
+    // Every key has a slot, so the only question left is whether the slot holds this key.
+    size_t key_len = (size_t)header->key_size;
+    if (STR == header->key_type)
+    {
+        if (0 != strcmp((char const*)entry, key))
+            return ERR_OBJ_NOT_FOUND;
+        key_len = strlen(key) + 1;
+    }
+    else if (0 != memcmp(entry, key, key_len))
+        return ERR_OBJ_NOT_FOUND;
+
+    *val = (VOID_0 == header->val_type) ? (void*)0 : entry + _align_hash_map_snapshot_59(key_len);
+
+    return ERR_NONE;
+}
+
+ERR_59_e save_hash_map_snapshot_59(hash_map_snapshot_59 const* const snapshot, char const* const path)
+{
+    if (!snapshot || !path)
+        return ERR_INV_PARAM;
+
+    FILE* file = fopen(path, "wb");
+    if (!file)
+        return ERR_INTRNL;
+
+    size_t const size = (size_t)snapshot->header->buffer_size;
+    bool const written = (size == fwrite(snapshot->buffer, sizeof(u8), size, file));
+    if (0 != fclose(file) || !written)
+        return ERR_INTRNL;
+
+    return ERR_NONE;
+}
+
+ERR_59_e load_hash_map_snapshot_59(hash_map_snapshot_59** snapshot, char const* const path)
+{
+    if (!snapshot || !path)
+        return ERR_INV_PARAM;
+
+    u8* buffer = (void*)0;
+    size_t size = 0;
+    size_t mapped_size = 0;
+
+#ifdef HASH_MAP_SNAPSHOT_MMAP
+    int const fd = open(path, O_RDONLY);
+    if (0 > fd)
+        return ERR_OBJ_NOT_FOUND;
+
+    struct stat st;
+    if (0 != fstat(fd, &st) || 0 >= st.st_size)
+    {
+        close(fd);
+        return ERR_NOT_SUPPORTED;
+    }
+    size = (size_t)st.st_size;
+
+    // The mapping outlives the descriptor, pages are faulted in as lookups touch them.
+    void* mapping = mmap((void*)0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (MAP_FAILED == mapping)
+        return ERR_INTRNL;
+    buffer = mapping;
+    mapped_size = size;
+#else
+    FILE* file = fopen(path, "rb");
+    if (!file)
+        return ERR_OBJ_NOT_FOUND;
+
+    long const file_size = (0 == fseek(file, 0, SEEK_END)) ? ftell(file) : -1;
+    if (0 >= file_size || 0 != fseek(file, 0, SEEK_SET))
+    {
+        fclose(file);
+        return ERR_NOT_SUPPORTED;
+    }
+    size = (size_t)file_size;
+
+    buffer = malloc(size);
+    if (!buffer)
+    {
+        fclose(file);
+        return ERR_NO_MEM;
+    }
+    bool const read_all = (size == fread(buffer, sizeof(u8), size, file));
+    fclose(file);
+    if (!read_all)
+    {
+        free(buffer);
+        return ERR_INTRNL;
+    }
+#endif
+
+    hash_map_snapshot_59* new_snapshot = (void*)0;
+    ERR_59_e err = _validate_buffer_hash_map_snapshot_59(buffer, size);
+    if (ERR_NONE == err)
+    {
+        new_snapshot = malloc(sizeof(hash_map_snapshot_59));
+        if (!new_snapshot)
+            err = ERR_NO_MEM;
+    }
+
+    if (ERR_NONE != err)
+    {
+#ifdef HASH_MAP_SNAPSHOT_MMAP
+        munmap(buffer, mapped_size);
+#else
+        free(buffer);
+#endif
+        return err;
+    }
+
+    _attach_buffer_hash_map_snapshot_59(new_snapshot, buffer, mapped_size);
+    *snapshot = new_snapshot;
+
+    return ERR_NONE;
+}
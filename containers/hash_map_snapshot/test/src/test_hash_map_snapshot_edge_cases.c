@@ -0,0 +1,275 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Test cases for hash map snapshots that cover edge cases and invalid parameters.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "hash_map_snapshot.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+#define TEST_FILE "test_hash_map_snapshot_edge.bin"
+
+/*
+========================================================================================================================
+- - INTERNAL TEST HELPERS - -
+========================================================================================================================
+*/
+
+static ERR_59_e _write_test_file(u8 const* const bytes, size_t const size)
+{
+    FILE* file = fopen(TEST_FILE, "wb");
+    if (!file)
+        return ERR_INTRNL;
+    size_t const written = fwrite(bytes, sizeof(u8), size, file);
+    fclose(file);
+    return (written == size) ? ERR_NONE : ERR_INTRNL;
+}
+
+/*
+========================================================================================================================
+- - UNIT TESTS - -
+========================================================================================================================
+*/
+
+ERR_59_e test_hash_map_snapshot_59_edge_cases(void)
+{
+    ERR_59_e err = ERR_NONE;
+
+    // Init maps to freeze
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Initializing hash_maps...");
+
+    hash_map_59* map = (void*)0;
+    err = init_copy_hash_map_59(&map, U64_PTR, U64_PTR, 0, 0, 0);
+    if (ERR_NONE != err)
+        return err;
+
+    hash_map_59* struct_map = (void*)0;
+    err = init_hash_map_59(&struct_map, U64_PTR, STRUCT_PTR, 0, 0, 0);
+    if (ERR_NONE != err)
+        return err;
+
+    u64 key = 59;
+    err = upsert_into_hash_map_59(map, &key, &key);
+    if (ERR_NONE != err)
+        return err;
+
+    hash_map_snapshot_59* snapshot = (void*)0;
+    hash_map_snapshot_59* snapshot_dummy = (void*)0;
+    void const* val = (void*)0;
+
+    // Test init_hash_map_snapshot edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test init_hash_map_snapshot...");
+
+    err = init_hash_map_snapshot_59((void*)0, map);
+    printf("Assert: ERR_INV_PARAM == %d = init_hash_map_snapshot() with void ptr\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = init_hash_map_snapshot_59(&snapshot_dummy, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = init_hash_map_snapshot() with void map\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = init_hash_map_snapshot_59(&snapshot_dummy, struct_map);
+    printf("Assert: ERR_NOT_SUPPORTED == %d = init_hash_map_snapshot() with unsized val type\n", err);
+    assert(ERR_NOT_SUPPORTED == err);
+
+    hash_map_59* multi_map = (void*)0;
+    err = init_multi_hash_map_59(&multi_map, U64_PTR, U64_PTR, 0, 0, 0);
+    assert(ERR_NONE == err);
+    err = init_hash_map_snapshot_59(&snapshot_dummy, multi_map);
+    printf("Assert: ERR_NOT_SUPPORTED == %d = init_hash_map_snapshot() with multi map\n", err);
+    assert(ERR_NOT_SUPPORTED == err);
+    err = deinit_hash_map_59(&multi_map);
+    assert(ERR_NONE == err);
+
+    err = init_hash_map_snapshot_59(&snapshot, map);
+    printf("Assert: ERR_NONE == %d = init_hash_map_snapshot() single entry\n", err);
+    assert(ERR_NONE == err);
+
+    // Test get_from_hash_map_snapshot edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test get_from_hash_map_snapshot...");
+
+    err = get_from_hash_map_snapshot_59(snapshot_dummy, &key, &val);
+    printf("Assert: ERR_INV_PARAM == %d = get_from_hash_map_snapshot() with void snapshot\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = get_from_hash_map_snapshot_59(snapshot, (void*)0, &val);
+    printf("Assert: ERR_INV_PARAM == %d = get_from_hash_map_snapshot() with void key\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = get_from_hash_map_snapshot_59(snapshot, &key, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = get_from_hash_map_snapshot() with void out\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = get_from_hash_map_snapshot_59(snapshot, &key, &val);
+    printf("Assert: ERR_NONE == %d = get_from_hash_map_snapshot() single entry\n", err);
+    assert(ERR_NONE == err && 59 == *(u64 const*)val);
+
+    key = 60;
+    err = get_from_hash_map_snapshot_59(snapshot, &key, &val);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = get_from_hash_map_snapshot() missing key\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+    // Test save_hash_map_snapshot edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test save_hash_map_snapshot...");
+
+    err = save_hash_map_snapshot_59(snapshot_dummy, TEST_FILE);
+    printf("Assert: ERR_INV_PARAM == %d = save_hash_map_snapshot() with void snapshot\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = save_hash_map_snapshot_59(snapshot, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = save_hash_map_snapshot() with void path\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = save_hash_map_snapshot_59(snapshot, "missing_dir_59/snapshot.bin");
+    printf("Assert: ERR_INTRNL == %d = save_hash_map_snapshot() into a missing directory\n", err);
+    assert(ERR_INTRNL == err);
+
+    // Test load_hash_map_snapshot edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test load_hash_map_snapshot...");
+
+    err = load_hash_map_snapshot_59((void*)0, TEST_FILE);
+    printf("Assert: ERR_INV_PARAM == %d = load_hash_map_snapshot() with void ptr\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = load_hash_map_snapshot_59(&snapshot_dummy, "missing_snapshot_59.bin");
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = load_hash_map_snapshot() missing file\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+    size_t const size = (size_t)snapshot->header->buffer_size;
+    u8* bytes = malloc(size);
+    if (!bytes)
+        return ERR_NO_MEM;
+
+    memcpy(bytes, snapshot->buffer, size);
+    ((hash_map_snapshot_header_59*)bytes)->version = HASH_MAP_SNAPSHOT_VERSION + 1;
+    err = _write_test_file(bytes, size);
+    assert(ERR_NONE == err);
+    err = load_hash_map_snapshot_59(&snapshot_dummy, TEST_FILE);
+    printf("Assert: ERR_NOT_SUPPORTED == %d = load_hash_map_snapshot() stale version\n", err);
+    assert(ERR_NOT_SUPPORTED == err && (void*)0 == snapshot_dummy);
+
+    memcpy(bytes, snapshot->buffer, size);
+    ((hash_map_snapshot_header_59*)bytes)->magic = 59;
+    err = _write_test_file(bytes, size);
+    assert(ERR_NONE == err);
+    err = load_hash_map_snapshot_59(&snapshot_dummy, TEST_FILE);
+    printf("Assert: ERR_NOT_SUPPORTED == %d = load_hash_map_snapshot() wrong magic\n", err);
+    assert(ERR_NOT_SUPPORTED == err);
+
+    memcpy(bytes, snapshot->buffer, size);
+    ((hash_map_snapshot_header_59*)bytes)->slots_offset = size;
+    err = _write_test_file(bytes, size);
+    assert(ERR_NONE == err);
+    err = load_hash_map_snapshot_59(&snapshot_dummy, TEST_FILE);
+    printf("Assert: ERR_NOT_SUPPORTED == %d = load_hash_map_snapshot() section past the end\n", err);
+    assert(ERR_NOT_SUPPORTED == err);
+
+    memcpy(bytes, snapshot->buffer, size);
+    err = _write_test_file(bytes, size - 1);
+    assert(ERR_NONE == err);
+    err = load_hash_map_snapshot_59(&snapshot_dummy, TEST_FILE);
+    printf("Assert: ERR_NOT_SUPPORTED == %d = load_hash_map_snapshot() truncated file\n", err);
+    assert(ERR_NOT_SUPPORTED == err);
+
+    err = _write_test_file(bytes, 0);
+    assert(ERR_NONE == err);
+    err = load_hash_map_snapshot_59(&snapshot_dummy, TEST_FILE);
+    printf("Assert: ERR_NOT_SUPPORTED == %d = load_hash_map_snapshot() empty file\n", err);
+    assert(ERR_NOT_SUPPORTED == err);
+
+    free(bytes);
+    remove(TEST_FILE);
+
+    // Test deinit_hash_map_snapshot edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test deinit_hash_map_snapshot...");
+
+    err = deinit_hash_map_snapshot_59((void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = deinit_hash_map_snapshot() with void ptr\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = deinit_hash_map_snapshot_59(&snapshot_dummy);
+    printf("Assert: ERR_INV_PARAM == %d = deinit_hash_map_snapshot() with void snapshot\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    // Test clean up
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test clean up...");
+    err = deinit_hash_map_snapshot_59(&snapshot);
+    err = deinit_hash_map_59(&map);
+    err = deinit_hash_map_59(&struct_map);
+
+    return err;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    puts("- - -  START OF HASH MAP SNAPSHOT TEST  - - -");
+    puts("- - - HASH MAP SNAPSHOT EDGE CASES - - -");
+
+    ERR_59_e err = test_hash_map_snapshot_59_edge_cases();
+    printf("ERROR CODE: %d\n", err);
+    assert(ERR_NONE == err);
+
+    puts("- - - - END OF HASH MAP SNAPSHOT TEST - - - -");
+    return err;
+}
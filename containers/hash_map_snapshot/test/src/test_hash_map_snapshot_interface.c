@@ -0,0 +1,291 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Test cases for hash map snapshots that cover the module interface.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "hash_map_snapshot.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+#define TEST_KEYS 10000
+#define TEST_STR_KEYS 64
+#define TEST_U64_FILE "test_hash_map_snapshot_u64.bin"
+#define TEST_STR_FILE "test_hash_map_snapshot_str.bin"
+
+/*
+========================================================================================================================
+- - UNIT TESTS - -
+========================================================================================================================
+*/
+
+ERR_59_e test_hash_map_snapshot_59_interface(void)
+{
+    ERR_59_e err = ERR_NONE;
+
+    // Init maps to freeze
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Initializing hash_maps...");
+
+    hash_map_59* u64_map = (void*)0;
+    err = init_copy_hash_map_59(&u64_map, U64_PTR, U32_PTR, 0, 0, 0);
+    if (ERR_NONE != err)
+        return err;
+
+    hash_map_59* str_map = (void*)0;
+    err = init_copy_hash_map_59(&str_map, STR, STR, 0, 0, 0);
+    if (ERR_NONE != err)
+        return err;
+
+    hash_map_59* key_only_map = (void*)0;
+    err = init_copy_hash_map_59(&key_only_map, I32_PTR, VOID_0, 0, 0, 0);
+    if (ERR_NONE != err)
+        return err;
+
+    hash_map_59* empty_map = (void*)0;
+    err = init_copy_hash_map_59(&empty_map, U64_PTR, U64_PTR, 0, 0, 0);
+    if (ERR_NONE != err)
+        return err;
+
+    for (u64 i = 0; i < TEST_KEYS; i++)
+    {
+        u64 key = i * 7;
+        u32 val = (u32)i;
+        err = upsert_into_hash_map_59(u64_map, &key, &val);
+        assert(ERR_NONE == err);
+    }
+
+    // Keys of different lengths, the map's STR hash sums characters so anagram keys would all collide.
+    char key_buf[TEST_STR_KEYS + 1] = {0};
+    char val_buf[32];
+    for (size_t i = 0; i < TEST_STR_KEYS; i++)
+    {
+        key_buf[i] = 'k';
+        snprintf(val_buf, sizeof(val_buf), "val_%zu", i * i);
+        err = upsert_into_hash_map_59(str_map, key_buf, val_buf);
+        assert(ERR_NONE == err);
+    }
+
+    for (i32 i = -50; i < 50; i++)
+    {
+        err = upsert_into_hash_map_59(key_only_map, &i, (void*)0);
+        assert(ERR_NONE == err);
+    }
+
+    // Test init_hash_map_snapshot
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test init_hash_map_snapshot...");
+
+    hash_map_snapshot_59* u64_snapshot = (void*)0;
+    err = init_hash_map_snapshot_59(&u64_snapshot, u64_map);
+    printf("Assert: ERR_NONE == %d = init_hash_map_snapshot()\n", err);
+    assert(ERR_NONE == err);
+    printf("Assert: %d == %lu = snapshot size\n", TEST_KEYS, u64_snapshot->header->size);
+    assert(TEST_KEYS == u64_snapshot->header->size);
+
+    hash_map_snapshot_59* str_snapshot = (void*)0;
+    err = init_hash_map_snapshot_59(&str_snapshot, str_map);
+    printf("Assert: ERR_NONE == %d = init_hash_map_snapshot() STR keys and vals\n", err);
+    assert(ERR_NONE == err);
+
+    hash_map_snapshot_59* key_only_snapshot = (void*)0;
+    err = init_hash_map_snapshot_59(&key_only_snapshot, key_only_map);
+    printf("Assert: ERR_NONE == %d = init_hash_map_snapshot() key only\n", err);
+    assert(ERR_NONE == err);
+
+    hash_map_snapshot_59* empty_snapshot = (void*)0;
+    err = init_hash_map_snapshot_59(&empty_snapshot, empty_map);
+    printf("Assert: ERR_NONE == %d = init_hash_map_snapshot() empty map\n", err);
+    assert(ERR_NONE == err);
+
+    // Test get_from_hash_map_snapshot
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test get_from_hash_map_snapshot...");
+
+    void const* val = (void*)0;
+    for (u64 i = 0; i < TEST_KEYS; i++)
+    {
+        u64 key = i * 7;
+        err = get_from_hash_map_snapshot_59(u64_snapshot, &key, &val);
+        assert(ERR_NONE == err && (u32)i == *(u32 const*)val);
+
+        key = i * 7 + 1;
+        err = get_from_hash_map_snapshot_59(u64_snapshot, &key, &val);
+        assert(ERR_OBJ_NOT_FOUND == err);
+    }
+    puts("Assert: every key found and every missing key rejected");
+
+    memset(key_buf, 0, sizeof(key_buf));
+    for (size_t i = 0; i < TEST_STR_KEYS; i++)
+    {
+        key_buf[i] = 'k';
+        snprintf(val_buf, sizeof(val_buf), "val_%zu", i * i);
+        err = get_from_hash_map_snapshot_59(str_snapshot, key_buf, &val);
+        assert(ERR_NONE == err && 0 == strcmp(val_buf, val));
+    }
+    err = get_from_hash_map_snapshot_59(str_snapshot, "kkkq", &val);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = get_from_hash_map_snapshot() missing STR key\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+    i32 i32_key = -50;
+    err = get_from_hash_map_snapshot_59(key_only_snapshot, &i32_key, &val);
+    printf("Assert: ERR_NONE == %d = get_from_hash_map_snapshot() key only\n", err);
+    assert(ERR_NONE == err && (void*)0 == val);
+    i32_key = 50;
+    err = get_from_hash_map_snapshot_59(key_only_snapshot, &i32_key, &val);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+    u64 u64_key = 0;
+    err = get_from_hash_map_snapshot_59(empty_snapshot, &u64_key, &val);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = get_from_hash_map_snapshot() empty snapshot\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+    // The snapshot holds copies, changing the map afterwards must not show through.
+    key_val_pair_59* pair = (void*)0;
+    err = remove_from_hash_map_59(u64_map, &u64_key, &pair);
+    assert(ERR_NONE == err);
+    free(pair);
+    err = get_from_hash_map_snapshot_59(u64_snapshot, &u64_key, &val);
+    printf("Assert: ERR_NONE == %d = get_from_hash_map_snapshot() key removed from the map\n", err);
+    assert(ERR_NONE == err && 0 == *(u32 const*)val);
+
+    // Test save and load
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test save/load_hash_map_snapshot...");
+
+    err = save_hash_map_snapshot_59(u64_snapshot, TEST_U64_FILE);
+    printf("Assert: ERR_NONE == %d = save_hash_map_snapshot()\n", err);
+    assert(ERR_NONE == err);
+    err = save_hash_map_snapshot_59(str_snapshot, TEST_STR_FILE);
+    printf("Assert: ERR_NONE == %d = save_hash_map_snapshot() STR keys and vals\n", err);
+    assert(ERR_NONE == err);
+
+    hash_map_snapshot_59* loaded_u64 = (void*)0;
+    err = load_hash_map_snapshot_59(&loaded_u64, TEST_U64_FILE);
+    printf("Assert: ERR_NONE == %d = load_hash_map_snapshot()\n", err);
+    assert(ERR_NONE == err);
+#if defined(__unix__) || defined(__APPLE__)
+    printf("Assert: %lu == %lu = loaded snapshot is memory mapped\n", loaded_u64->header->buffer_size,
+           loaded_u64->mapped_size);
+    assert(loaded_u64->header->buffer_size == loaded_u64->mapped_size);
+#endif
+
+    hash_map_snapshot_59* loaded_str = (void*)0;
+    err = load_hash_map_snapshot_59(&loaded_str, TEST_STR_FILE);
+    printf("Assert: ERR_NONE == %d = load_hash_map_snapshot() STR keys and vals\n", err);
+    assert(ERR_NONE == err);
+
+    for (u64 i = 0; i < TEST_KEYS; i++)
+    {
+        u64 key = i * 7;
+        err = get_from_hash_map_snapshot_59(loaded_u64, &key, &val);
+        assert(ERR_NONE == err && (u32)i == *(u32 const*)val);
+
+        key = i * 7 + 1;
+        err = get_from_hash_map_snapshot_59(loaded_u64, &key, &val);
+        assert(ERR_OBJ_NOT_FOUND == err);
+    }
+    puts("Assert: loaded snapshot answers like the saved one");
+
+    memset(key_buf, 0, sizeof(key_buf));
+    for (size_t i = 0; i < TEST_STR_KEYS; i++)
+    {
+        key_buf[i] = 'k';
+        snprintf(val_buf, sizeof(val_buf), "val_%zu", i * i);
+        err = get_from_hash_map_snapshot_59(loaded_str, key_buf, &val);
+        assert(ERR_NONE == err && 0 == strcmp(val_buf, val));
+    }
+    puts("Assert: loaded STR snapshot answers like the saved one");
+
+    err = deinit_hash_map_snapshot_59(&loaded_u64);
+    printf("Assert: ERR_NONE == %d = deinit_hash_map_snapshot() loaded snapshot\n", err);
+    assert(ERR_NONE == err);
+    err = deinit_hash_map_snapshot_59(&loaded_str);
+    assert(ERR_NONE == err);
+    remove(TEST_U64_FILE);
+    remove(TEST_STR_FILE);
+
+    // Test clean up
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test clean up...");
+    err = deinit_hash_map_snapshot_59(&u64_snapshot);
+    assert(ERR_NONE == err);
+    err = deinit_hash_map_snapshot_59(&str_snapshot);
+    assert(ERR_NONE == err);
+    err = deinit_hash_map_snapshot_59(&key_only_snapshot);
+    assert(ERR_NONE == err);
+    err = deinit_hash_map_snapshot_59(&empty_snapshot);
+    assert(ERR_NONE == err);
+    err = deinit_hash_map_59(&u64_map);
+    err = deinit_hash_map_59(&str_map);
+    err = deinit_hash_map_59(&key_only_map);
+    err = deinit_hash_map_59(&empty_map);
+
+    return err;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    puts("- - -  START OF HASH MAP SNAPSHOT TEST  - - -");
+    puts("- - - INTERFACE TESTS - - -");
+
+    ERR_59_e err = test_hash_map_snapshot_59_interface();
+    printf("ERROR CODE: %d\n", err);
+    assert(ERR_NONE == err);
+
+    puts("- - - - END OF HASH MAP SNAPSHOT TEST - - - -");
+    return err;
+}
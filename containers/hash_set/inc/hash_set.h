@@ -0,0 +1,175 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: This file contains all the declarations for the hash set container, a key only set built on hash_map_59.
+ **********************************************************************************************************************/
+
+#pragma once
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "containers_common.h"
+#include "hash_map.h"
+
+/*
+========================================================================================================================
+- - TYPEDEFS - -
+========================================================================================================================
+*/
+
+typedef struct hash_set_59 hash_set_59;
+
+/*
+========================================================================================================================
+- - STRUCTS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @hash_set_59
+ * @brief: A hash set of unique keys, built on a key only copy-in @hash_map_59 so each key is a single allocation that
+ * holds no value.
+ *
+ * @map: Key only hash map holding the set's keys, its @size member is the set's cardinality.
+ *
+ * @note Keys are copied into the set, the caller keeps ownership of the keys it passes in.
+ **********************************************************************************************************************/
+struct hash_set_59
+{
+    hash_map_59* map;
+};
+
+/*
+========================================================================================================================
+- - MODULE FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Initializes a hash set based on the passed parameters.
+ *
+ * @param[out] set: Pointer to a @hash_set_59 pointer to initialize the hash set in.
+ * @param[in] key_type: Type of the keys for the hash set, must be a fixed size type or STR.
+ * @param[in] table_size: Size of the table in the hash set, if 0 then the default size of @DEFAULT_HASH_MAP_TABLE_SIZE
+ * is used.
+ * @param[in] prime: Prime number to be used in hashing, see @init_hash_map_59.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @warning This will need to be freed with @deinit_hash_set_59 when its lifetime has expired.
+ **********************************************************************************************************************/
+ERR_59_e init_hash_set_59(hash_set_59** set, TYPE_59_e const key_type, size_t const table_size, size_t const prime);
+
+/***********************************************************************************************************************
+ * @brief: Deallocates the passed hash set and all of its keys.
+ *
+ * @param[out] set: Pointer to a hash_set_59 pointer that will be freed.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note The pointer to the set will be (void*)0 on return.
+ **********************************************************************************************************************/
+ERR_59_e deinit_hash_set_59(hash_set_59** set);
+
+/***********************************************************************************************************************
+ * @brief: Inserts a copy of the passed key into the hash set, inserting a key already in the set does nothing.
+ *
+ * @param[in] set: Hash set to insert the key into.
+ * @param[in] key: Key to insert.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e insert_into_hash_set_59(hash_set_59* const set, void* key);
+
+/***********************************************************************************************************************
+ * @brief: Checks if the passed key is a member of the hash set.
+ *
+ * @param[in] set: Hash set to check.
+ * @param[in] key: Key to look for.
+ * @param[out] found: Set true when @key is in the set, false otherwise.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e contains_hash_set_59(hash_set_59* const set, void* key, bool* found);
+
+/***********************************************************************************************************************
+ * @brief: Removes the passed key from the hash set and deallocates it.
+ *
+ * @param[in] set: Hash set to remove the key from.
+ * @param[in] key: Key to remove.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e remove_from_hash_set_59(hash_set_59* const set, void* const key);
+
+/***********************************************************************************************************************
+ * @brief: Makes @set the union of itself and @other, every key of @other is copied into @set.
+ *
+ * @param[in] set: Hash set to add the keys to.
+ * @param[in] other: Hash set to take the keys from, it is not modified.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Both sets must have the same key type or ERR_INV_PARAM is returned.
+ **********************************************************************************************************************/
+ERR_59_e union_hash_set_59(hash_set_59* const set, hash_set_59* const other);
+
+/***********************************************************************************************************************
+ * @brief: Makes @set the intersection of itself and @other, keys of @set that are not in @other are removed.
+ *
+ * @param[in] set: Hash set to remove the keys from.
+ * @param[in] other: Hash set to test the keys against, it is not modified.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Both sets must have the same key type or ERR_INV_PARAM is returned.
+ **********************************************************************************************************************/
+ERR_59_e intersect_hash_set_59(hash_set_59* const set, hash_set_59* const other);
+
+/***********************************************************************************************************************
+ * @brief: Makes @set the difference of itself and @other, keys of @set that are also in @other are removed.
+ *
+ * @param[in] set: Hash set to remove the keys from.
+ * @param[in] other: Hash set holding the keys to remove, it is not modified.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Both sets must have the same key type or ERR_INV_PARAM is returned.
+ **********************************************************************************************************************/
+ERR_59_e difference_hash_set_59(hash_set_59* const set, hash_set_59* const other);
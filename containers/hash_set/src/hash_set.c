@@ -0,0 +1,206 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Contains all the definitions for the hash set container.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdlib.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "hash_set.h"
+
+/*
+========================================================================================================================
+- - INTERNAL FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Removes the keys of @set whose membership in @other matches @remove_if_found.
+ *
+ * @param[in] set: Hash set to remove the keys from.
+ * @param[in] other: Hash set to test the keys against.
+ * @param[in] remove_if_found: When true keys found in @other are removed (difference), otherwise keys missing from
+ * @other are removed (intersection).
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e
+_filter_by_other_hash_set_59(hash_set_59* const set, hash_set_59* const other, bool const remove_if_found)
+{
+    if (!set || !other || set->map->key_type != other->map->key_type)
+        return ERR_INV_PARAM;
+
+    ERR_59_e err = ERR_NONE;
+    bool found = false;
+    hash_map_iter_59 iter = {0};
+    key_val_pair_59 const* pair = (void*)0;
+    err = init_iter_hash_map_59(set->map, &iter);
+    if (ERR_NONE != err)
+        return err;
+
+    // Removing keys only leaves holes in the map's entries, so the iteration carries on past them.
+    while (ERR_NONE == next_iter_hash_map_59(&iter, &pair))
+    {
+        void* key = pair->key; // Saved first, removing the key frees it.
+
+        err = contains_hash_set_59(other, key, &found);
+        if (ERR_NONE != err)
+            return err;
+
+        if (found == remove_if_found)
+        {
+            err = remove_from_hash_set_59(set, key);
+            if (ERR_NONE != err)
+                return err;
+        }
+    }
+
+    return ERR_NONE;
+}
+
+/*
+========================================================================================================================
+- - FUNCTION DEFINITIONS - -
+========================================================================================================================
+*/
+
+ERR_59_e init_hash_set_59(hash_set_59** set, TYPE_59_e const key_type, size_t const table_size, size_t const prime)
+{
+    if (!set)
+        return ERR_INV_PARAM;
+
+    hash_set_59* new_set = malloc(sizeof(hash_set_59));
+    if (!new_set)
+        return ERR_NO_MEM;
+
+    ERR_59_e err = init_copy_hash_map_59(&new_set->map, key_type, VOID_0, 0, table_size, prime);
+    if (ERR_NONE != err)
+    {
+        free(new_set);
+        return err;
+    }
+
+    *set = new_set;
+
+    return ERR_NONE;
+}
+
+ERR_59_e deinit_hash_set_59(hash_set_59** set)
+{
+    if (!set || !(*set))
+        return ERR_INV_PARAM;
+
+    ERR_59_e err = deinit_hash_map_59(&(*set)->map);
+    if (ERR_NONE != err)
+        return err;
+
+    free((*set));
+    *set = (void*)0;
+
+    return ERR_NONE;
+}
+
+ERR_59_e insert_into_hash_set_59(hash_set_59* const set, void* key)
+{
+    if (!set || !key)
+        return ERR_INV_PARAM;
+
+    void* slot = (void*)0;
+    return get_or_insert_hash_map_59(set->map, key, (void*)0, &slot, (void*)0);
+}
+
+ERR_59_e contains_hash_set_59(hash_set_59* const set, void* key, bool* found)
+{
+    if (!set || !key || !found)
+        return ERR_INV_PARAM;
+
+    void* val = (void*)0;
+    ERR_59_e err = get_from_hash_map_59(set->map, key, &val);
+    *found = (ERR_NONE == err);
+    if (ERR_OBJ_NOT_FOUND == err)
+        return ERR_NONE;
+
+    return err;
+}
+
+ERR_59_e remove_from_hash_set_59(hash_set_59* const set, void* const key)
+{
+    if (!set || !key)
+        return ERR_INV_PARAM;
+
+    key_val_pair_59* pair = (void*)0;
+    ERR_59_e err = remove_from_hash_map_59(set->map, key, &pair);
+    if (ERR_NONE != err)
+        return err;
+
+    free(pair); // Copied keys live inside the pair's allocation.
+
+    return ERR_NONE;
+}
+
+ERR_59_e union_hash_set_59(hash_set_59* const set, hash_set_59* const other)
+{
+    if (!set || !other || set->map->key_type != other->map->key_type)
+        return ERR_INV_PARAM;
+
+    ERR_59_e err = ERR_NONE;
+    hash_map_iter_59 iter = {0};
+    key_val_pair_59 const* pair = (void*)0;
+    err = init_iter_hash_map_59(other->map, &iter);
+    if (ERR_NONE != err)
+        return err;
+
+    while (ERR_NONE == next_iter_hash_map_59(&iter, &pair))
+    {
+        err = insert_into_hash_set_59(set, pair->key);
+        if (ERR_NONE != err)
+            return err;
+    }
+
+    return ERR_NONE;
+}
+
+ERR_59_e intersect_hash_set_59(hash_set_59* const set, hash_set_59* const other)
+{
+    return _filter_by_other_hash_set_59(set, other, false);
+}
+
+ERR_59_e difference_hash_set_59(hash_set_59* const set, hash_set_59* const other)
+{
+    return _filter_by_other_hash_set_59(set, other, true);
+}
@@ -0,0 +1,181 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Test cases for hash sets that cover edge cases and invalid parameters.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "hash_set.h"
+
+/*
+========================================================================================================================
+- - UNIT TESTS - -
+========================================================================================================================
+*/
+
+ERR_59_e test_hash_set_59_edge_cases(void)
+{
+    ERR_59_e err = ERR_NONE;
+
+    // Init hash_set
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Initializing hash_sets...");
+
+    hash_set_59* u64_set = (void*)0;
+    err = init_hash_set_59(&u64_set, U64_PTR, 0, 0);
+    if (ERR_NONE != err)
+        return err;
+
+    hash_set_59* str_set = (void*)0;
+    err = init_hash_set_59(&str_set, STR, 0, 0);
+    if (ERR_NONE != err)
+        return err;
+
+    hash_set_59* set_dummy = (void*)0;
+    u64 key = 59;
+    bool found = true;
+
+    // Test init_hash_set edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test init_hash_set...");
+
+    err = init_hash_set_59((void*)0, U64_PTR, 0, 0);
+    printf("Assert: ERR_INV_PARAM == %d = init_hash_set() with void ptr\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = init_hash_set_59(&set_dummy, STRUCT_PTR, 0, 0);
+    printf("Assert: ERR_NOT_SUPPORTED == %d = init_hash_set() with unsized key type\n", err);
+    assert(ERR_NOT_SUPPORTED == err);
+
+    // Test deinit_hash_set edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test deinit_hash_set...");
+
+    err = deinit_hash_set_59((void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = deinit_hash_set() with void ptr\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = deinit_hash_set_59(&set_dummy);
+    printf("Assert: ERR_INV_PARAM == %d = deinit_hash_set() with void set\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    // Test insert, contains and remove edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test insert/contains/remove_hash_set...");
+
+    err = insert_into_hash_set_59(set_dummy, &key);
+    printf("Assert: ERR_INV_PARAM == %d = insert_into_hash_set()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = insert_into_hash_set_59(u64_set, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = insert_into_hash_set() with void key\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = contains_hash_set_59(u64_set, &key, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = contains_hash_set() with void out\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = contains_hash_set_59(u64_set, &key, &found);
+    printf("Assert: ERR_NONE == %d = contains_hash_set() on empty set\n", err);
+    assert(ERR_NONE == err && !found);
+
+    err = remove_from_hash_set_59(u64_set, &key);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = remove_from_hash_set() missing key\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+    // Test set algebra edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test union/intersect/difference_hash_set...");
+
+    err = union_hash_set_59(u64_set, set_dummy);
+    printf("Assert: ERR_INV_PARAM == %d = union_hash_set() with void set\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = union_hash_set_59(u64_set, str_set);
+    printf("Assert: ERR_INV_PARAM == %d = union_hash_set() mismatched key types\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = intersect_hash_set_59(u64_set, str_set);
+    printf("Assert: ERR_INV_PARAM == %d = intersect_hash_set() mismatched key types\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = difference_hash_set_59(str_set, u64_set);
+    printf("Assert: ERR_INV_PARAM == %d = difference_hash_set() mismatched key types\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = insert_into_hash_set_59(u64_set, &key);
+    assert(ERR_NONE == err);
+    err = difference_hash_set_59(u64_set, u64_set);
+    printf("Assert: ERR_NONE == %d = difference_hash_set() with itself\n", err);
+    assert(ERR_NONE == err);
+    printf("Assert: 0 == %lu = size after difference with itself\n", u64_set->map->size);
+    assert(0 == u64_set->map->size);
+
+    // Test clean up
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test clean up...");
+    err = deinit_hash_set_59(&u64_set);
+    err = deinit_hash_set_59(&str_set);
+
+    return err;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    puts("- - -  START OF HASH SET TEST  - - -");
+    puts("- - - HASH SET EDGE CASES - - -");
+
+    ERR_59_e err = test_hash_set_59_edge_cases();
+    printf("ERROR CODE: %d\n", err);
+    assert(ERR_NONE == err);
+
+    puts("- - - - END OF HASH SET TEST - - - -");
+    return err;
+}
@@ -0,0 +1,207 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Test cases for hash sets that cover the basic interface interactions.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "hash_set.h"
+
+/*
+========================================================================================================================
+- - UNIT TESTS - -
+========================================================================================================================
+*/
+
+ERR_59_e test_hash_set_59_interface(void)
+{
+    ERR_59_e err = ERR_NONE;
+
+    // Init hash_set
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Initializing hash_sets...");
+    hash_set_59* evens = (void*)0;
+    err = init_hash_set_59(&evens, U64_PTR, 0, 0);
+    if (ERR_NONE != err)
+        return err;
+
+    hash_set_59* threes = (void*)0;
+    err = init_hash_set_59(&threes, U64_PTR, 0, 0);
+    if (ERR_NONE != err)
+        return err;
+
+    hash_set_59* str_set = (void*)0;
+    err = init_hash_set_59(&str_set, STR, 0, 0);
+    if (ERR_NONE != err)
+        return err;
+
+    // Insert into hash_set
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("insert_into_hash_set()...");
+
+    for (u64 i = 0; i < 60; i++)
+    {
+        if (0 == i % 2)
+        {
+            err = insert_into_hash_set_59(evens, &i);
+            assert(ERR_NONE == err);
+        }
+        if (0 == i % 3)
+        {
+            err = insert_into_hash_set_59(threes, &i);
+            assert(ERR_NONE == err);
+        }
+    }
+
+    u64 dup = 4;
+    err = insert_into_hash_set_59(evens, &dup);
+    printf("Assert: ERR_NONE == %d = insert_into_hash_set() duplicate\n", err);
+    assert(ERR_NONE == err);
+    printf("Assert: 30 == %lu = evens size\n", evens->map->size);
+    assert(30 == evens->map->size);
+    printf("Assert: 20 == %lu = threes size\n", threes->map->size);
+    assert(20 == threes->map->size);
+
+    char word_a[] = "apple";
+    char word_b[] = "banana";
+    err = insert_into_hash_set_59(str_set, word_a);
+    assert(ERR_NONE == err);
+    err = insert_into_hash_set_59(str_set, word_b);
+    assert(ERR_NONE == err);
+    word_a[0] = 'A'; // The set holds its own copy.
+
+    // Contains
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("contains_hash_set()...");
+    bool found = false;
+
+    for (u64 i = 0; i < 60; i++)
+    {
+        err = contains_hash_set_59(evens, &i, &found);
+        assert(ERR_NONE == err);
+        printf("Assert: %d == %d = contains_hash_set() [%lu]\n", 0 == i % 2, found, i);
+        assert((0 == i % 2) == found);
+    }
+
+    err = contains_hash_set_59(str_set, "apple", &found);
+    printf("Assert: 1 == %d = contains_hash_set() copied str\n", found);
+    assert(ERR_NONE == err && found);
+    err = contains_hash_set_59(str_set, word_a, &found);
+    assert(ERR_NONE == err && !found);
+
+    // Remove
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("remove_from_hash_set()...");
+
+    err = remove_from_hash_set_59(str_set, "banana");
+    printf("Assert: ERR_NONE == %d = remove_from_hash_set()\n", err);
+    assert(ERR_NONE == err);
+    err = contains_hash_set_59(str_set, "banana", &found);
+    assert(ERR_NONE == err && !found);
+    printf("Assert: 1 == %lu = str set size\n", str_set->map->size);
+    assert(1 == str_set->map->size);
+
+    // Set algebra
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("union/intersect/difference_hash_set()...");
+
+    hash_set_59* both = (void*)0;
+    err = init_hash_set_59(&both, U64_PTR, 0, 0);
+    assert(ERR_NONE == err);
+    err = union_hash_set_59(both, evens);
+    assert(ERR_NONE == err);
+    err = intersect_hash_set_59(both, threes);
+    printf("Assert: ERR_NONE == %d = intersect_hash_set()\n", err);
+    assert(ERR_NONE == err);
+    printf("Assert: 10 == %lu = multiples of 6 below 60\n", both->map->size);
+    assert(10 == both->map->size);
+
+    err = union_hash_set_59(evens, threes);
+    printf("Assert: ERR_NONE == %d = union_hash_set()\n", err);
+    assert(ERR_NONE == err);
+    printf("Assert: 40 == %lu = multiples of 2 or 3 below 60\n", evens->map->size);
+    assert(40 == evens->map->size);
+
+    err = difference_hash_set_59(evens, threes);
+    printf("Assert: ERR_NONE == %d = difference_hash_set()\n", err);
+    assert(ERR_NONE == err);
+    printf("Assert: 20 == %lu = multiples of 2 and not 3 below 60\n", evens->map->size);
+    assert(20 == evens->map->size);
+    for (u64 i = 0; i < 60; i++)
+    {
+        err = contains_hash_set_59(evens, &i, &found);
+        assert(ERR_NONE == err);
+        assert((0 == i % 2 && 0 != i % 3) == found);
+    }
+
+    // Test clean up
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test clean up...");
+    err = deinit_hash_set_59(&evens);
+    err = deinit_hash_set_59(&threes);
+    err = deinit_hash_set_59(&str_set);
+    err = deinit_hash_set_59(&both);
+
+    return err;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    puts("- - -  START OF HASH SET TEST  - - -");
+    puts("- - - INTERFACE TESTS - - -");
+
+    ERR_59_e err = test_hash_set_59_interface();
+    printf("ERROR CODE: %d\n", err);
+    assert(ERR_NONE == err);
+
+    puts("- - - - END OF HASH SET TEST - - - -");
+    return err;
+}
@@ -81,15 +81,21 @@ struct llist_node_59
  *
  * @head: start of the linked list.
  * @tail: end of the linked list inplemented as a pointer to a pointer. Begins as address of @head.
+ * @size: number of nodes in the list.
  * @type: type of the linked list's nodes, this can be any type so besure you document what you're pointing at.
  * @type_depth: if pointing at arrays with consistent size, place the size of the arrays here, otherwise leave as 0.
+ * @intrusive: whether the nodes are embedded in the objects they link, see @init_intrusive_llist_59.
+ * @link_offset: offset of the node within each object of an intrusive list, 0 otherwise.
  **********************************************************************************************************************/
 struct llist_59
 {
     llist_node_59* head;
     llist_node_59** tail;
+    size_t size;
     TYPE_59_e type;
     size_t type_depth;
+    bool intrusive;
+    size_t link_offset;
 };
 
 /*
@@ -112,7 +118,26 @@ struct llist_59
 ERR_59_e init_llist_59(llist_59** llist, TYPE_59_e const type, size_t const type_depth);
 
 /***********************************************************************************************************************
- * @brief: Deinits the passed linked list and all of the nodes, this also deallocates the used memory.
+ * @brief: Initializes an intrusive linked list, whose nodes are embedded in the objects they link rather than
+ * allocated with init_llist_node_59(). Linking an object then needs no allocation, and the object is reached from its
+ * node with CONTAINER_OF_59() rather than through @node_obj, which intrusive lists leave unused.
+ *
+ * @param[out] llist: linked list pointer to initialize. @warning This must be freed when its lifetime has ended.
+ * @param[in] type: type of the objects holding the nodes.
+ * @param[in] type_depth: size of the objects, all must be the same size, if not set as 0.
+ * @param[in] link_offset: offset of the embedded node within each object, ie offsetof(my_struct, link).
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Every other list function works on intrusive lists unchanged. The list never allocates or frees the objects,
+ * deinit_llist_59() only frees the list itself.
+ **********************************************************************************************************************/
+ERR_59_e
+init_intrusive_llist_59(llist_59** llist, TYPE_59_e const type, size_t const type_depth, size_t const link_offset);
+
+/***********************************************************************************************************************
+ * @brief: Deinits the passed linked list and all of the nodes, this also deallocates the used memory. The nodes and
+ * objects of intrusive lists belong to the caller and are left alone.
  *
  * @param[in] llist: linked list to deinit.
  *
@@ -188,7 +213,8 @@ ERR_59_e insert_node_into_llist_59(llist_59* const llist, llist_node_59* const n
 
 /***********************************************************************************************************************
  * @brief Finds the given node in the linked list and returns its value, value will be null if not found. @note This
- * matches by memory address of the given node, not value.
+ * matches by memory address of the given node, not value. For intrusive lists the value is the object holding the
+ * node.
  *
  * @param[in] llist The linked list to search.
  * @param[in] node the node to search for.
@@ -210,6 +236,50 @@ ERR_59_e find_node_in_llist_59(llist_59 const* const llist, llist_node_59 const*
  **********************************************************************************************************************/
 ERR_59_e get_at_idx_llist_59(llist_59 const* const llist, size_t const idx, llist_node_59** node);
 
+/***********************************************************************************************************************
+ * @brief: Moves every node of @src onto the end of @dest in O(1), @src is left empty.
+ *
+ * @param[in] dest: List to append to.
+ * @param[in] src: List whose nodes are moved.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Both lists must have the same type and both be intrusive with the same link offset or both not, otherwise
+ * ERR_INV_PARAM is returned.
+ **********************************************************************************************************************/
+ERR_59_e concat_llist_59(llist_59* const dest, llist_59* const src);
+
+/***********************************************************************************************************************
+ * @brief: Splits the linked list before the node at @idx, that node and every node after it are moved onto the end of
+ * @dest. Finding the node walks @idx nodes, the move itself is O(1).
+ *
+ * @param[in] llist: List to split.
+ * @param[in] idx: Index of the first node to move.
+ * @param[in] dest: List to append the moved nodes to, the same requirements as @concat_llist_59 apply.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note ERR_INV_PARAM is returned if @idx is out of range, neither list is changed.
+ **********************************************************************************************************************/
+ERR_59_e split_at_llist_59(llist_59* const llist, size_t const idx, llist_59* const dest);
+
+/***********************************************************************************************************************
+ * @brief: Sorts the linked list in place with a stable bottom-up merge sort, O(n log n) compares and no
+ * allocation. Nodes are relinked rather than their objects swapped, so pointers to nodes stay valid.
+ *
+ * @param[in] llist: The linked list to sort.
+ * @param[in] compare: Comparison returning the same sign convention as compare_node_obj_59(), or (void*)0 to
+ * compare with compare_node_obj_59() and the list's type. For intrusive lists the objects holding the nodes are
+ * compared.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note If a comparison fails the sort finishes without comparing further, the list keeps every node but in an
+ * unspecified order, and the comparison's error is returned.
+ **********************************************************************************************************************/
+ERR_59_e sort_llist_59(llist_59* const llist,
+                       ERR_59_e (*compare)(void const* const obj_A, void const* const obj_B, i64* const diff_out));
+
 /***********************************************************************************************************************
  * @brief: Initializes a node for a @llist_59, @next and @node_obj can be NULL.
  *
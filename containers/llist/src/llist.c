@@ -45,6 +45,57 @@
 
 #include "llist.h"
 
+/*
+========================================================================================================================
+- - INTERNAL FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Compares the objects of two nodes for @sort_llist_59.
+ *
+ * @param[in] llist: List the nodes belong to.
+ * @param[in] compare: Caller's comparison, (void*)0 to use compare_node_obj_59() with the list's type.
+ * @param[in] node_A: Node whose object is compared.
+ * @param[in] node_B: Other node whose object is compared.
+ * @param[out] diff_out: Sign of the comparison.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e
+_compare_nodes_llist_59(llist_59 const* const llist,
+                        ERR_59_e (*compare)(void const* const obj_A, void const* const obj_B, i64* const diff_out),
+                        llist_node_59 const* const node_A,
+                        llist_node_59 const* const node_B,
+                        i64* const diff_out)
+{
+    void const* obj_A = node_A->node_obj;
+    void const* obj_B = node_B->node_obj;
+    if (llist->intrusive)
+    {
+        obj_A = (char const*)node_A - llist->link_offset;
+        obj_B = (char const*)node_B - llist->link_offset;
+    }
+
+    if (compare)
+        return compare(obj_A, obj_B, diff_out);
+    return compare_node_obj_59(llist->type, obj_A, obj_B, diff_out);
+}
+
+/***********************************************************************************************************************
+ * @brief: Checks two lists may exchange nodes, they must hold the same type and agree on who owns the nodes.
+ *
+ * @param[in] A: List to check.
+ * @param[in] B: Other list to check.
+ *
+ * @retval bool: true if nodes can move between the lists.
+ **********************************************************************************************************************/
+static bool _compatible_llist_59(llist_59 const* const A, llist_59 const* const B)
+{
+    return A->type == B->type && A->type_depth == B->type_depth && A->intrusive == B->intrusive &&
+           A->link_offset == B->link_offset;
+}
+
 /*
 ========================================================================================================================
 - - FUNCTION DEFINITIONS - -
@@ -65,6 +116,22 @@ ERR_59_e init_llist_59(llist_59** llist, TYPE_59_e const type, size_t const type
     (*llist)->type_depth = type_depth;
     (*llist)->head = (void*)0;
     (*llist)->tail = &(*llist)->head;
+    (*llist)->size = 0;
+    (*llist)->intrusive = false;
+    (*llist)->link_offset = 0;
+
+    return ERR_NONE;
+}
+
+ERR_59_e
+init_intrusive_llist_59(llist_59** llist, TYPE_59_e const type, size_t const type_depth, size_t const link_offset)
+{
+    ERR_59_e err = init_llist_59(llist, type, type_depth);
+    if (ERR_NONE != err)
+        return err;
+
+    (*llist)->intrusive = true;
+    (*llist)->link_offset = link_offset;
 
     return ERR_NONE;
 }
@@ -74,7 +141,7 @@ ERR_59_e deinit_llist_59(llist_59** llist)
     if (!llist || !(*llist))
         return ERR_INV_PARAM;
 
-    llist_node_59* node = (*llist)->head;
+    llist_node_59* node = (*llist)->intrusive ? (void*)0 : (*llist)->head; // Intrusive nodes belong to the caller.
     llist_node_59* next_node = (void*)0;
     while (node)
     {
@@ -89,6 +156,7 @@ ERR_59_e deinit_llist_59(llist_59** llist)
 
     (*llist)->head = (void*)0;
     (*llist)->tail = (void*)0;
+    (*llist)->size = 0;
     (*llist)->type = VOID_0;
     (*llist)->type_depth = 0;
     free((*llist));
@@ -102,8 +170,10 @@ ERR_59_e push_back_llist_59(llist_59* const llist, llist_node_59* const new_node
     if (!llist || !new_node)
         return ERR_INV_PARAM;
 
+    new_node->next = (void*)0;
     *(llist->tail) = new_node;
     llist->tail = &(*llist->tail)->next;
+    llist->size++;
 
     return ERR_NONE;
 }
@@ -134,6 +204,7 @@ ERR_59_e pop_back_llist_59(llist_59* const llist, llist_node_59** back_node)
         llist->head = (void*)0;
         llist->tail = &(llist->head);
     }
+    llist->size--;
 
     return ERR_NONE;
 }
@@ -143,16 +214,11 @@ ERR_59_e push_front_llist_59(llist_59* const llist, llist_node_59* const new_fro
     if (!llist || !new_front)
         return ERR_INV_PARAM;
 
-    if (!llist->head)
-    {
-        *llist->tail = new_front;
-        llist->head = new_front;
-    }
-    else
-    {
-        new_front->next = llist->head;
-        llist->head = new_front;
-    }
+    new_front->next = llist->head;
+    llist->head = new_front;
+    if (!new_front->next) // List was empty, so tail needs to be moved off head.
+        llist->tail = &new_front->next;
+    llist->size++;
 
     return ERR_NONE;
 }
@@ -166,10 +232,10 @@ ERR_59_e pop_front_llist_59(llist_59* const llist, llist_node_59** front_node)
 
     *front_node = llist->head;
 
-    if (llist->head->next)
-        llist->head = llist->head->next;
-    else
-        llist->head = (void*)0;
+    llist->head = llist->head->next;
+    if (!llist->head) // Popped the only node, tail needs to be reset.
+        llist->tail = &(llist->head);
+    llist->size--;
 
     (*front_node)->next = (void*)0;
 
@@ -197,13 +263,15 @@ ERR_59_e remove_given_node_from_llist_59(llist_59* const llist, llist_node_59* r
                     llist->tail = &(last_node->next);
             }
             else
-            { // Head was only node in the list, tail also needs to be reset.
+            {
                 llist->head = node->next;
-                llist->tail = &(llist->head);
+                if (!llist->head) // Head was only node in the list, tail also needs to be reset.
+                    llist->tail = &(llist->head);
             }
 
             remove_node = node;
             remove_node->next = (void*)0;
+            llist->size--;
             return ERR_NONE;
         }
         last_node = node;
@@ -218,24 +286,15 @@ ERR_59_e insert_node_into_llist_59(llist_59* const llist, llist_node_59* const n
     if (!llist || !new_node)
         return ERR_INV_PARAM;
 
-    if (!llist->head)
-    {
-        llist->head = new_node;
-        return ERR_NONE;
-    }
+    llist_node_59** link = &llist->head;
+    for (size_t i = 0; i < idx && *link; i++)
+        link = &(*link)->next;
 
-    llist_node_59* node = llist->head;
-    llist_node_59* last_node = (void*)0;
-    for (size_t i = 0; i < idx; i++)
-    {
-        if (!node)
-            break;
-
-        last_node = node;
-        node = node->next;
-    }
-    last_node->next = new_node;
-    new_node->next = node;
+    new_node->next = *link;
+    *link = new_node;
+    if (!new_node->next) // Inserted at the end, so tail needs to be moved.
+        llist->tail = &new_node->next;
+    llist->size++;
 
     return ERR_NONE;
 }
@@ -254,7 +313,7 @@ ERR_59_e find_node_in_llist_59(llist_59 const* const llist, llist_node_59 const*
     {
         if (node == current)
         {
-            *val = current->node_obj;
+            *val = llist->intrusive ? (void*)((char*)current - llist->link_offset) : current->node_obj;
             return ERR_NONE;
         }
         current = current->next;
@@ -265,27 +324,126 @@ ERR_59_e find_node_in_llist_59(llist_59 const* const llist, llist_node_59 const*
 
 ERR_59_e get_at_idx_llist_59(llist_59 const* const llist, size_t const idx, llist_node_59** node)
 {
-    if (!llist)
+    if (!llist || !node)
     {
         return ERR_INV_PARAM;
     }
 
     *node = (void*)0;
     llist_node_59* current = llist->head;
-    for (size_t i = 0; i <= idx; i++)
+    for (size_t i = 0; i < idx && current; i++)
+        current = current->next;
+
+    if (!current)
+        return ERR_INV_PARAM;
+
+    *node = current;
+    return ERR_NONE;
+}
+
+ERR_59_e concat_llist_59(llist_59* const dest, llist_59* const src)
+{
+    if (!dest || !src || dest == src || !_compatible_llist_59(dest, src))
+        return ERR_INV_PARAM;
+    if (!src->head)
+        return ERR_NONE;
+
+    *(dest->tail) = src->head;
+    dest->tail = src->tail;
+    dest->size += src->size;
+    src->head = (void*)0;
+    src->tail = &(src->head);
+    src->size = 0;
+
+    return ERR_NONE;
+}
+
+ERR_59_e split_at_llist_59(llist_59* const llist, size_t const idx, llist_59* const dest)
+{
+    if (!llist || !dest || llist == dest || !_compatible_llist_59(llist, dest))
+        return ERR_INV_PARAM;
+
+    llist_node_59** link = &(llist->head);
+    for (size_t i = 0; i < idx && *link; i++)
+        link = &(*link)->next;
+    if (!(*link))
+        return ERR_INV_PARAM;
+
+    *(dest->tail) = *link;
+    dest->tail = llist->tail;
+    *link = (void*)0;
+    llist->tail = link;
+    dest->size += llist->size - idx;
+    llist->size = idx;
+
+    return ERR_NONE;
+}
+
+ERR_59_e sort_llist_59(llist_59* const llist,
+                       ERR_59_e (*compare)(void const* const obj_A, void const* const obj_B, i64* const diff_out))
+{
+    if (!llist)
+        return ERR_INV_PARAM;
+
+    // Each pass merges neighbouring sorted runs of width nodes, doubling the width until one run is left.
+    ERR_59_e err = ERR_NONE;
+    for (size_t width = 1;; width *= 2)
     {
-        if (current)
-        {
-            current = current->next;
-        }
-        else
+        llist_node_59* left = llist->head;
+        llist_node_59** tail = &(llist->head);
+        size_t merges = 0;
+
+        while (left)
         {
-            return ERR_INV_PARAM;
+            merges++;
+            llist_node_59* right = left;
+            size_t left_size = 0;
+            while (left_size < width && right)
+            {
+                right = right->next;
+                left_size++;
+            }
+            size_t right_size = width;
+
+            while (left_size || (right_size && right))
+            {
+                bool take_left = !right_size || !right;
+                if (!take_left && left_size)
+                {
+                    // Ties go to the left run to keep the sort stable, after an error the runs are just joined.
+                    i64 diff = 0;
+                    if (ERR_NONE == err)
+                        err = _compare_nodes_llist_59(llist, compare, left, right, &diff);
+                    take_left = (ERR_NONE != err) || 0 >= diff;
+                }
+
+                llist_node_59* next = (void*)0;
+                if (take_left)
+                {
+                    next = left;
+                    left = left->next;
+                    left_size--;
+                }
+                else
+                {
+                    next = right;
+                    right = right->next;
+                    right_size--;
+                }
+                *tail = next;
+                tail = &(next->next);
+            }
+
+            left = right;
         }
+
+        *tail = (void*)0;
+        llist->tail = tail;
+        if (1 >= merges)
+            break;
     }
 
-    *node = current;
-    return ERR_NONE;
+    return err;
 }
 
 ERR_59_e init_llist_node_59(llist_node_59** node, llist_node_59* const next, void* node_obj)
@@ -80,6 +80,69 @@ ERR_59_e test_llist_59_edge_cases(void)
     assert(ERR_INV_PARAM == err);
     err = ERR_NONE;
 
+    err = init_intrusive_llist_59((void*)0, I64_PTR, 0, 0);
+    printf("Assert: err = %d == %d ERR_INV_PARAM\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+    err = ERR_NONE;
+
+    // sort list
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Testing sort_llist()...");
+
+    err = sort_llist_59((void*)0, (void*)0);
+    printf("Assert: err = %d == %d ERR_INV_PARAM\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+    err = ERR_NONE;
+
+    llist_59* unsorted = (void*)0;
+    llist_node_59 unsorted_nodes[3];
+    err = init_intrusive_llist_59(&unsorted, BOOL_PTR, 0, 0);
+    for (size_t i = 0; i < 3; i++)
+        err = push_back_llist_59(unsorted, &unsorted_nodes[i]);
+    err = sort_llist_59(unsorted, (void*)0);
+    printf("Assert: err = %d == %d ERR_NOT_SUPPORTED\n", err, ERR_NOT_SUPPORTED);
+    assert(ERR_NOT_SUPPORTED == err);
+    llist_node_59* unsorted_node = unsorted->head;
+    for (size_t i = 0; i < 2; i++)
+        unsorted_node = unsorted_node->next;
+    printf("Assert: %p == %p, every node kept after a failed sort\n", (void*)0, (void*)unsorted_node->next);
+    assert(!unsorted_node->next && &unsorted_node->next == unsorted->tail);
+    err = deinit_llist_59(&unsorted);
+    err = ERR_NONE;
+
+    // concat, split_at
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Testing concat_llist(), split_at_llist()...");
+
+    llist_59* other_list = (void*)0;
+    err = init_llist_59(&other_list, U64_PTR, 0);
+
+    err = concat_llist_59(list, (void*)0);
+    printf("Assert: err = %d == %d ERR_INV_PARAM\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+
+    err = concat_llist_59(list, list);
+    printf("Assert: err = %d == %d ERR_INV_PARAM\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+
+    err = concat_llist_59(list, other_list);
+    printf("Assert: err = %d == %d ERR_INV_PARAM, lists of different types\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+
+    err = split_at_llist_59(list, 0, other_list);
+    printf("Assert: err = %d == %d ERR_INV_PARAM, lists of different types\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+
+    err = deinit_llist_59(&other_list);
+    err = init_llist_59(&other_list, I64_PTR, 0);
+
+    err = split_at_llist_59(list, 0, other_list);
+    printf("Assert: err = %d == %d ERR_INV_PARAM, index past the end\n", err, ERR_INV_PARAM);
+    assert(ERR_INV_PARAM == err);
+
+    err = deinit_llist_59(&other_list);
+    err = ERR_NONE;
+
     // deinit list
     puts("- - - - - - - - - - - - - - - - -");
     puts("Testing deinit_llist()...");
@@ -0,0 +1,246 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Benchmark of the lru cache against the same cache hand rolled from hash_map_59 and dlist_59.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "dlist.h"
+#include "hash_map.h"
+#include "lru_cache.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Default capacity of the benchmarked caches, override with the first program argument.
+ **********************************************************************************************************************/
+#define BENCH_DEFAULT_CAPACITY 4096
+
+/***********************************************************************************************************************
+ * @brief: Number of distinct keys in the trace per entry of capacity.
+ **********************************************************************************************************************/
+#define BENCH_KEYS_PER_ENTRY 4
+
+/***********************************************************************************************************************
+ * @brief: Number of get or put on miss operations run against each cache.
+ **********************************************************************************************************************/
+#define BENCH_OPS (1UL << 20)
+
+/*
+========================================================================================================================
+- - BENCH HELPERS - -
+========================================================================================================================
+*/
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static u64 xorshift(u64* state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+// The smaller of two uniform draws, low keys come up far more often than high ones like a hot working set.
+static u64 skewed_key(u64* state, u64 const keys)
+{
+    u64 const a = xorshift(state) % keys;
+    u64 const b = xorshift(state) % keys;
+    return (a < b) ? a : b;
+}
+
+// The usual hand rolled cache, a copy-in map from key to the address of a dlist node holding the key and value.
+// Promotion either searches the list for the node or unlinks it directly.
+static ERR_59_e
+run_hand_rolled(u64 const* const trace, size_t const capacity, bool const search, u64* const hits, double* const ns)
+{
+    hash_map_59* map = (void*)0;
+    ERR_59_e err = init_copy_hash_map_59(&map, U64_PTR, U64_PTR, 0, 0, 0);
+    if (ERR_NONE != err)
+        return err;
+    dlist_59* recency = (void*)0;
+    err = init_dlist_59(&recency, U64_PTR, 2);
+    if (ERR_NONE != err)
+        return err;
+
+    *hits = 0;
+    double const start = now_ns();
+    for (size_t i = 0; i < BENCH_OPS; i++)
+    {
+        u64 key = trace[i];
+        void* slot = (void*)0;
+        if (ERR_NONE == get_from_hash_map_59(map, &key, &slot))
+        {
+            dlist_node_59* node = (dlist_node_59*)(uintptr_t)(*(u64*)slot);
+            err = search ? remove_given_node_from_dlist_59(recency, node) : unlink_node_from_dlist_59(recency, node);
+            if (ERR_NONE != err)
+                return err;
+            push_front_dlist_59(recency, node);
+            (*hits)++;
+            continue;
+        }
+
+        dlist_node_59* node = (void*)0;
+        if (capacity == recency->size)
+        {
+            err = pop_back_dlist_59(recency, &node);
+            if (ERR_NONE != err)
+                return err;
+            key_val_pair_59* pair = (void*)0;
+            err = remove_from_hash_map_59(map, node->node_obj, &pair);
+            if (ERR_NONE != err)
+                return err;
+            free(pair);
+        }
+        else
+        {
+            u64* obj = malloc(sizeof(u64) * 2);
+            if (!obj)
+                return ERR_NO_MEM;
+            err = init_dlist_node_59(&node, (void*)0, (void*)0, obj);
+            if (ERR_NONE != err)
+                return err;
+        }
+
+        ((u64*)node->node_obj)[0] = key;
+        ((u64*)node->node_obj)[1] = key * 59;
+        push_front_dlist_59(recency, node);
+        u64 addr = (u64)(uintptr_t)node;
+        err = upsert_into_hash_map_59(map, &key, &addr);
+        if (ERR_NONE != err)
+            return err;
+    }
+    *ns = (now_ns() - start) / (double)BENCH_OPS;
+
+    deinit_dlist_59(&recency);
+    deinit_hash_map_59(&map);
+
+    return ERR_NONE;
+}
+
+static ERR_59_e run_lru_cache(u64 const* const trace, size_t const capacity, u64* const hits, double* const ns)
+{
+    lru_cache_59* cache = (void*)0;
+    ERR_59_e err = init_lru_cache_59(&cache, U64_PTR, U64_PTR, 0, capacity);
+    if (ERR_NONE != err)
+        return err;
+
+    double const start = now_ns();
+    for (size_t i = 0; i < BENCH_OPS; i++)
+    {
+        void* val = (void*)0;
+        if (ERR_NONE == get_lru_cache_59(cache, &trace[i], &val))
+            continue;
+
+        u64 const new_val = trace[i] * 59;
+        err = put_lru_cache_59(cache, &trace[i], &new_val);
+        if (ERR_NONE != err)
+            return err;
+    }
+    *ns = (now_ns() - start) / (double)BENCH_OPS;
+    *hits = cache->hits;
+
+    return deinit_lru_cache_59(&cache);
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    size_t const capacity = (1 < argc) ? strtoul(argv[1], (void*)0, 10) : BENCH_DEFAULT_CAPACITY;
+    if (!capacity)
+        return ERR_INV_PARAM;
+
+    u64* trace = malloc(sizeof(u64) * BENCH_OPS);
+    if (!trace)
+        return ERR_NO_MEM;
+    u64 rng = 59;
+    for (size_t i = 0; i < BENCH_OPS; i++)
+        trace[i] = skewed_key(&rng, capacity * BENCH_KEYS_PER_ENTRY);
+
+    u64 searched_hits = 0;
+    double searched_ns = 0;
+    ERR_59_e err = run_hand_rolled(trace, capacity, true, &searched_hits, &searched_ns);
+    if (ERR_NONE != err)
+        return err;
+
+    u64 unlinked_hits = 0;
+    double unlinked_ns = 0;
+    err = run_hand_rolled(trace, capacity, false, &unlinked_hits, &unlinked_ns);
+    if (ERR_NONE != err)
+        return err;
+
+    u64 lru_hits = 0;
+    double lru_ns = 0;
+    err = run_lru_cache(trace, capacity, &lru_hits, &lru_ns);
+    if (ERR_NONE != err)
+        return err;
+
+    printf("capacity: %zu, keys: %zu, ops: %lu\n", capacity, capacity * BENCH_KEYS_PER_ENTRY, BENCH_OPS);
+    printf("hash_map + dlist, searched remove: %10.2f ns/op, hit ratio %.4f\n",
+           searched_ns,
+           (double)searched_hits / (double)BENCH_OPS);
+    printf("hash_map + dlist, O(1) unlink:     %10.2f ns/op, hit ratio %.4f\n",
+           unlinked_ns,
+           (double)unlinked_hits / (double)BENCH_OPS);
+    printf("lru_cache:                         %10.2f ns/op, hit ratio %.4f\n",
+           lru_ns,
+           (double)lru_hits / (double)BENCH_OPS);
+
+    free(trace);
+
+    return ERR_NONE;
+}
@@ -0,0 +1,239 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: This file contains the declarations for a least recently used cache whose entries are hashed and recency
+ * linked in one allocation.
+ **********************************************************************************************************************/
+
+#pragma once
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "containers_common.h"
+#include "dlist.h"
+
+/*
+========================================================================================================================
+- - TYPEDEFS - -
+========================================================================================================================
+*/
+
+typedef struct lru_cache_entry_59 lru_cache_entry_59;
+typedef struct lru_cache_59 lru_cache_59;
+
+/*
+========================================================================================================================
+- - STRUCTS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @lru_cache_entry_59
+ * @brief: A cached key and value, allocated once with both of its links so a lookup, a promotion and an eviction never
+ * allocate or search a list.
+ *
+ * @link: node of the entry in the cache's intrusive recency list.
+ * @chain: next entry hashed into the same table bucket, NULL ends the chain.
+ * @hash: full width hash of the key, compared before the key bytes.
+ * @key_len: bytes of the key, including the terminator of STR keys.
+ * @data: the value rounded up to 8 bytes followed by the key.
+ *
+ * @see lru_cache_59
+ **********************************************************************************************************************/
+struct lru_cache_entry_59
+{
+    dlist_node_59 link;
+    lru_cache_entry_59* chain;
+    u64 hash;
+    size_t key_len;
+    u8 data[];
+};
+
+/***********************************************************************************************************************
+ * @lru_cache_59
+ * @brief: Represents a fixed capacity cache that evicts its least recently used entry to make room for a new key. Keys
+ * and values are copied in, every entry is one allocation found through a chained hash table and ordered by an
+ * intrusive @dlist_59, most recently used first.
+ *
+ * @key_type: type of the keys, a fixed size type or STR.
+ * @val_type: type of the values, must be a fixed size type.
+ * @val_type_depth: number of objects of @val_type in each value, 0 is treated as 1.
+ * @key_size: bytes of each key, 0 for STR keys.
+ * @val_size: bytes copied in and out per value.
+ * @capacity: most entries held before a put evicts.
+ * @table: @table_size buckets, each the first entry of its chain or NULL.
+ * @table_size: power of two of at least @capacity, so chains average at most one entry and the table never grows.
+ * @recency: intrusive list of the entries, the front was used last and the back is the next to be evicted.
+ * @on_evict: called with the key and value of each evicted entry before it is reused, NULL to skip.
+ * @evict_ctx: passed through to @on_evict.
+ * @hits: number of gets that found their key.
+ * @misses: number of gets that did not.
+ * @evictions: number of entries evicted by puts.
+ *
+ * @note Only puts evict, removals and deinit do not call @on_evict. The counters are only changed by gets and puts and
+ * may be reset by the caller.
+ **********************************************************************************************************************/
+struct lru_cache_59
+{
+    TYPE_59_e key_type;
+    TYPE_59_e val_type;
+    size_t val_type_depth;
+    size_t key_size;
+    size_t val_size;
+    size_t capacity;
+    lru_cache_entry_59** table;
+    size_t table_size;
+    dlist_59* recency;
+    void (*on_evict)(void const* key, void* val, void* ctx);
+    void* evict_ctx;
+    u64 hits;
+    u64 misses;
+    u64 evictions;
+};
+
+/*
+========================================================================================================================
+- - MODULE FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Initializes an empty lru cache, this also allocates memory to the @cache pointer.
+ *
+ * @param[out] cache: Lru cache pointer to initialize. @warning This must be freed when its lifetime has ended.
+ * @param[in] key_type: Type of the keys, a fixed size type or STR.
+ * @param[in] val_type: Type of the values, must be a fixed size type.
+ * @param[in] val_type_depth: Number of objects of @val_type in each value, 0 is treated as 1.
+ * @param[in] capacity: Most entries held at once, must be at least 1.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note ERR_NOT_SUPPORTED is returned for types without a fixed size, see get_type_size_59().
+ **********************************************************************************************************************/
+ERR_59_e init_lru_cache_59(lru_cache_59** cache,
+                           TYPE_59_e const key_type,
+                           TYPE_59_e const val_type,
+                           size_t const val_type_depth,
+                           size_t const capacity);
+
+/***********************************************************************************************************************
+ * @brief: Deinits the passed lru cache, freeing every entry without calling @on_evict.
+ *
+ * @param[out] cache: Lru cache to deinit, set to (void*)0 on return.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e deinit_lru_cache_59(lru_cache_59** cache);
+
+/***********************************************************************************************************************
+ * @brief: Sets the callback handed each entry evicted by a put, pass (void*)0 to clear it.
+ *
+ * @param[in] cache: Lru cache to set the callback of.
+ * @param[in] on_evict: Callback, gets the evicted key and value and @ctx. The entry is reused once it returns.
+ * @param[in] ctx: Passed through to @on_evict.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e set_evict_callback_lru_cache_59(lru_cache_59* const cache,
+                                         void (*on_evict)(void const* key, void* val, void* ctx),
+                                         void* ctx);
+
+/***********************************************************************************************************************
+ * @brief: Copies the passed key and value into the cache as its most recently used entry. An existing key has its value
+ * replaced, otherwise a full cache first evicts its least recently used entry and reuses its allocation.
+ *
+ * @param[in] cache: Lru cache to put into.
+ * @param[in] key: Key to copy in.
+ * @param[in] val: Value of @val_size bytes to copy in.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e put_lru_cache_59(lru_cache_59* const cache, void const* const key, void const* const val);
+
+/***********************************************************************************************************************
+ * @brief: Gets the value of the passed key and makes it the most recently used entry, counting a hit or a miss.
+ *
+ * @param[in] cache: Lru cache to search.
+ * @param[in] key: Key to get the value of.
+ * @param[out] val: Pointer to the value inside the cache, (void*)0 on a miss.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note ERR_OBJ_NOT_FOUND is returned on a miss.
+ * @warning The pointer is only valid until its entry is evicted or removed.
+ **********************************************************************************************************************/
+ERR_59_e get_lru_cache_59(lru_cache_59* const cache, void const* const key, void** const val);
+
+/***********************************************************************************************************************
+ * @brief: Gets the value of the passed key without changing its recency or the hit and miss counters.
+ *
+ * @param[in] cache: Lru cache to search.
+ * @param[in] key: Key to get the value of.
+ * @param[out] val: Pointer to the value inside the cache, (void*)0 if the key is not cached.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note ERR_OBJ_NOT_FOUND is returned if the key is not cached.
+ * @warning The pointer is only valid until its entry is evicted or removed.
+ **********************************************************************************************************************/
+ERR_59_e peek_lru_cache_59(lru_cache_59 const* const cache, void const* const key, void** const val);
+
+/***********************************************************************************************************************
+ * @brief: Removes the passed key from the cache, freeing its entry without calling @on_evict.
+ *
+ * @param[in] cache: Lru cache to remove from.
+ * @param[in] key: Key to remove.
+ * @param[out] val: Buffer of at least @val_size bytes receiving a copy of the value, may be (void*)0.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note ERR_OBJ_NOT_FOUND is returned if the key is not cached.
+ **********************************************************************************************************************/
+ERR_59_e remove_from_lru_cache_59(lru_cache_59* const cache, void const* const key, void* const val);
+
+/***********************************************************************************************************************
+ * @brief: Gets the number of entries held by the cache.
+ *
+ * @param[in] cache: Lru cache to size.
+ * @param[out] size: Number of entries.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e size_lru_cache_59(lru_cache_59 const* const cache, size_t* const size);
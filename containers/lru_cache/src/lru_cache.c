@@ -0,0 +1,459 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: This file contains the definitions for a least recently used cache whose entries are hashed and recency
+ * linked in one allocation.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "lru_cache.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Alignment of the key following the value in each entry.
+ **********************************************************************************************************************/
+#define LRU_CACHE_KEY_ALIGN (sizeof(u64))
+
+/*
+========================================================================================================================
+- - INTERNAL FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Gets the bytes taken by the value at the start of each entry's data, rounded up so the key is aligned.
+ *
+ * @param[in] cache: Lru cache to get the value stride of.
+ *
+ * @retval size_t: @val_size rounded up to @LRU_CACHE_KEY_ALIGN.
+ **********************************************************************************************************************/
+static size_t _val_stride_lru_cache_59(lru_cache_59 const* const cache)
+{
+    return (cache->val_size + LRU_CACHE_KEY_ALIGN - 1) & ~(LRU_CACHE_KEY_ALIGN - 1);
+}
+
+/***********************************************************************************************************************
+ * @brief: Gets the key of the passed entry, it follows the value.
+ *
+ * @param[in] cache: Lru cache holding the entry.
+ * @param[in] entry: Entry to get the key of.
+ *
+ * @retval u8*: Key of the entry.
+ **********************************************************************************************************************/
+static u8* _key_lru_cache_59(lru_cache_59 const* const cache, lru_cache_entry_59* const entry)
+{
+    return entry->data + _val_stride_lru_cache_59(cache);
+}
+
+/***********************************************************************************************************************
+ * @brief: Hashes the passed key and gets the number of bytes it takes in an entry.
+ *
+ * @param[in] cache: Lru cache the key belongs to.
+ * @param[in] key: Key to hash.
+ * @param[out] hash: Hash of the key.
+ * @param[out] key_len: Bytes of the key, including the terminator of STR keys.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e
+_hash_key_lru_cache_59(lru_cache_59 const* const cache, void const* const key, u64* const hash, size_t* const key_len)
+{
+    if (cache->key_size)
+    {
+        *key_len = cache->key_size;
+        return hash_node_obj_59(cache->key_type, key, 0, hash);
+    }
+
+    // Same hash as hash_node_obj_59() gives STR, without a second scan for the length.
+    size_t const len = strlen((char const*)key);
+    *key_len = len + 1;
+    return hash_bytes_59(key, len, 0, hash);
+}
+
+/***********************************************************************************************************************
+ * @brief: Finds the bucket link pointing at the entry holding the passed key.
+ *
+ * @param[in] cache: Lru cache to search.
+ * @param[in] key: Key to find.
+ * @param[in] hash: Hash of @key.
+ * @param[in] key_len: Bytes of @key, see @_hash_key_lru_cache_59.
+ * @param[out] link: Link pointing at the entry, or at NULL at the end of the chain if the key is not cached.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _find_lru_cache_59(lru_cache_59 const* const cache,
+                                   void const* const key,
+                                   u64 const hash,
+                                   size_t const key_len,
+                                   lru_cache_entry_59*** const link)
+{
+    lru_cache_entry_59** current = &cache->table[hash & (cache->table_size - 1)];
+    for (; *current; current = &(*current)->chain)
+    {
+        if (hash != (*current)->hash || key_len != (*current)->key_len)
+            continue;
+
+        bool equal = false;
+        ERR_59_e err = equal_bytes_59(key, _key_lru_cache_59(cache, *current), key_len, &equal);
+        if (ERR_NONE != err)
+            return err;
+        if (equal)
+            break;
+    }
+
+    *link = current;
+
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Moves the passed entry to the front of the recency list in O(1).
+ *
+ * @param[in] cache: Lru cache holding the entry.
+ * @param[in] entry: Entry that was just used.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _promote_lru_cache_59(lru_cache_59* const cache, lru_cache_entry_59* const entry)
+{
+    if (cache->recency->head == &entry->link)
+        return ERR_NONE;
+
+    ERR_59_e err = unlink_node_from_dlist_59(cache->recency, &entry->link);
+    if (ERR_NONE != err)
+        return err;
+
+    return push_front_dlist_59(cache->recency, &entry->link);
+}
+
+/***********************************************************************************************************************
+ * @brief: Evicts the least recently used entry, handing it to @on_evict after it is unchained.
+ *
+ * @param[in] cache: Full lru cache to evict from.
+ * @param[out] victim: The evicted entry, unlinked from both the table and the recency list but not freed.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _evict_lru_cache_59(lru_cache_59* const cache, lru_cache_entry_59** const victim)
+{
+    dlist_node_59* node = (void*)0;
+    ERR_59_e err = pop_back_dlist_59(cache->recency, &node);
+    if (ERR_NONE != err)
+        return err;
+
+    lru_cache_entry_59* entry = CONTAINER_OF_59(node, lru_cache_entry_59, link);
+    lru_cache_entry_59** link = &cache->table[entry->hash & (cache->table_size - 1)];
+    while (*link != entry)
+        link = &(*link)->chain;
+    *link = entry->chain;
+
+    if (cache->on_evict)
+        cache->on_evict(_key_lru_cache_59(cache, entry), entry->data, cache->evict_ctx);
+    cache->evictions++;
+    *victim = entry;
+
+    return ERR_NONE;
+}
+
+/*
+========================================================================================================================
+- - FUNCTION DEFINITIONS - -
+========================================================================================================================
+*/
+
+ERR_59_e init_lru_cache_59(lru_cache_59** cache,
+                           TYPE_59_e const key_type,
+                           TYPE_59_e const val_type,
+                           size_t const val_type_depth,
+                           size_t const capacity)
+{
+    if (!cache || !capacity || SIZE_MAX / 2 < capacity)
+        return ERR_INV_PARAM;
+
+    size_t key_size = 0;
+    ERR_59_e err = (STR == key_type) ? ERR_NONE : get_type_size_59(key_type, &key_size);
+    if (ERR_NONE != err)
+        return err;
+
+    size_t val_size = 0;
+    err = get_type_size_59(val_type, &val_size);
+    if (ERR_NONE != err)
+        return err;
+    if (1 < val_type_depth)
+        val_size *= val_type_depth;
+
+    lru_cache_59* new_cache = malloc(sizeof(lru_cache_59));
+    if (!new_cache)
+        return ERR_NO_MEM;
+
+    new_cache->table_size = 1;
+    while (new_cache->table_size < capacity)
+        new_cache->table_size <<= 1;
+    new_cache->table = calloc(new_cache->table_size, sizeof(lru_cache_entry_59*));
+    if (!new_cache->table)
+    {
+        free(new_cache);
+        return ERR_NO_MEM;
+    }
+
+    err = init_intrusive_dlist_59(&new_cache->recency, STRUCT_PTR, 0, offsetof(lru_cache_entry_59, link));
+    if (ERR_NONE != err)
+    {
+        free(new_cache->table);
+        free(new_cache);
+        return err;
+    }
+
+    new_cache->key_type = key_type;
+    new_cache->val_type = val_type;
+    new_cache->val_type_depth = val_type_depth;
+    new_cache->key_size = key_size;
+    new_cache->val_size = val_size;
+    new_cache->capacity = capacity;
+    new_cache->on_evict = (void*)0;
+    new_cache->evict_ctx = (void*)0;
+    new_cache->hits = 0;
+    new_cache->misses = 0;
+    new_cache->evictions = 0;
+    *cache = new_cache;
+
+    return ERR_NONE;
+}
+
+ERR_59_e deinit_lru_cache_59(lru_cache_59** cache)
+{
+    if (!cache || !(*cache))
+        return ERR_INV_PARAM;
+
+    dlist_node_59* node = (*cache)->recency->head;
+    while (node)
+    {
+        dlist_node_59* next_node = node->next;
+        free(CONTAINER_OF_59(node, lru_cache_entry_59, link));
+        node = next_node;
+    }
+
+    ERR_59_e err = deinit_dlist_59(&(*cache)->recency);
+    if (ERR_NONE != err)
+        return err;
+
+    free((*cache)->table);
+    free(*cache);
+    *cache = (void*)0;
+
+    return ERR_NONE;
+}
+
+ERR_59_e set_evict_callback_lru_cache_59(lru_cache_59* const cache,
+                                         void (*on_evict)(void const* key, void* val, void* ctx),
+                                         void* ctx)
+{
+    if (!cache)
+        return ERR_INV_PARAM;
+
+    cache->on_evict = on_evict;
+    cache->evict_ctx = ctx;
+
+    return ERR_NONE;
+}
+
+ERR_59_e put_lru_cache_59(lru_cache_59* const cache, void const* const key, void const* const val)
+{
+    if (!cache || !key || !val)
+        return ERR_INV_PARAM;
+
+    u64 hash = 0;
+    size_t key_len = 0;
+    ERR_59_e err = _hash_key_lru_cache_59(cache, key, &hash, &key_len);
+    if (ERR_NONE != err)
+        return err;
+
+    lru_cache_entry_59** link = (void*)0;
+    err = _find_lru_cache_59(cache, key, hash, key_len, &link);
+    if (ERR_NONE != err)
+        return err;
+
+    if (*link)
+    {
+        memcpy((*link)->data, val, cache->val_size);
+        return _promote_lru_cache_59(cache, *link);
+    }
+
+    lru_cache_entry_59* entry = (void*)0;
+    if (cache->capacity == cache->recency->size)
+    {
+        err = _evict_lru_cache_59(cache, &entry);
+        if (ERR_NONE != err)
+            return err;
+
+        // Fixed size keys fit any entry, so the victim's allocation is reused as is.
+        if (!cache->key_size)
+        {
+            free(entry);
+            entry = (void*)0;
+        }
+    }
+
+    if (!entry)
+    {
+        entry = malloc(sizeof(lru_cache_entry_59) + _val_stride_lru_cache_59(cache) + key_len);
+        if (!entry)
+            return ERR_NO_MEM;
+    }
+
+    entry->hash = hash;
+    entry->key_len = key_len;
+    memcpy(entry->data, val, cache->val_size);
+    memcpy(_key_lru_cache_59(cache, entry), key, key_len);
+
+    // Chained at the bucket's head, the link found above may have been inside the evicted entry.
+    lru_cache_entry_59** bucket = &cache->table[hash & (cache->table_size - 1)];
+    entry->chain = *bucket;
+    *bucket = entry;
+
+    return push_front_dlist_59(cache->recency, &entry->link);
+}
+
+ERR_59_e get_lru_cache_59(lru_cache_59* const cache, void const* const key, void** const val)
+{
+    if (!cache || !key || !val)
+        return ERR_INV_PARAM;
+
+    *val = (void*)0;
+
+    u64 hash = 0;
+    size_t key_len = 0;
+    ERR_59_e err = _hash_key_lru_cache_59(cache, key, &hash, &key_len);
+    if (ERR_NONE != err)
+        return err;
+
+    lru_cache_entry_59** link = (void*)0;
+    err = _find_lru_cache_59(cache, key, hash, key_len, &link);
+    if (ERR_NONE != err)
+        return err;
+
+    if (!*link)
+    {
+        cache->misses++;
+        return ERR_OBJ_NOT_FOUND;
+    }
+
+    cache->hits++;
+    err = _promote_lru_cache_59(cache, *link);
+    if (ERR_NONE != err)
+        return err;
+
+    *val = (*link)->data;
+
+    return ERR_NONE;
+}
+
+ERR_59_e peek_lru_cache_59(lru_cache_59 const* const cache, void const* const key, void** const val)
+{
+    if (!cache || !key || !val)
+        return ERR_INV_PARAM;
+
+    *val = (void*)0;
+
+    u64 hash = 0;
+    size_t key_len = 0;
+    ERR_59_e err = _hash_key_lru_cache_59(cache, key, &hash, &key_len);
+    if (ERR_NONE != err)
+        return err;
+
+    lru_cache_entry_59** link = (void*)0;
+    err = _find_lru_cache_59(cache, key, hash, key_len, &link);
+    if (ERR_NONE != err)
+        return err;
+
+    if (!*link)
+        return ERR_OBJ_NOT_FOUND;
+
+    *val = (*link)->data;
+
+    return ERR_NONE;
+}
+
+ERR_59_e remove_from_lru_cache_59(lru_cache_59* const cache, void const* const key, void* const val)
+{
+    if (!cache || !key)
+        return ERR_INV_PARAM;
+
+    u64 hash = 0;
+    size_t key_len = 0;
+    ERR_59_e err = _hash_key_lru_cache_59(cache, key, &hash, &key_len);
+    if (ERR_NONE != err)
+        return err;
+
+    lru_cache_entry_59** link = (void*)0;
+    err = _find_lru_cache_59(cache, key, hash, key_len, &link);
+    if (ERR_NONE != err)
+        return err;
+
+    lru_cache_entry_59* entry = *link;
+    if (!entry)
+        return ERR_OBJ_NOT_FOUND;
+
+    err = unlink_node_from_dlist_59(cache->recency, &entry->link);
+    if (ERR_NONE != err)
+        return err;
+    *link = entry->chain;
+
+    if (val)
+        memcpy(val, entry->data, cache->val_size);
+    free(entry);
+
+    return ERR_NONE;
+}
+
+ERR_59_e size_lru_cache_59(lru_cache_59 const* const cache, size_t* const size)
+{
+    if (!cache || !size)
+        return ERR_INV_PARAM;
+
+    *size = cache->recency->size;
+
+    return ERR_NONE;
+}
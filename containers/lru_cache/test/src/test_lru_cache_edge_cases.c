@@ -0,0 +1,212 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Unit tests for the lru cache's edge cases.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "lru_cache.h"
+
+/*
+========================================================================================================================
+- - UNIT TESTS - -
+========================================================================================================================
+*/
+
+ERR_59_e test_lru_cache_59_edge_cases(void)
+{
+    ERR_59_e err = ERR_NONE;
+
+    // Init lru_cache
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Initializing lru_cache...");
+
+    lru_cache_59* cache = (void*)0;
+    err = init_lru_cache_59(&cache, I32_PTR, U64_PTR, 0, 1);
+    if (ERR_NONE != err)
+        return err;
+
+    lru_cache_59* cache_dummy = (void*)0;
+    void* val = (void*)0;
+    i32 key = -59;
+    u64 obj = 59;
+    size_t size = 0;
+
+    // Test init_lru_cache edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test init_lru_cache and deinit_lru_cache...");
+
+    err = init_lru_cache_59((void*)0, U64_PTR, U64_PTR, 0, 1);
+    printf("Assert: ERR_INV_PARAM == %d = init_lru_cache()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = init_lru_cache_59(&cache_dummy, U64_PTR, U64_PTR, 0, 0);
+    printf("Assert: ERR_INV_PARAM == %d = init_lru_cache() zero capacity\n", err);
+    assert(ERR_INV_PARAM == err && !cache_dummy);
+
+    err = init_lru_cache_59(&cache_dummy, STRUCT_PTR, U64_PTR, 0, 1);
+    printf("Assert: ERR_NOT_SUPPORTED == %d = init_lru_cache() struct keys\n", err);
+    assert(ERR_NOT_SUPPORTED == err && !cache_dummy);
+
+    err = init_lru_cache_59(&cache_dummy, U64_PTR, STR, 0, 1);
+    printf("Assert: ERR_NOT_SUPPORTED == %d = init_lru_cache() STR vals\n", err);
+    assert(ERR_NOT_SUPPORTED == err && !cache_dummy);
+
+    err = deinit_lru_cache_59(&cache_dummy);
+    printf("Assert: ERR_INV_PARAM == %d = deinit_lru_cache() null cache\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    // Test empty cache edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test empty lru_cache...");
+
+    err = get_lru_cache_59(cache, &key, &val);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = get_lru_cache() empty cache\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err && !val && 1 == cache->misses);
+
+    err = peek_lru_cache_59(cache, &key, &val);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = peek_lru_cache() empty cache\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err && !val && 1 == cache->misses);
+
+    err = remove_from_lru_cache_59(cache, &key, &obj);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = remove_from_lru_cache() empty cache\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err && 59 == obj);
+
+    // Test null params
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test null params...");
+
+    err = set_evict_callback_lru_cache_59(cache_dummy, (void*)0, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = set_evict_callback_lru_cache()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = put_lru_cache_59(cache_dummy, &key, &obj);
+    printf("Assert: ERR_INV_PARAM == %d = put_lru_cache()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = put_lru_cache_59(cache, (void*)0, &obj);
+    printf("Assert: ERR_INV_PARAM == %d = put_lru_cache() null key\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = put_lru_cache_59(cache, &key, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = put_lru_cache() null val\n", err);
+    assert(ERR_INV_PARAM == err && 0 == cache->recency->size);
+
+    err = get_lru_cache_59(cache, &key, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = get_lru_cache() null out\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = peek_lru_cache_59(cache_dummy, &key, &val);
+    printf("Assert: ERR_INV_PARAM == %d = peek_lru_cache()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = remove_from_lru_cache_59(cache, (void*)0, &obj);
+    printf("Assert: ERR_INV_PARAM == %d = remove_from_lru_cache() null key\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = size_lru_cache_59(cache, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = size_lru_cache() null out\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    // Test a capacity of one
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test a capacity of one...");
+
+    // Every new key evicts the last, reusing its allocation.
+    for (i32 i = -3; i <= 3; i++)
+    {
+        obj = (u64)(i + 3);
+        err = put_lru_cache_59(cache, &i, &obj);
+        assert(ERR_NONE == err);
+    }
+    err = size_lru_cache_59(cache, &size);
+    printf("Assert: ERR_NONE == %d = size_lru_cache() after 7 puts\n", err);
+    assert(ERR_NONE == err && 1 == size && 6 == cache->evictions);
+
+    key = 3;
+    err = get_lru_cache_59(cache, &key, &val);
+    printf("Assert: ERR_NONE == %d = get_lru_cache() only entry\n", err);
+    assert(ERR_NONE == err && 6 == *(u64*)val && 1 == cache->hits);
+
+    key = 2;
+    err = get_lru_cache_59(cache, &key, &val);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = get_lru_cache() evicted entry\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err && 2 == cache->misses);
+
+    // Removing the only entry leaves an empty but usable cache.
+    key = 3;
+    err = remove_from_lru_cache_59(cache, &key, (void*)0);
+    printf("Assert: ERR_NONE == %d = remove_from_lru_cache() null out\n", err);
+    assert(ERR_NONE == err && 0 == cache->recency->size);
+    err = remove_from_lru_cache_59(cache, &key, (void*)0);
+    assert(ERR_OBJ_NOT_FOUND == err);
+    err = put_lru_cache_59(cache, &key, &obj);
+    assert(ERR_NONE == err && 6 == cache->evictions);
+
+    // Test clean up
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test clean up...");
+    err = deinit_lru_cache_59(&cache);
+
+    return err;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    puts("- - -  START OF LRU CACHE TEST  - - -");
+    puts("- - - LRU CACHE EDGE CASES - - -");
+
+    ERR_59_e err = test_lru_cache_59_edge_cases();
+    printf("ERROR CODE: %d\n", err);
+    assert(ERR_NONE == err);
+
+    puts("- - - - END OF LRU CACHE TEST - - - -");
+    return err;
+}
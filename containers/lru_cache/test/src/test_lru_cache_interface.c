@@ -0,0 +1,346 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Unit tests for the lru cache's interface.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "lru_cache.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Capacity of the cache run against a plain array in the random test.
+ **********************************************************************************************************************/
+#define TEST_LRU_CACHE_CAPACITY 64
+
+/***********************************************************************************************************************
+ * @brief: Number of random operations run against the cache and a plain array.
+ **********************************************************************************************************************/
+#define TEST_LRU_CACHE_OPS 20000
+
+/*
+========================================================================================================================
+- - INTERNAL TEST HELPERS - -
+========================================================================================================================
+*/
+
+// Keys and values handed to the eviction callback, in eviction order.
+typedef struct
+{
+    u64 keys[8];
+    u64 vals[8];
+    size_t count;
+} evicted_log;
+
+static void _log_evicted(void const* key, void* val, void* ctx)
+{
+    evicted_log* log = ctx;
+    log->keys[log->count] = *(u64 const*)key;
+    log->vals[log->count] = *(u64*)val;
+    log->count++;
+}
+
+static u64 _xorshift(u64* state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+// The recency list must hold the expected u64 keys, most recently used first, and each must be found in the table.
+static bool _matches(lru_cache_59 const* const cache, u64 const* const expected, size_t const expected_size)
+{
+    size_t seen = 0;
+    for (dlist_node_59 const* node = cache->recency->head; node; node = node->next, seen++)
+    {
+        lru_cache_entry_59* entry = CONTAINER_OF_59(node, lru_cache_entry_59, link);
+        u64 key = 0;
+        memcpy(&key, entry->data + sizeof(u64), sizeof(u64));
+        void* val = (void*)0;
+        if (seen >= expected_size || expected[seen] != key || ERR_NONE != peek_lru_cache_59(cache, &key, &val))
+            return false;
+        if (val != entry->data)
+            return false;
+    }
+
+    return expected_size == seen && cache->recency->size == seen;
+}
+
+/*
+========================================================================================================================
+- - UNIT TESTS - -
+========================================================================================================================
+*/
+
+ERR_59_e test_lru_cache_59_interface(void)
+{
+    ERR_59_e err = ERR_NONE;
+
+    // Init lru_cache
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Initializing lru_cache...");
+
+    lru_cache_59* cache = (void*)0;
+    err = init_lru_cache_59(&cache, U64_PTR, U64_PTR, 0, 3);
+    printf("Assert: ERR_NONE == %d = init_lru_cache()\n", err);
+    assert(ERR_NONE == err && 3 == cache->capacity && 4 == cache->table_size);
+
+    evicted_log log = { .count = 0 };
+    err = set_evict_callback_lru_cache_59(cache, _log_evicted, &log);
+    assert(ERR_NONE == err);
+
+    // Test put and get
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test put_lru_cache and get_lru_cache...");
+
+    for (u64 key = 1; key <= 3; key++)
+    {
+        u64 const val = key * 10;
+        err = put_lru_cache_59(cache, &key, &val);
+        assert(ERR_NONE == err);
+    }
+    printf("Assert: ERR_NONE == %d = put_lru_cache() up to capacity\n", err);
+    assert(_matches(cache, (u64[]){ 3, 2, 1 }, 3) && 0 == log.count);
+
+    u64 key = 1;
+    void* val = (void*)0;
+    err = get_lru_cache_59(cache, &key, &val);
+    printf("Assert: ERR_NONE == %d = get_lru_cache() promotes\n", err);
+    assert(ERR_NONE == err && 10 == *(u64*)val && 1 == cache->hits);
+    assert(_matches(cache, (u64[]){ 1, 3, 2 }, 3));
+
+    // Values are updated in place through the returned pointer.
+    *(u64*)val = 11;
+
+    key = 4;
+    err = get_lru_cache_59(cache, &key, &val);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = get_lru_cache() miss\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err && !val && 1 == cache->misses);
+
+    // Test eviction
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test eviction...");
+
+    u64 new_val = 40;
+    err = put_lru_cache_59(cache, &key, &new_val);
+    printf("Assert: ERR_NONE == %d = put_lru_cache() evicts the least recently used\n", err);
+    assert(ERR_NONE == err && 1 == log.count && 2 == log.keys[0] && 20 == log.vals[0] && 1 == cache->evictions);
+    assert(_matches(cache, (u64[]){ 4, 1, 3 }, 3));
+
+    key = 2;
+    err = peek_lru_cache_59(cache, &key, &val);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = peek_lru_cache() evicted key\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err && !val);
+
+    // Peeking leaves the recency and the counters alone, so 3 is still next out.
+    key = 3;
+    err = peek_lru_cache_59(cache, &key, &val);
+    printf("Assert: ERR_NONE == %d = peek_lru_cache()\n", err);
+    assert(ERR_NONE == err && 30 == *(u64*)val && 1 == cache->hits && 1 == cache->misses);
+    assert(_matches(cache, (u64[]){ 4, 1, 3 }, 3));
+
+    // Putting a cached key replaces its value and promotes it without evicting.
+    key = 3;
+    new_val = 33;
+    err = put_lru_cache_59(cache, &key, &new_val);
+    printf("Assert: ERR_NONE == %d = put_lru_cache() existing key\n", err);
+    assert(ERR_NONE == err && 1 == log.count);
+    assert(_matches(cache, (u64[]){ 3, 4, 1 }, 3));
+
+    key = 5;
+    new_val = 50;
+    err = put_lru_cache_59(cache, &key, &new_val);
+    assert(ERR_NONE == err && 2 == log.count && 1 == log.keys[1] && 11 == log.vals[1]);
+    assert(_matches(cache, (u64[]){ 5, 3, 4 }, 3));
+
+    // Test remove
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test remove_from_lru_cache...");
+
+    key = 3;
+    u64 out = 0;
+    err = remove_from_lru_cache_59(cache, &key, &out);
+    printf("Assert: ERR_NONE == %d = remove_from_lru_cache()\n", err);
+    assert(ERR_NONE == err && 33 == out && 2 == log.count);
+    assert(_matches(cache, (u64[]){ 5, 4 }, 2));
+
+    size_t size = 0;
+    err = size_lru_cache_59(cache, &size);
+    printf("Assert: ERR_NONE == %d = size_lru_cache()\n", err);
+    assert(ERR_NONE == err && 2 == size);
+
+    // The freed room is filled before anything is evicted again.
+    key = 6;
+    err = put_lru_cache_59(cache, &key, &new_val);
+    assert(ERR_NONE == err && 2 == log.count);
+    assert(_matches(cache, (u64[]){ 6, 5, 4 }, 3));
+
+    err = deinit_lru_cache_59(&cache);
+    printf("Assert: ERR_NONE == %d = deinit_lru_cache() skips the callback\n", err);
+    assert(ERR_NONE == err && !cache && 2 == log.count);
+
+    // Test STR keys
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test STR keys...");
+
+    err = init_lru_cache_59(&cache, STR, U32_PTR, 2, 2);
+    printf("Assert: ERR_NONE == %d = init_lru_cache() STR keys\n", err);
+    assert(ERR_NONE == err && 0 == cache->key_size && 2 * sizeof(u32) == cache->val_size);
+
+    u32 pair[2] = { 5, 9 };
+    err = put_lru_cache_59(cache, "alpha", pair);
+    assert(ERR_NONE == err);
+    pair[0] = 6;
+    err = put_lru_cache_59(cache, "beta", pair);
+    assert(ERR_NONE == err);
+
+    // A key's length is part of the match, "alph" is not a prefix hit.
+    err = get_lru_cache_59(cache, "alph", &val);
+    assert(ERR_OBJ_NOT_FOUND == err);
+    err = get_lru_cache_59(cache, "alpha", &val);
+    printf("Assert: ERR_NONE == %d = get_lru_cache() STR key\n", err);
+    assert(ERR_NONE == err && 5 == ((u32*)val)[0] && 9 == ((u32*)val)[1]);
+
+    // A longer key than the victim's is given its own allocation.
+    char long_key[64] = "a key much longer than beta, evicting it";
+    err = put_lru_cache_59(cache, long_key, pair);
+    printf("Assert: ERR_NONE == %d = put_lru_cache() evicts a STR key\n", err);
+    assert(ERR_NONE == err && 1 == cache->evictions);
+    err = peek_lru_cache_59(cache, "beta", &val);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+    // Keys are copied in, the caller's buffer may change.
+    strcpy(long_key, "reused");
+    err = peek_lru_cache_59(cache, "a key much longer than beta, evicting it", &val);
+    assert(ERR_NONE == err && 6 == ((u32*)val)[0]);
+
+    err = deinit_lru_cache_59(&cache);
+    assert(ERR_NONE == err);
+
+    // Test against a plain array kept in recency order
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test random operations against an array...");
+
+    err = init_lru_cache_59(&cache, U64_PTR, U64_PTR, 0, TEST_LRU_CACHE_CAPACITY);
+    assert(ERR_NONE == err);
+
+    u64 expected[TEST_LRU_CACHE_CAPACITY] = { 0 };
+    size_t expected_size = 0;
+    u64 hits = 0;
+    u64 rng = 59;
+    for (size_t op = 0; op < TEST_LRU_CACHE_OPS; op++)
+    {
+        key = _xorshift(&rng) % (TEST_LRU_CACHE_CAPACITY * 2);
+        size_t at = 0;
+        while (at < expected_size && expected[at] != key)
+            at++;
+
+        if (0 == _xorshift(&rng) % 8 && at < expected_size)
+        {
+            err = remove_from_lru_cache_59(cache, &key, &out);
+            assert(ERR_NONE == err && key * 3 == out);
+            memmove(&expected[at], &expected[at + 1], (expected_size - at - 1) * sizeof(u64));
+            expected_size--;
+            continue;
+        }
+
+        err = get_lru_cache_59(cache, &key, &val);
+        if (at < expected_size)
+        {
+            assert(ERR_NONE == err && key * 3 == *(u64*)val);
+            hits++;
+        }
+        else
+        {
+            assert(ERR_OBJ_NOT_FOUND == err);
+            new_val = key * 3;
+            err = put_lru_cache_59(cache, &key, &new_val);
+            assert(ERR_NONE == err);
+            if (TEST_LRU_CACHE_CAPACITY == expected_size)
+                at = --expected_size;
+            else
+                at = expected_size;
+            expected_size++;
+        }
+        memmove(&expected[1], &expected[0], at * sizeof(u64));
+        expected[0] = key;
+    }
+    printf("Assert: %lu == %lu hits\n", hits, cache->hits);
+    assert(hits == cache->hits && TEST_LRU_CACHE_OPS > cache->hits + cache->misses);
+    assert(_matches(cache, expected, expected_size));
+
+    // Test clean up
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test clean up...");
+    err = deinit_lru_cache_59(&cache);
+
+    return err;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    puts("- - -  START OF LRU CACHE TEST  - - -");
+    puts("- - - LRU CACHE INTERFACE - - -");
+
+    ERR_59_e err = test_lru_cache_59_interface();
+    printf("ERROR CODE: %d\n", err);
+    assert(ERR_NONE == err);
+
+    puts("- - - - END OF LRU CACHE TEST - - - -");
+    return err;
+}
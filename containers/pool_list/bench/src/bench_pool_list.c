@@ -0,0 +1,261 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Benchmark of the index linked pool list against dlist_59 with one allocation per node and object.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "dlist.h"
+#include "pool_list.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Default number of objects in the benchmarked lists, override with the first program argument.
+ **********************************************************************************************************************/
+#define BENCH_DEFAULT_ENTRIES (1UL << 20)
+
+/***********************************************************************************************************************
+ * @brief: Number of full traversals timed per list.
+ **********************************************************************************************************************/
+#define BENCH_TRAVERSALS 10
+
+/*
+========================================================================================================================
+- - BENCH HELPERS - -
+========================================================================================================================
+*/
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static u64 xorshift(u64* state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    size_t const entries = (1 < argc) ? strtoul(argv[1], (void*)0, 10) : BENCH_DEFAULT_ENTRIES;
+    if (2 > entries || POOL_LIST_MAX_CAPACITY < entries)
+        return ERR_INV_PARAM;
+
+    // Handles to every entry in push order, shuffled later so removals hit the lists at random.
+    dlist_node_59** dlist_nodes = malloc(sizeof(dlist_node_59*) * entries);
+    u32* pool_idxs = malloc(sizeof(u32) * entries);
+    if (!dlist_nodes || !pool_idxs)
+        return ERR_NO_MEM;
+
+    dlist_59* dlist = (void*)0;
+    ERR_59_e err = init_dlist_59(&dlist, U64_PTR, 0);
+    if (ERR_NONE != err)
+        return err;
+    double start = now_ns();
+    for (size_t i = 0; i < entries; i++)
+    {
+        u64* obj = malloc(sizeof(u64));
+        if (!obj)
+            return ERR_NO_MEM;
+        *obj = i;
+        err = init_dlist_node_59(&dlist_nodes[i], (void*)0, (void*)0, obj);
+        if (ERR_NONE != err)
+            return err;
+        err = push_back_dlist_59(dlist, dlist_nodes[i]);
+        if (ERR_NONE != err)
+            return err;
+    }
+    double const dlist_push_ns = (now_ns() - start) / (double)entries;
+
+    pool_list_59* pool = (void*)0;
+    err = init_pool_list_59(&pool, U64_PTR, 0, 0);
+    if (ERR_NONE != err)
+        return err;
+    start = now_ns();
+    for (u64 i = 0; i < entries; i++)
+    {
+        err = push_back_pool_list_59(pool, &i, &pool_idxs[i]);
+        if (ERR_NONE != err)
+            return err;
+    }
+    double const pool_push_ns = (now_ns() - start) / (double)entries;
+
+    u64 checksum = 0;
+    start = now_ns();
+    for (size_t t = 0; t < BENCH_TRAVERSALS; t++)
+    {
+        for (dlist_node_59 const* node = dlist->head; node; node = node->next)
+            checksum += *(u64*)node->node_obj;
+    }
+    double const dlist_walk_ns = (now_ns() - start) / (double)(entries * BENCH_TRAVERSALS);
+
+    start = now_ns();
+    for (size_t t = 0; t < BENCH_TRAVERSALS; t++)
+    {
+        for (u32 idx = pool->head; POOL_LIST_NIL != idx;)
+        {
+            void* obj = (void*)0;
+            get_obj_pool_list_59(pool, idx, &obj);
+            checksum -= *(u64*)obj;
+            next_in_pool_list_59(pool, idx, &idx);
+        }
+    }
+    double const pool_walk_ns = (now_ns() - start) / (double)(entries * BENCH_TRAVERSALS);
+
+    // Remove a random half through the handles, then push as many again so the freed slots are reused.
+    u64 rng = 59;
+    for (size_t i = entries - 1; 0 < i; i--)
+    {
+        size_t const j = (size_t)(xorshift(&rng) % (i + 1));
+        dlist_node_59* node = dlist_nodes[i];
+        dlist_nodes[i] = dlist_nodes[j];
+        dlist_nodes[j] = node;
+        u32 const idx = pool_idxs[i];
+        pool_idxs[i] = pool_idxs[j];
+        pool_idxs[j] = idx;
+    }
+
+    start = now_ns();
+    for (size_t i = 0; i < entries / 2; i++)
+    {
+        err = unlink_node_from_dlist_59(dlist, dlist_nodes[i]);
+        if (ERR_NONE != err)
+            return err;
+        deinit_dlist_node_59(&dlist_nodes[i]);
+    }
+    for (size_t i = 0; i < entries / 2; i++)
+    {
+        u64* obj = malloc(sizeof(u64));
+        if (!obj)
+            return ERR_NO_MEM;
+        *obj = i;
+        err = init_dlist_node_59(&dlist_nodes[i], (void*)0, (void*)0, obj);
+        if (ERR_NONE != err)
+            return err;
+        err = push_back_dlist_59(dlist, dlist_nodes[i]);
+        if (ERR_NONE != err)
+            return err;
+    }
+    double const dlist_churn_ns = (now_ns() - start) / (double)entries;
+
+    start = now_ns();
+    for (size_t i = 0; i < entries / 2; i++)
+    {
+        err = remove_from_pool_list_59(pool, pool_idxs[i], (void*)0);
+        if (ERR_NONE != err)
+            return err;
+    }
+    for (u64 i = 0; i < entries / 2; i++)
+    {
+        err = push_back_pool_list_59(pool, &i, &pool_idxs[i]);
+        if (ERR_NONE != err)
+            return err;
+    }
+    double const pool_churn_ns = (now_ns() - start) / (double)entries;
+
+    start = now_ns();
+    for (size_t t = 0; t < BENCH_TRAVERSALS; t++)
+    {
+        for (dlist_node_59 const* node = dlist->head; node; node = node->next)
+            checksum += *(u64*)node->node_obj;
+    }
+    double const dlist_churned_walk_ns = (now_ns() - start) / (double)(entries * BENCH_TRAVERSALS);
+
+    start = now_ns();
+    for (size_t t = 0; t < BENCH_TRAVERSALS; t++)
+    {
+        for (u32 idx = pool->head; POOL_LIST_NIL != idx;)
+        {
+            void* obj = (void*)0;
+            get_obj_pool_list_59(pool, idx, &obj);
+            checksum -= *(u64*)obj;
+            next_in_pool_list_59(pool, idx, &idx);
+        }
+    }
+    double const pool_churned_walk_ns = (now_ns() - start) / (double)(entries * BENCH_TRAVERSALS);
+
+    size_t const pool_bytes = (size_t)pool->capacity * pool->stride;
+
+    start = now_ns();
+    deinit_dlist_59(&dlist);
+    double const dlist_free_ms = (now_ns() - start) / 1e6;
+
+    start = now_ns();
+    deinit_pool_list_59(&pool);
+    double const pool_free_ms = (now_ns() - start) / 1e6;
+
+    printf("entries: %zu\n", entries);
+    printf("dlist: %zu bytes of nodes and objects before malloc overhead, 2 allocations per entry\n",
+           entries * (sizeof(dlist_node_59) + sizeof(u64)));
+    printf("pool:  %zu bytes of slots, 1 allocation\n", pool_bytes);
+    printf("dlist push_back:             %10.2f ns/obj\n", dlist_push_ns);
+    printf("pool push_back:              %10.2f ns/obj\n", pool_push_ns);
+    printf("dlist traversal:             %10.2f ns/obj\n", dlist_walk_ns);
+    printf("pool traversal:              %10.2f ns/obj\n", pool_walk_ns);
+    printf("dlist remove + push half:    %10.2f ns/obj\n", dlist_churn_ns);
+    printf("pool remove + push half:     %10.2f ns/obj\n", pool_churn_ns);
+    printf("dlist traversal after churn: %10.2f ns/obj\n", dlist_churned_walk_ns);
+    printf("pool traversal after churn:  %10.2f ns/obj\n", pool_churned_walk_ns);
+    printf("dlist deinit:                %10.2f ms\n", dlist_free_ms);
+    printf("pool deinit:                 %10.2f ms\n", pool_free_ms);
+    printf("checksum: %lu\n", checksum);
+
+    free(pool_idxs);
+    free(dlist_nodes);
+
+    return ERR_NONE;
+}
@@ -0,0 +1,284 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: This file contains the declarations for a doubly linked list whose nodes live in one pooled array and link by
+ * 32-bit index.
+ **********************************************************************************************************************/
+
+#pragma once
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "containers_common.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Index standing in for a NULL link, returned by traversal past either end of the list.
+ **********************************************************************************************************************/
+#define POOL_LIST_NIL UINT32_MAX
+
+/***********************************************************************************************************************
+ * @brief: Marker held in the @last link of free slots, so a stale index is caught in O(1).
+ **********************************************************************************************************************/
+#define POOL_LIST_FREE (UINT32_MAX - 1)
+
+/***********************************************************************************************************************
+ * @brief: Most slots a pool may hold, every index stays below the two markers.
+ **********************************************************************************************************************/
+#define POOL_LIST_MAX_CAPACITY (UINT32_MAX - 1)
+
+/***********************************************************************************************************************
+ * @brief: Number of slots allocated when a capacity of 0 is passed to @init_pool_list_59.
+ **********************************************************************************************************************/
+#define DEFAULT_POOL_LIST_CAPACITY 16
+
+/*
+========================================================================================================================
+- - TYPEDEFS - -
+========================================================================================================================
+*/
+
+typedef struct pool_list_link_59 pool_list_link_59;
+typedef struct pool_list_59 pool_list_59;
+
+/*
+========================================================================================================================
+- - STRUCTS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @pool_list_link_59
+ * @brief: Links at the start of every slot of a pool list, the slot's object follows them.
+ *
+ * @next: index of the next slot, @POOL_LIST_NIL at the tail. Free slots chain through it too.
+ * @last: index of the last slot, @POOL_LIST_NIL at the head or @POOL_LIST_FREE when the slot is free.
+ *
+ * @see pool_list_59
+ **********************************************************************************************************************/
+struct pool_list_link_59
+{
+    u32 next;
+    u32 last;
+};
+
+/***********************************************************************************************************************
+ * @pool_list_59
+ * @brief: Represents a doubly linked list held in one array of slots. A slot is 8 bytes of index links followed by a
+ * copy of its object, so there is no allocation per node, a teardown is one free, and because links are indices the
+ * slots can be moved or written out with a plain memcpy. Freed slots are reused before the array grows.
+ *
+ * @slots: array of @capacity slots of @stride bytes.
+ * @stride: bytes per slot, the links plus the object rounded up to 8 bytes.
+ * @obj_size: bytes copied in and out per object.
+ * @capacity: number of slots in @slots.
+ * @size: number of objects in the list.
+ * @head: index of the first slot, @POOL_LIST_NIL when empty.
+ * @tail: index of the last slot, @POOL_LIST_NIL when empty.
+ * @free: index of the first free slot, @POOL_LIST_NIL when every slot is in use.
+ * @type: type of the list's objects, must be a fixed size type.
+ * @type_depth: number of objects of @type in each element, 0 is treated as 1.
+ *
+ * @note Indices stay valid until their object is removed, even when the array grows. Object pointers returned by
+ * @get_obj_pool_list_59 are only valid until the next push or insert, which may move the array.
+ **********************************************************************************************************************/
+struct pool_list_59
+{
+    u8* slots;
+    size_t stride;
+    size_t obj_size;
+    u32 capacity;
+    u32 size;
+    u32 head;
+    u32 tail;
+    u32 free;
+    TYPE_59_e type;
+    size_t type_depth;
+};
+
+/*
+========================================================================================================================
+- - MODULE FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Initializes an empty pool list, this also allocates memory to the @list pointer.
+ *
+ * @param[out] list: Pool list pointer to initialize. @warning This must be freed when its lifetime has ended.
+ * @param[in] type: Type of the list's objects, must be a fixed size type.
+ * @param[in] type_depth: Number of objects of @type in each element, 0 is treated as 1.
+ * @param[in] capacity: Slots to allocate up front, if 0 then @DEFAULT_POOL_LIST_CAPACITY is used.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note ERR_NOT_SUPPORTED is returned for types without a fixed size, see get_type_size_59().
+ **********************************************************************************************************************/
+ERR_59_e
+init_pool_list_59(pool_list_59** list, TYPE_59_e const type, size_t const type_depth, size_t const capacity);
+
+/***********************************************************************************************************************
+ * @brief: Deinits the passed pool list, freeing its slots and every object in them.
+ *
+ * @param[out] list: Pool list to deinit, set to (void*)0 on return.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e deinit_pool_list_59(pool_list_59** list);
+
+/***********************************************************************************************************************
+ * @brief: Copies a pool list, its slots are duplicated with a single memcpy since no link holds an address.
+ *
+ * @param[in] src: Pool list to copy.
+ * @param[out] dest: Pool list pointer to initialize with the copy, indices of @src are valid in it.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e copy_pool_list_59(pool_list_59 const* const src, pool_list_59** dest);
+
+/***********************************************************************************************************************
+ * @brief: Copies the passed object into a new slot at the back of the list.
+ *
+ * @param[in] list: Pool list to push onto.
+ * @param[in] obj: Object to copy in.
+ * @param[out] idx: Index of the new slot, may be (void*)0.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e push_back_pool_list_59(pool_list_59* const list, void const* const obj, u32* const idx);
+
+/***********************************************************************************************************************
+ * @brief: Copies the passed object into a new slot at the front of the list.
+ *
+ * @param[in] list: Pool list to push onto.
+ * @param[in] obj: Object to copy in.
+ * @param[out] idx: Index of the new slot, may be (void*)0.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e push_front_pool_list_59(pool_list_59* const list, void const* const obj, u32* const idx);
+
+/***********************************************************************************************************************
+ * @brief: Copies the passed object into a new slot linked in front of the slot at @before.
+ *
+ * @param[in] list: Pool list to insert into.
+ * @param[in] before: Index of the slot to insert in front of, @POOL_LIST_NIL appends to the list.
+ * @param[in] obj: Object to copy in.
+ * @param[out] idx: Index of the new slot, may be (void*)0.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note ERR_INV_PARAM is returned if @before is not the index of an object in the list.
+ **********************************************************************************************************************/
+ERR_59_e
+insert_before_pool_list_59(pool_list_59* const list, u32 const before, void const* const obj, u32* const idx);
+
+/***********************************************************************************************************************
+ * @brief: Removes the front object of the list.
+ *
+ * @param[in] list: Pool list to pop from.
+ * @param[out] obj: Buffer of at least @obj_size bytes receiving a copy of the object, may be (void*)0.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e pop_front_pool_list_59(pool_list_59* const list, void* const obj);
+
+/***********************************************************************************************************************
+ * @brief: Removes the back object of the list.
+ *
+ * @param[in] list: Pool list to pop from.
+ * @param[out] obj: Buffer of at least @obj_size bytes receiving a copy of the object, may be (void*)0.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e pop_back_pool_list_59(pool_list_59* const list, void* const obj);
+
+/***********************************************************************************************************************
+ * @brief: Removes the object at the passed index in O(1), its slot is reused by a later push or insert.
+ *
+ * @param[in] list: Pool list to remove from.
+ * @param[in] idx: Index of the object to remove.
+ * @param[out] obj: Buffer of at least @obj_size bytes receiving a copy of the object, may be (void*)0.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note ERR_INV_PARAM is returned if @idx is not the index of an object in the list.
+ **********************************************************************************************************************/
+ERR_59_e remove_from_pool_list_59(pool_list_59* const list, u32 const idx, void* const obj);
+
+/***********************************************************************************************************************
+ * @brief: Gets a pointer to the object at the passed index.
+ *
+ * @param[in] list: Pool list to read.
+ * @param[in] idx: Index of the object.
+ * @param[out] obj: Pointer to the object inside the pool.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @warning The pointer is only valid until the next push or insert, which may move the pool.
+ **********************************************************************************************************************/
+ERR_59_e get_obj_pool_list_59(pool_list_59 const* const list, u32 const idx, void** const obj);
+
+/***********************************************************************************************************************
+ * @brief: Gets the index after the passed one, start a walk from @head and stop at @POOL_LIST_NIL.
+ *
+ * @param[in] list: Pool list to walk.
+ * @param[in] idx: Index of an object in the list.
+ * @param[out] next: Index of the next object, @POOL_LIST_NIL after the tail.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e next_in_pool_list_59(pool_list_59 const* const list, u32 const idx, u32* const next);
+
+/***********************************************************************************************************************
+ * @brief: Gets the index before the passed one, start a walk from @tail and stop at @POOL_LIST_NIL.
+ *
+ * @param[in] list: Pool list to walk.
+ * @param[in] idx: Index of an object in the list.
+ * @param[out] last: Index of the last object, @POOL_LIST_NIL before the head.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e last_in_pool_list_59(pool_list_59 const* const list, u32 const idx, u32* const last);
@@ -0,0 +1,367 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: This file contains the definitions for a doubly linked list whose nodes live in one pooled array and link by
+ * 32-bit index.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "pool_list.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Alignment of every slot, and so of the object following the links.
+ **********************************************************************************************************************/
+#define POOL_LIST_SLOT_ALIGN (sizeof(u64))
+
+/*
+========================================================================================================================
+- - INTERNAL FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Gets the links of the slot at the passed index.
+ *
+ * @param[in] list: Pool list holding the slot.
+ * @param[in] idx: Index of the slot, must be below @capacity.
+ *
+ * @retval pool_list_link_59*: links at the start of the slot.
+ **********************************************************************************************************************/
+static pool_list_link_59* _link_pool_list_59(pool_list_59 const* const list, u32 const idx)
+{
+    return (pool_list_link_59*)(void*)(list->slots + (size_t)idx * list->stride);
+}
+
+/***********************************************************************************************************************
+ * @brief: Gets the object of the slot at the passed index, it follows the slot's links.
+ *
+ * @param[in] list: Pool list holding the slot.
+ * @param[in] idx: Index of the slot, must be below @capacity.
+ *
+ * @retval u8*: first byte of the object.
+ **********************************************************************************************************************/
+static u8* _obj_pool_list_59(pool_list_59 const* const list, u32 const idx)
+{
+    return list->slots + (size_t)idx * list->stride + sizeof(pool_list_link_59);
+}
+
+/***********************************************************************************************************************
+ * @brief: Checks the passed index is a slot holding an object of the list.
+ *
+ * @param[in] list: Pool list to check.
+ * @param[in] idx: Index to check.
+ *
+ * @retval bool: true if @idx is in use.
+ **********************************************************************************************************************/
+static bool _in_use_pool_list_59(pool_list_59 const* const list, u32 const idx)
+{
+    return idx < list->capacity && POOL_LIST_FREE != _link_pool_list_59(list, idx)->last;
+}
+
+/***********************************************************************************************************************
+ * @brief: Chains the slots from @first up to @capacity onto the free list, lowest index first.
+ *
+ * @param[in] list: Pool list whose slots are freed.
+ * @param[in] first: Index of the first slot to chain.
+ **********************************************************************************************************************/
+static void _chain_free_pool_list_59(pool_list_59* const list, u32 const first)
+{
+    for (u32 i = list->capacity; i > first; i--)
+    {
+        pool_list_link_59* link = _link_pool_list_59(list, i - 1);
+        link->next = list->free;
+        link->last = POOL_LIST_FREE;
+        list->free = i - 1;
+    }
+}
+
+/***********************************************************************************************************************
+ * @brief: Takes a free slot, doubling the pool when none is left, and copies the object into it.
+ *
+ * @param[in] list: Pool list to take a slot from.
+ * @param[in] obj: Object to copy into the slot.
+ * @param[out] idx: Index of the slot, not yet linked into the list.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _take_slot_pool_list_59(pool_list_59* const list, void const* const obj, u32* const idx)
+{
+    if (POOL_LIST_NIL == list->free)
+    {
+        if (POOL_LIST_MAX_CAPACITY == list->capacity)
+            return ERR_CONTAINER_AT_CAPACITY;
+
+        u32 const capacity = (list->capacity > POOL_LIST_MAX_CAPACITY / 2) ? POOL_LIST_MAX_CAPACITY
+                                                                             : list->capacity * 2;
+        u8* slots = realloc(list->slots, (size_t)capacity * list->stride);
+        if (!slots)
+            return ERR_NO_MEM;
+
+        u32 const old_capacity = list->capacity;
+        list->slots = slots;
+        list->capacity = capacity;
+        _chain_free_pool_list_59(list, old_capacity);
+    }
+
+    *idx = list->free;
+    list->free = _link_pool_list_59(list, *idx)->next;
+    memcpy(_obj_pool_list_59(list, *idx), obj, list->obj_size);
+    list->size++;
+
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Links a taken slot in front of @before, or at the back when @before is @POOL_LIST_NIL.
+ *
+ * @param[in] list: Pool list to link into.
+ * @param[in] before: Index of the slot to link in front of.
+ * @param[in] idx: Index of the slot to link.
+ **********************************************************************************************************************/
+static void _link_before_pool_list_59(pool_list_59* const list, u32 const before, u32 const idx)
+{
+    pool_list_link_59* link = _link_pool_list_59(list, idx);
+    link->next = before;
+    link->last = (POOL_LIST_NIL == before) ? list->tail : _link_pool_list_59(list, before)->last;
+
+    if (POOL_LIST_NIL == link->last)
+        list->head = idx;
+    else
+        _link_pool_list_59(list, link->last)->next = idx;
+
+    if (POOL_LIST_NIL == before)
+        list->tail = idx;
+    else
+        _link_pool_list_59(list, before)->last = idx;
+}
+
+/*
+========================================================================================================================
+- - FUNCTION DEFINITIONS - -
+========================================================================================================================
+*/
+
+ERR_59_e
+init_pool_list_59(pool_list_59** list, TYPE_59_e const type, size_t const type_depth, size_t const capacity)
+{
+    if (!list || POOL_LIST_MAX_CAPACITY < capacity)
+        return ERR_INV_PARAM;
+
+    size_t obj_size = 0;
+    ERR_59_e err = get_type_size_59(type, &obj_size);
+    if (ERR_NONE != err)
+        return err;
+    if (1 < type_depth)
+        obj_size *= type_depth;
+
+    pool_list_59* new_list = malloc(sizeof(pool_list_59));
+    if (!new_list)
+        return ERR_NO_MEM;
+
+    new_list->stride = (sizeof(pool_list_link_59) + obj_size + POOL_LIST_SLOT_ALIGN - 1) & ~(POOL_LIST_SLOT_ALIGN - 1);
+    new_list->capacity = (u32)(capacity ? capacity : DEFAULT_POOL_LIST_CAPACITY);
+    new_list->slots = malloc((size_t)new_list->capacity * new_list->stride);
+    if (!new_list->slots)
+    {
+        free(new_list);
+        return ERR_NO_MEM;
+    }
+
+    new_list->obj_size = obj_size;
+    new_list->size = 0;
+    new_list->head = POOL_LIST_NIL;
+    new_list->tail = POOL_LIST_NIL;
+    new_list->free = POOL_LIST_NIL;
+    new_list->type = type;
+    new_list->type_depth = type_depth;
+    _chain_free_pool_list_59(new_list, 0);
+    *list = new_list;
+
+    return ERR_NONE;
+}
+
+ERR_59_e deinit_pool_list_59(pool_list_59** list)
+{
+    if (!list || !(*list))
+        return ERR_INV_PARAM;
+
+    // Objects are held in the slots, so the whole list goes with one free.
+    free((*list)->slots);
+    free((*list));
+    *list = (void*)0;
+
+    return ERR_NONE;
+}
+
+ERR_59_e copy_pool_list_59(pool_list_59 const* const src, pool_list_59** dest)
+{
+    if (!src || !dest)
+        return ERR_INV_PARAM;
+
+    pool_list_59* new_list = malloc(sizeof(pool_list_59));
+    if (!new_list)
+        return ERR_NO_MEM;
+
+    *new_list = *src;
+    new_list->slots = malloc((size_t)src->capacity * src->stride);
+    if (!new_list->slots)
+    {
+        free(new_list);
+        return ERR_NO_MEM;
+    }
+    memcpy(new_list->slots, src->slots, (size_t)src->capacity * src->stride);
+    *dest = new_list;
+
+    return ERR_NONE;
+}
+
+ERR_59_e push_back_pool_list_59(pool_list_59* const list, void const* const obj, u32* const idx)
+{
+    return insert_before_pool_list_59(list, POOL_LIST_NIL, obj, idx);
+}
+
+ERR_59_e push_front_pool_list_59(pool_list_59* const list, void const* const obj, u32* const idx)
+{
+    if (!list)
+        return ERR_INV_PARAM;
+
+    return insert_before_pool_list_59(list, list->head, obj, idx);
+}
+
+ERR_59_e
+insert_before_pool_list_59(pool_list_59* const list, u32 const before, void const* const obj, u32* const idx)
+{
+    if (!list || !obj || (POOL_LIST_NIL != before && !_in_use_pool_list_59(list, before)))
+        return ERR_INV_PARAM;
+
+    u32 new_idx = POOL_LIST_NIL;
+    ERR_59_e err = _take_slot_pool_list_59(list, obj, &new_idx);
+    if (ERR_NONE != err)
+        return err;
+
+    _link_before_pool_list_59(list, before, new_idx);
+    if (idx)
+        *idx = new_idx;
+
+    return ERR_NONE;
+}
+
+ERR_59_e pop_front_pool_list_59(pool_list_59* const list, void* const obj)
+{
+    if (!list)
+        return ERR_INV_PARAM;
+    if (POOL_LIST_NIL == list->head)
+        return ERR_CONTAINER_EMPTY;
+
+    return remove_from_pool_list_59(list, list->head, obj);
+}
+
+ERR_59_e pop_back_pool_list_59(pool_list_59* const list, void* const obj)
+{
+    if (!list)
+        return ERR_INV_PARAM;
+    if (POOL_LIST_NIL == list->tail)
+        return ERR_CONTAINER_EMPTY;
+
+    return remove_from_pool_list_59(list, list->tail, obj);
+}
+
+ERR_59_e remove_from_pool_list_59(pool_list_59* const list, u32 const idx, void* const obj)
+{
+    if (!list || !_in_use_pool_list_59(list, idx))
+        return ERR_INV_PARAM;
+
+    pool_list_link_59* link = _link_pool_list_59(list, idx);
+    if (POOL_LIST_NIL == link->last)
+        list->head = link->next;
+    else
+        _link_pool_list_59(list, link->last)->next = link->next;
+
+    if (POOL_LIST_NIL == link->next)
+        list->tail = link->last;
+    else
+        _link_pool_list_59(list, link->next)->last = link->last;
+
+    if (obj)
+        memcpy(obj, _obj_pool_list_59(list, idx), list->obj_size);
+
+    link->next = list->free;
+    link->last = POOL_LIST_FREE;
+    list->free = idx;
+    list->size--;
+
+    return ERR_NONE;
+}
+
+ERR_59_e get_obj_pool_list_59(pool_list_59 const* const list, u32 const idx, void** const obj)
+{
+    if (!list || !obj || !_in_use_pool_list_59(list, idx))
+        return ERR_INV_PARAM;
+
+    *obj = _obj_pool_list_59(list, idx);
+
+    return ERR_NONE;
+}
+
+ERR_59_e next_in_pool_list_59(pool_list_59 const* const list, u32 const idx, u32* const next)
+{
+    if (!list || !next || !_in_use_pool_list_59(list, idx))
+        return ERR_INV_PARAM;
+
+    *next = _link_pool_list_59(list, idx)->next;
+
+    return ERR_NONE;
+}
+
+ERR_59_e last_in_pool_list_59(pool_list_59 const* const list, u32 const idx, u32* const last)
+{
+    if (!list || !last || !_in_use_pool_list_59(list, idx))
+        return ERR_INV_PARAM;
+
+    *last = _link_pool_list_59(list, idx)->last;
+
+    return ERR_NONE;
+}
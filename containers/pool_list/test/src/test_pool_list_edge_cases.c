@@ -0,0 +1,215 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Unit tests for the pool list's edge cases.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "pool_list.h"
+
+/*
+========================================================================================================================
+- - UNIT TESTS - -
+========================================================================================================================
+*/
+
+ERR_59_e test_pool_list_59_edge_cases(void)
+{
+    ERR_59_e err = ERR_NONE;
+
+    // Init pool_list
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Initializing pool_list...");
+
+    pool_list_59* list = (void*)0;
+    err = init_pool_list_59(&list, U64_PTR, 0, 2);
+    if (ERR_NONE != err)
+        return err;
+
+    pool_list_59* list_dummy = (void*)0;
+    void* obj = (void*)0;
+    u32 idx = 0;
+    u64 val = 59;
+
+    // Test init_pool_list edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test init_pool_list and deinit_pool_list...");
+
+    err = init_pool_list_59((void*)0, U64_PTR, 0, 0);
+    printf("Assert: ERR_INV_PARAM == %d = init_pool_list()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = init_pool_list_59(&list_dummy, U64_PTR, 0, (size_t)POOL_LIST_MAX_CAPACITY + 1);
+    printf("Assert: ERR_INV_PARAM == %d = init_pool_list() capacity past the max\n", err);
+    assert(ERR_INV_PARAM == err && !list_dummy);
+
+    err = init_pool_list_59(&list_dummy, STR, 0, 0);
+    printf("Assert: ERR_NOT_SUPPORTED == %d = init_pool_list() string type\n", err);
+    assert(ERR_NOT_SUPPORTED == err && !list_dummy);
+
+    err = init_pool_list_59(&list_dummy, STRUCT_PTR, 0, 0);
+    printf("Assert: ERR_NOT_SUPPORTED == %d = init_pool_list() struct type\n", err);
+    assert(ERR_NOT_SUPPORTED == err && !list_dummy);
+
+    err = deinit_pool_list_59(&list_dummy);
+    printf("Assert: ERR_INV_PARAM == %d = deinit_pool_list() null list\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = copy_pool_list_59(list_dummy, &list_dummy);
+    printf("Assert: ERR_INV_PARAM == %d = copy_pool_list() null src\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = copy_pool_list_59(list, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = copy_pool_list() null dest\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    // Test empty list edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test empty pool_list...");
+
+    err = pop_front_pool_list_59(list, &val);
+    printf("Assert: ERR_CONTAINER_EMPTY == %d = pop_front_pool_list() empty list\n", err);
+    assert(ERR_CONTAINER_EMPTY == err);
+
+    err = pop_back_pool_list_59(list, &val);
+    printf("Assert: ERR_CONTAINER_EMPTY == %d = pop_back_pool_list() empty list\n", err);
+    assert(ERR_CONTAINER_EMPTY == err);
+
+    err = get_obj_pool_list_59(list, 0, &obj);
+    printf("Assert: ERR_INV_PARAM == %d = get_obj_pool_list() free slot\n", err);
+    assert(ERR_INV_PARAM == err && !obj);
+
+    err = insert_before_pool_list_59(list, 0, &val, &idx);
+    printf("Assert: ERR_INV_PARAM == %d = insert_before_pool_list() free slot\n", err);
+    assert(ERR_INV_PARAM == err && 0 == list->size);
+
+    // Test null params
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test null params...");
+
+    err = push_back_pool_list_59(list_dummy, &val, &idx);
+    printf("Assert: ERR_INV_PARAM == %d = push_back_pool_list()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = push_front_pool_list_59(list, (void*)0, &idx);
+    printf("Assert: ERR_INV_PARAM == %d = push_front_pool_list() null obj\n", err);
+    assert(ERR_INV_PARAM == err && 0 == list->size);
+
+    err = insert_before_pool_list_59(list_dummy, POOL_LIST_NIL, &val, &idx);
+    printf("Assert: ERR_INV_PARAM == %d = insert_before_pool_list()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = pop_front_pool_list_59(list_dummy, &val);
+    printf("Assert: ERR_INV_PARAM == %d = pop_front_pool_list()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = remove_from_pool_list_59(list_dummy, 0, &val);
+    printf("Assert: ERR_INV_PARAM == %d = remove_from_pool_list()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = get_obj_pool_list_59(list, 0, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = get_obj_pool_list() null out\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = next_in_pool_list_59(list, 0, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = next_in_pool_list() null out\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = last_in_pool_list_59(list_dummy, 0, &idx);
+    printf("Assert: ERR_INV_PARAM == %d = last_in_pool_list()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    // Test stale and out of range indexes
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test stale and out of range indexes...");
+
+    err = push_back_pool_list_59(list, &val, &idx);
+    assert(ERR_NONE == err && 1 == list->size);
+
+    err = get_obj_pool_list_59(list, list->capacity, &obj);
+    printf("Assert: ERR_INV_PARAM == %d = get_obj_pool_list() past the capacity\n", err);
+    assert(ERR_INV_PARAM == err && !obj);
+
+    err = next_in_pool_list_59(list, POOL_LIST_NIL, &idx);
+    printf("Assert: ERR_INV_PARAM == %d = next_in_pool_list() nil index\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    u32 const stale = idx;
+    err = remove_from_pool_list_59(list, stale, (void*)0);
+    assert(ERR_NONE == err && 0 == list->size);
+
+    err = remove_from_pool_list_59(list, stale, &val);
+    printf("Assert: ERR_INV_PARAM == %d = remove_from_pool_list() removed index\n", err);
+    assert(ERR_INV_PARAM == err && 0 == list->size && list->free == stale);
+
+    err = last_in_pool_list_59(list, stale, &idx);
+    printf("Assert: ERR_INV_PARAM == %d = last_in_pool_list() removed index\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    // Test clean up
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test clean up...");
+    err = deinit_pool_list_59(&list);
+
+    return err;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    puts("- - -  START OF POOL LIST TEST  - - -");
+    puts("- - - POOL LIST EDGE CASES - - -");
+
+    ERR_59_e err = test_pool_list_59_edge_cases();
+    printf("ERROR CODE: %d\n", err);
+    assert(ERR_NONE == err);
+
+    puts("- - - - END OF POOL LIST TEST - - - -");
+    return err;
+}
@@ -0,0 +1,264 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Unit tests for the pool list's interface.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "pool_list.h"
+
+/*
+========================================================================================================================
+- - INTERNAL TEST HELPERS - -
+========================================================================================================================
+*/
+
+// The list must walk the expected objects in order from the head and in reverse from the tail.
+static bool _matches(pool_list_59 const* const list, u64 const* const expected, size_t const expected_size)
+{
+    size_t seen = 0;
+    u32 last = POOL_LIST_NIL;
+    for (u32 idx = list->head; POOL_LIST_NIL != idx; seen++)
+    {
+        void* obj = (void*)0;
+        u32 prev = 0;
+        if (seen >= expected_size || ERR_NONE != get_obj_pool_list_59(list, idx, &obj) || expected[seen] != *(u64*)obj)
+            return false;
+        if (ERR_NONE != last_in_pool_list_59(list, idx, &prev) || last != prev)
+            return false;
+        last = idx;
+        if (ERR_NONE != next_in_pool_list_59(list, idx, &idx))
+            return false;
+    }
+
+    return list->tail == last && expected_size == seen && list->size == seen;
+}
+
+/*
+========================================================================================================================
+- - UNIT TESTS - -
+========================================================================================================================
+*/
+
+ERR_59_e test_pool_list_59_interface(void)
+{
+    ERR_59_e err = ERR_NONE;
+
+    // Init pool_list
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Initializing pool_list...");
+
+    pool_list_59* list = (void*)0;
+    err = init_pool_list_59(&list, U64_PTR, 0, 4);
+    printf("Assert: ERR_NONE == %d = init_pool_list()\n", err);
+    assert(ERR_NONE == err && 4 == list->capacity && 0 == list->size);
+    printf("Assert: %zu == slot stride\n", list->stride);
+    assert(sizeof(pool_list_link_59) + sizeof(u64) == list->stride);
+
+    // Test push_back and push_front
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test push_back_pool_list and push_front_pool_list...");
+
+    u32 idxs[8] = { 0 };
+    u64 val = 2;
+    err = push_back_pool_list_59(list, &val, &idxs[2]);
+    assert(ERR_NONE == err);
+    val = 3;
+    err = push_back_pool_list_59(list, &val, &idxs[3]);
+    assert(ERR_NONE == err);
+    val = 1;
+    err = push_front_pool_list_59(list, &val, &idxs[1]);
+    assert(ERR_NONE == err);
+    val = 0;
+    err = push_front_pool_list_59(list, &val, &idxs[0]);
+    printf("Assert: ERR_NONE == %d = push_front_pool_list()\n", err);
+    assert(ERR_NONE == err);
+    assert(_matches(list, (u64[]){ 0, 1, 2, 3 }, 4));
+
+    // Growing the pool keeps every index valid since links never hold addresses.
+    val = 4;
+    err = push_back_pool_list_59(list, &val, &idxs[4]);
+    printf("Assert: ERR_NONE == %d = push_back_pool_list() past the initial capacity\n", err);
+    assert(ERR_NONE == err && 8 == list->capacity);
+    assert(_matches(list, (u64[]){ 0, 1, 2, 3, 4 }, 5));
+    for (u64 i = 0; i < 5; i++)
+    {
+        void* obj = (void*)0;
+        err = get_obj_pool_list_59(list, idxs[i], &obj);
+        assert(ERR_NONE == err && i == *(u64*)obj);
+    }
+
+    // Test insert_before
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test insert_before_pool_list...");
+
+    val = 5;
+    err = insert_before_pool_list_59(list, idxs[2], &val, &idxs[5]);
+    printf("Assert: ERR_NONE == %d = insert_before_pool_list() middle\n", err);
+    assert(ERR_NONE == err);
+    assert(_matches(list, (u64[]){ 0, 1, 5, 2, 3, 4 }, 6));
+
+    val = 6;
+    err = insert_before_pool_list_59(list, idxs[0], &val, &idxs[6]);
+    printf("Assert: ERR_NONE == %d = insert_before_pool_list() head\n", err);
+    assert(ERR_NONE == err && list->head == idxs[6]);
+
+    val = 7;
+    err = insert_before_pool_list_59(list, POOL_LIST_NIL, &val, &idxs[7]);
+    printf("Assert: ERR_NONE == %d = insert_before_pool_list() nil appends\n", err);
+    assert(ERR_NONE == err && list->tail == idxs[7]);
+    assert(_matches(list, (u64[]){ 6, 0, 1, 5, 2, 3, 4, 7 }, 8));
+
+    // Test remove and slot reuse
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test remove_from_pool_list...");
+
+    u64 out = 0;
+    err = remove_from_pool_list_59(list, idxs[5], &out);
+    printf("Assert: ERR_NONE == %d = remove_from_pool_list() middle\n", err);
+    assert(ERR_NONE == err && 5 == out);
+    err = remove_from_pool_list_59(list, idxs[6], (void*)0);
+    printf("Assert: ERR_NONE == %d = remove_from_pool_list() head, null out\n", err);
+    assert(ERR_NONE == err);
+    err = remove_from_pool_list_59(list, idxs[7], &out);
+    printf("Assert: ERR_NONE == %d = remove_from_pool_list() tail\n", err);
+    assert(ERR_NONE == err && 7 == out);
+    assert(_matches(list, (u64[]){ 0, 1, 2, 3, 4 }, 5));
+
+    // The most recently freed slot is handed out first.
+    u32 reused = 0;
+    val = 8;
+    err = push_back_pool_list_59(list, &val, &reused);
+    printf("Assert: %u == %u reused slot\n", idxs[7], reused);
+    assert(ERR_NONE == err && idxs[7] == reused && 8 == list->capacity);
+    assert(_matches(list, (u64[]){ 0, 1, 2, 3, 4, 8 }, 6));
+
+    // Test copy
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test copy_pool_list...");
+
+    pool_list_59* copy = (void*)0;
+    err = copy_pool_list_59(list, &copy);
+    printf("Assert: ERR_NONE == %d = copy_pool_list()\n", err);
+    assert(ERR_NONE == err && copy != list);
+    assert(_matches(copy, (u64[]){ 0, 1, 2, 3, 4, 8 }, 6));
+
+    // Indices of the source are valid in the copy and free slots carry over.
+    err = remove_from_pool_list_59(copy, idxs[2], &out);
+    assert(ERR_NONE == err && 2 == out);
+    val = 9;
+    err = push_front_pool_list_59(copy, &val, &reused);
+    assert(ERR_NONE == err && idxs[2] == reused);
+    assert(_matches(copy, (u64[]){ 9, 0, 1, 3, 4, 8 }, 6));
+    assert(_matches(list, (u64[]){ 0, 1, 2, 3, 4, 8 }, 6));
+
+    err = deinit_pool_list_59(&copy);
+    assert(ERR_NONE == err && !copy);
+
+    // Test pop_front and pop_back
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test pop_front_pool_list and pop_back_pool_list...");
+
+    err = pop_front_pool_list_59(list, &out);
+    printf("Assert: ERR_NONE == %d = pop_front_pool_list()\n", err);
+    assert(ERR_NONE == err && 0 == out);
+    err = pop_back_pool_list_59(list, &out);
+    printf("Assert: ERR_NONE == %d = pop_back_pool_list()\n", err);
+    assert(ERR_NONE == err && 8 == out);
+    assert(_matches(list, (u64[]){ 1, 2, 3, 4 }, 4));
+
+    while (list->size)
+    {
+        err = pop_back_pool_list_59(list, (void*)0);
+        assert(ERR_NONE == err);
+    }
+    assert(_matches(list, (void*)0, 0));
+    assert(POOL_LIST_NIL == list->head && POOL_LIST_NIL == list->tail);
+
+    // Test objects wider than one type
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test type_depth...");
+
+    pool_list_59* wide = (void*)0;
+    err = init_pool_list_59(&wide, U8_PTR, 3, 0);
+    printf("Assert: ERR_NONE == %d = init_pool_list() type_depth 3\n", err);
+    assert(ERR_NONE == err && 3 == wide->obj_size && DEFAULT_POOL_LIST_CAPACITY == wide->capacity);
+    assert(0 == wide->stride % 8);
+
+    u8 bytes[3] = { 5, 9, 59 };
+    u8 bytes_out[3] = { 0 };
+    err = push_back_pool_list_59(wide, bytes, (void*)0);
+    assert(ERR_NONE == err);
+    err = pop_front_pool_list_59(wide, bytes_out);
+    assert(ERR_NONE == err && 5 == bytes_out[0] && 9 == bytes_out[1] && 59 == bytes_out[2]);
+    err = deinit_pool_list_59(&wide);
+    assert(ERR_NONE == err);
+
+    // Test clean up
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test clean up...");
+    err = deinit_pool_list_59(&list);
+
+    return err;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    puts("- - -  START OF POOL LIST TEST  - - -");
+    puts("- - - POOL LIST INTERFACE - - -");
+
+    ERR_59_e err = test_pool_list_59_interface();
+    printf("ERROR CODE: %d\n", err);
+    assert(ERR_NONE == err);
+
+    puts("- - - - END OF POOL LIST TEST - - - -");
+    return err;
+}
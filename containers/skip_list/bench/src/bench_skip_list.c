@@ -0,0 +1,197 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Benchmarks positional access into a skip list against walking a linked list.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "llist.h"
+#include "skip_list.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Default number of objects in the benchmarked lists, override with the first program argument.
+ **********************************************************************************************************************/
+#define BENCH_DEFAULT_ENTRIES (1UL << 20)
+
+/***********************************************************************************************************************
+ * @brief: Number of timed operations on the skip list.
+ **********************************************************************************************************************/
+#define BENCH_SKIP_LIST_OPS 200000
+
+/***********************************************************************************************************************
+ * @brief: Number of timed operations on the linked list, each walks half the list on average.
+ **********************************************************************************************************************/
+#define BENCH_LLIST_OPS 200
+
+/*
+========================================================================================================================
+- - BENCH HELPERS - -
+========================================================================================================================
+*/
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static u64 xorshift(u64* state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    size_t const entries = (1 < argc) ? strtoul(argv[1], (void*)0, 10) : BENCH_DEFAULT_ENTRIES;
+    if (2 > entries)
+        return ERR_INV_PARAM;
+
+    skip_list_59* skip_list = (void*)0;
+    llist_59* llist = (void*)0;
+    ERR_59_e err = init_skip_list_59(&skip_list, U64_PTR, 0);
+    if (ERR_NONE != err)
+        return err;
+    err = init_llist_59(&llist, U64_PTR, 0);
+    if (ERR_NONE != err)
+        return err;
+
+    for (u64 i = 0; i < entries; i++)
+    {
+        u64* skip_obj = malloc(sizeof(u64));
+        u64* llist_obj = malloc(sizeof(u64));
+        if (!skip_obj || !llist_obj)
+            return ERR_NO_MEM;
+        *skip_obj = i;
+        *llist_obj = i;
+
+        err = insert_at_idx_skip_list_59(skip_list, skip_obj, SIZE_MAX);
+        if (ERR_NONE != err)
+            return err;
+        llist_node_59* node = (void*)0;
+        err = init_llist_node_59(&node, (void*)0, llist_obj);
+        if (ERR_NONE != err)
+            return err;
+        err = push_back_llist_59(llist, node);
+        if (ERR_NONE != err)
+            return err;
+    }
+
+    u64 checksum = 0;
+    u64 rng = 59;
+    void* obj = (void*)0;
+    double start = now_ns();
+    for (size_t i = 0; i < BENCH_SKIP_LIST_OPS; i++)
+    {
+        err = get_at_idx_skip_list_59(skip_list, (size_t)(xorshift(&rng) % entries), &obj);
+        if (ERR_NONE != err)
+            return err;
+        checksum += *(u64*)obj;
+    }
+    double const skip_get_ns = (now_ns() - start) / BENCH_SKIP_LIST_OPS;
+
+    llist_node_59* node = (void*)0;
+    start = now_ns();
+    for (size_t i = 0; i < BENCH_LLIST_OPS; i++)
+    {
+        err = get_at_idx_llist_59(llist, (size_t)(xorshift(&rng) % (entries - 1)), &node);
+        if (ERR_NONE != err)
+            return err;
+        checksum += *(u64*)node->node_obj;
+    }
+    double const llist_get_ns = (now_ns() - start) / BENCH_LLIST_OPS;
+
+    start = now_ns();
+    for (size_t i = 0; i < BENCH_SKIP_LIST_OPS; i++)
+    {
+        u64* skip_obj = malloc(sizeof(u64));
+        if (!skip_obj)
+            return ERR_NO_MEM;
+        *skip_obj = i;
+        err = insert_at_idx_skip_list_59(skip_list, skip_obj, (size_t)(xorshift(&rng) % skip_list->size));
+        if (ERR_NONE != err)
+            return err;
+    }
+    double const skip_insert_ns = (now_ns() - start) / BENCH_SKIP_LIST_OPS;
+
+    start = now_ns();
+    for (size_t i = 0; i < BENCH_LLIST_OPS; i++)
+    {
+        u64* llist_obj = malloc(sizeof(u64));
+        if (!llist_obj)
+            return ERR_NO_MEM;
+        *llist_obj = i;
+        err = init_llist_node_59(&node, (void*)0, llist_obj);
+        if (ERR_NONE != err)
+            return err;
+        err = insert_node_into_llist_59(llist, node, (size_t)(xorshift(&rng) % entries));
+        if (ERR_NONE != err)
+            return err;
+    }
+    double const llist_insert_ns = (now_ns() - start) / BENCH_LLIST_OPS;
+
+    printf("entries: %zu, skip list levels: %zu\n", entries, skip_list->level);
+    printf("skip list get_at_idx:    %12.2f ns/op\n", skip_get_ns);
+    printf("llist get_at_idx:        %12.2f ns/op\n", llist_get_ns);
+    printf("skip list insert_at_idx: %12.2f ns/op\n", skip_insert_ns);
+    printf("llist insert at idx:     %12.2f ns/op\n", llist_insert_ns);
+    printf("checksum: %lu\n", checksum);
+
+    deinit_skip_list_59(&skip_list);
+    deinit_llist_59(&llist);
+
+    return ERR_NONE;
+}
@@ -0,0 +1,225 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: This file contains all the declarations for the skip list, an ordered list with span counted links giving
+ * O(log n) access by index and by value.
+ **********************************************************************************************************************/
+
+#pragma once
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "containers_common.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Upper bound on the number of levels of a skip list, enough for 4^32 nodes at the 1 in 4 promotion rate.
+ **********************************************************************************************************************/
+#define SKIP_LIST_MAX_LEVEL 32
+
+/***********************************************************************************************************************
+ * @brief: Seed of the generator that picks node levels, every list starts from it so layouts are reproducible.
+ **********************************************************************************************************************/
+#define SKIP_LIST_SEED 59UL
+
+/*
+========================================================================================================================
+- - TYPEDEFS - -
+========================================================================================================================
+*/
+
+typedef struct skip_list_link_59 skip_list_link_59;
+typedef struct skip_list_node_59 skip_list_node_59;
+typedef struct skip_list_59 skip_list_59;
+
+/*
+========================================================================================================================
+- - STRUCTS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @skip_list_link_59
+ * @brief: Forward link of a node at one level.
+ *
+ * @next: Next node at this level, NULL at the end of the list.
+ * @span: Number of positions the link skips, from its node to @next. Counting @head as position 0, links ending the
+ * list span to the last position, @size.
+ **********************************************************************************************************************/
+struct skip_list_link_59
+{
+    skip_list_node_59* next;
+    size_t span;
+};
+
+/***********************************************************************************************************************
+ * @skip_list_node_59
+ * @brief: A node of a skip list, sized for its own number of levels so the average node carries 4/3 links.
+ *
+ * @node_obj: Pointer to the object at the node, owned by the list.
+ * @level: Number of links of the node.
+ * @links: Forward links of the node, @links[0] chains every node in order.
+ **********************************************************************************************************************/
+struct skip_list_node_59
+{
+    void* node_obj;
+    size_t level;
+    skip_list_link_59 links[];
+};
+
+/***********************************************************************************************************************
+ * @skip_list_59
+ * @brief: A list indexed by a skip list. Every link counts the positions it skips, so walking down the levels finds a
+ * position in O(log n) expected steps, and lists kept in order are searched by value the same way.
+ *
+ * @head: Sentinel node at position -1 with @SKIP_LIST_MAX_LEVEL links, its object is always NULL.
+ * @size: Number of nodes in the list, not counting @head.
+ * @level: Number of levels in use, the highest level of any node and at least 1.
+ * @type: Type of the node objects, used to order them with @compare_node_obj_59.
+ * @type_depth: If pointing at arrays with consistent size, place the size of the arrays here, otherwise leave as 0.
+ * @rng: State of the generator picking node levels.
+ *
+ * @note Walk the list in order by following @links[0] from @head.
+ **********************************************************************************************************************/
+struct skip_list_59
+{
+    skip_list_node_59* head;
+    size_t size;
+    size_t level;
+    TYPE_59_e type;
+    size_t type_depth;
+    u64 rng;
+};
+
+/*
+========================================================================================================================
+- - MODULE FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Initializes an empty skip list.
+ *
+ * @param[out] list: Pointer to a @skip_list_59 pointer to initialize the list in.
+ * @param[in] type: Type of the node objects.
+ * @param[in] type_depth: Size of the node elements, all must be the same size, if not set as 0.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @warning This will need to be freed with @deinit_skip_list_59 when its lifetime has expired.
+ **********************************************************************************************************************/
+ERR_59_e init_skip_list_59(skip_list_59** list, TYPE_59_e const type, size_t const type_depth);
+
+/***********************************************************************************************************************
+ * @brief: Deinits the passed skip list, deallocating every node and node object.
+ *
+ * @param[out] list: Pointer to a @skip_list_59 pointer that will be freed.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note The pointer to the list will be (void*)0 on return.
+ **********************************************************************************************************************/
+ERR_59_e deinit_skip_list_59(skip_list_59** list);
+
+/***********************************************************************************************************************
+ * @brief: Inserts an object at the passed index in O(log n), the objects from @idx on move back one position. If the
+ * index is past the end of the list the object is appended.
+ *
+ * @param[in] list: Skip list to insert into.
+ * @param[in] obj: Object to insert, the list takes ownership of it.
+ * @param[in] idx: Index the object will have once inserted.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e insert_at_idx_skip_list_59(skip_list_59* const list, void* obj, size_t const idx);
+
+/***********************************************************************************************************************
+ * @brief: Inserts an object in order in O(log n), after any objects that compare equal to it.
+ *
+ * @param[in] list: Skip list to insert into, its objects must already be in order.
+ * @param[in] obj: Object to insert, the list takes ownership of it.
+ * @param[out] idx: Pointer to place the index the object was inserted at in, may be NULL.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Objects are ordered with @compare_node_obj_59 on the list's @type.
+ **********************************************************************************************************************/
+ERR_59_e insert_sorted_into_skip_list_59(skip_list_59* const list, void* obj, size_t* idx);
+
+/***********************************************************************************************************************
+ * @brief: Gets the object at the passed index in O(log n).
+ *
+ * @param[in] list: Skip list to get the object from.
+ * @param[in] idx: Index of the object.
+ * @param[out] obj: Pointer to place the object in, set to NULL when @idx is out of range.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e get_at_idx_skip_list_59(skip_list_59 const* const list, size_t const idx, void** obj);
+
+/***********************************************************************************************************************
+ * @brief: Removes the object at the passed index in O(log n), the objects after it move forward one position.
+ *
+ * @param[in] list: Skip list to remove from.
+ * @param[in] idx: Index of the object to remove.
+ * @param[out] obj: Pointer to hand the removed object back in, the caller takes ownership of it.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e remove_at_idx_skip_list_59(skip_list_59* const list, size_t const idx, void** obj);
+
+/***********************************************************************************************************************
+ * @brief: Finds the first object equal to the passed one in O(log n).
+ *
+ * @param[in] list: Skip list to search, its objects must be in order.
+ * @param[in] obj: Object to match, this matches the value not the memory address.
+ * @param[out] idx: Pointer to place the index of the match in, may be NULL.
+ * @param[out] found: Pointer to place the matched object in, may be NULL.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Objects are ordered with @compare_node_obj_59 on the list's @type, ERR_OBJ_NOT_FOUND is returned when no
+ * object matches.
+ **********************************************************************************************************************/
+ERR_59_e find_in_skip_list_59(skip_list_59 const* const list, void const* const obj, size_t* idx, void** found);
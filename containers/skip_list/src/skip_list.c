@@ -0,0 +1,368 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Contains all the definitions for the skip list container.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stddef.h>
+#include <stdlib.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "skip_list.h"
+
+/*
+========================================================================================================================
+- - INTERNAL FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Picks the level of a new node, each level above the first is reached with a 1 in 4 chance.
+ *
+ * @param[in] list: List the node is for, its generator is advanced.
+ *
+ * @retval size_t: Level of the node, between 1 and @SKIP_LIST_MAX_LEVEL.
+ **********************************************************************************************************************/
+static size_t _random_level_skip_list_59(skip_list_59* const list)
+{
+    list->rng ^= list->rng << 13;
+    list->rng ^= list->rng >> 7;
+    list->rng ^= list->rng << 17;
+
+    size_t level = 1;
+    u64 bits = list->rng;
+    while (level < SKIP_LIST_MAX_LEVEL && 0 == (bits & 3))
+    {
+        level++;
+        bits >>= 2;
+    }
+
+    return level;
+}
+
+/***********************************************************************************************************************
+ * @brief: Finds, at every level in use, the last node before the passed index.
+ *
+ * @param[in] list: List to search.
+ * @param[in] idx: Index to find the predecessors of, at most @size.
+ * @param[out] update: Array of @SKIP_LIST_MAX_LEVEL nodes to place the predecessor at each level in.
+ * @param[out] rank: Array of @SKIP_LIST_MAX_LEVEL positions to place the position of each predecessor in, the head
+ * being position 0 and the node at index i position i + 1.
+ **********************************************************************************************************************/
+static void
+_seek_idx_skip_list_59(skip_list_59 const* const list, size_t const idx, skip_list_node_59** update, size_t* rank)
+{
+    skip_list_node_59* node = list->head;
+    for (size_t i = list->level; i-- > 0;)
+    {
+        rank[i] = (i + 1 == list->level) ? 0 : rank[i + 1];
+        while (node->links[i].next && rank[i] + node->links[i].span <= idx)
+        {
+            rank[i] += node->links[i].span;
+            node = node->links[i].next;
+        }
+        update[i] = node;
+    }
+}
+
+/***********************************************************************************************************************
+ * @brief: Finds, at every level in use, the last node ordered before the passed object.
+ *
+ * @param[in] list: List to search, its objects must be in order.
+ * @param[in] obj: Object to find the predecessors of.
+ * @param[in] after_equal: Whether objects equal to @obj count as before it.
+ * @param[out] update: Array of @SKIP_LIST_MAX_LEVEL nodes to place the predecessor at each level in.
+ * @param[out] rank: Array of @SKIP_LIST_MAX_LEVEL positions to place the position of each predecessor in, see
+ * @_seek_idx_skip_list_59.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _seek_obj_skip_list_59(skip_list_59 const* const list,
+                                       void const* const obj,
+                                       bool const after_equal,
+                                       skip_list_node_59** update,
+                                       size_t* rank)
+{
+    skip_list_node_59* node = list->head;
+    for (size_t i = list->level; i-- > 0;)
+    {
+        rank[i] = (i + 1 == list->level) ? 0 : rank[i + 1];
+        while (node->links[i].next)
+        {
+            i64 dif = 0;
+            ERR_59_e err = compare_node_obj_59(list->type, node->links[i].next->node_obj, obj, &dif);
+            if (ERR_NONE != err)
+                return err;
+            if (0 < dif || (0 == dif && !after_equal))
+                break;
+
+            rank[i] += node->links[i].span;
+            node = node->links[i].next;
+        }
+        update[i] = node;
+    }
+
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Allocates a node for the passed object and links it in after the predecessors found by a seek.
+ *
+ * @param[in] list: List to link the node into.
+ * @param[in] obj: Object of the new node.
+ * @param[in] update: Predecessors of the new node at every level in use, from a seek.
+ * @param[in] rank: Positions of @update, from a seek.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e
+_link_node_skip_list_59(skip_list_59* const list, void* obj, skip_list_node_59** update, size_t* rank)
+{
+    size_t const level = _random_level_skip_list_59(list);
+    skip_list_node_59* node = malloc(sizeof(skip_list_node_59) + sizeof(skip_list_link_59) * level);
+    if (!node)
+        return ERR_NO_MEM;
+
+    // Levels new to the list start at the head, their links span the whole list.
+    for (size_t i = list->level; i < level; i++)
+    {
+        rank[i] = 0;
+        update[i] = list->head;
+        update[i]->links[i].next = (void*)0;
+        update[i]->links[i].span = list->size;
+    }
+    if (level > list->level)
+        list->level = level;
+
+    node->node_obj = obj;
+    node->level = level;
+    for (size_t i = 0; i < level; i++)
+    {
+        size_t const before = rank[0] - rank[i]; // Positions from update[i] up to the new node's predecessor.
+        node->links[i].next = update[i]->links[i].next;
+        node->links[i].span = update[i]->links[i].span - before;
+        update[i]->links[i].next = node;
+        update[i]->links[i].span = before + 1;
+    }
+    for (size_t i = level; i < list->level; i++)
+        update[i]->links[i].span++;
+    list->size++;
+
+    return ERR_NONE;
+}
+
+/*
+========================================================================================================================
+- - FUNCTION DEFINITIONS - -
+========================================================================================================================
+*/
+
+ERR_59_e init_skip_list_59(skip_list_59** list, TYPE_59_e const type, size_t const type_depth)
+{
+    if (!list)
+        return ERR_INV_PARAM;
+
+    skip_list_59* new_list = malloc(sizeof(skip_list_59));
+    if (!new_list)
+        return ERR_NO_MEM;
+
+    new_list->head = malloc(sizeof(skip_list_node_59) + sizeof(skip_list_link_59) * SKIP_LIST_MAX_LEVEL);
+    if (!new_list->head)
+    {
+        free(new_list);
+        return ERR_NO_MEM;
+    }
+
+    new_list->head->node_obj = (void*)0;
+    new_list->head->level = SKIP_LIST_MAX_LEVEL;
+    for (size_t i = 0; i < SKIP_LIST_MAX_LEVEL; i++)
+    {
+        new_list->head->links[i].next = (void*)0;
+        new_list->head->links[i].span = 0;
+    }
+    new_list->size = 0;
+    new_list->level = 1;
+    new_list->type = type;
+    new_list->type_depth = type_depth;
+    new_list->rng = SKIP_LIST_SEED;
+
+    *list = new_list;
+
+    return ERR_NONE;
+}
+
+ERR_59_e deinit_skip_list_59(skip_list_59** list)
+{
+    if (!list || !(*list))
+        return ERR_INV_PARAM;
+
+    skip_list_node_59* node = (*list)->head;
+    while (node)
+    {
+        skip_list_node_59* next = node->links[0].next;
+        free(node->node_obj);
+        free(node);
+        node = next;
+    }
+
+    free(*list);
+    *list = (void*)0;
+
+    return ERR_NONE;
+}
+
+ERR_59_e insert_at_idx_skip_list_59(skip_list_59* const list, void* obj, size_t const idx)
+{
+    if (!list)
+        return ERR_INV_PARAM;
+
+    skip_list_node_59* update[SKIP_LIST_MAX_LEVEL];
+    size_t rank[SKIP_LIST_MAX_LEVEL];
+    _seek_idx_skip_list_59(list, (idx < list->size) ? idx : list->size, update, rank);
+
+    return _link_node_skip_list_59(list, obj, update, rank);
+}
+
+ERR_59_e insert_sorted_into_skip_list_59(skip_list_59* const list, void* obj, size_t* idx)
+{
+    if (!list || !obj)
+        return ERR_INV_PARAM;
+
+    skip_list_node_59* update[SKIP_LIST_MAX_LEVEL];
+    size_t rank[SKIP_LIST_MAX_LEVEL];
+    ERR_59_e err = _seek_obj_skip_list_59(list, obj, true, update, rank);
+    if (ERR_NONE != err)
+        return err;
+
+    err = _link_node_skip_list_59(list, obj, update, rank);
+    if (ERR_NONE == err && idx)
+        *idx = rank[0];
+
+    return err;
+}
+
+ERR_59_e get_at_idx_skip_list_59(skip_list_59 const* const list, size_t const idx, void** obj)
+{
+    if (!list || !obj)
+        return ERR_INV_PARAM;
+
+    *obj = (void*)0;
+    if (idx >= list->size)
+        return ERR_INV_PARAM;
+
+    // Walks to the node at position idx + 1 rather than its predecessor, stopping as soon as a link lands on it.
+    skip_list_node_59 const* node = list->head;
+    size_t position = 0;
+    for (size_t i = list->level; i-- > 0;)
+    {
+        while (node->links[i].next && position + node->links[i].span <= idx + 1)
+        {
+            position += node->links[i].span;
+            node = node->links[i].next;
+        }
+        if (position == idx + 1)
+            break;
+    }
+
+    *obj = node->node_obj;
+
+    return ERR_NONE;
+}
+
+ERR_59_e remove_at_idx_skip_list_59(skip_list_59* const list, size_t const idx, void** obj)
+{
+    if (!list || !obj)
+        return ERR_INV_PARAM;
+    if (0 == list->size)
+        return ERR_CONTAINER_EMPTY;
+    if (idx >= list->size)
+        return ERR_INV_PARAM;
+
+    skip_list_node_59* update[SKIP_LIST_MAX_LEVEL];
+    size_t rank[SKIP_LIST_MAX_LEVEL];
+    _seek_idx_skip_list_59(list, idx, update, rank);
+
+    skip_list_node_59* node = update[0]->links[0].next;
+    for (size_t i = 0; i < list->level; i++)
+    {
+        if (update[i]->links[i].next == node)
+        {
+            update[i]->links[i].span += node->links[i].span - 1;
+            update[i]->links[i].next = node->links[i].next;
+        }
+        else
+            update[i]->links[i].span--;
+    }
+    while (1 < list->level && !list->head->links[list->level - 1].next)
+        list->level--;
+    list->size--;
+
+    *obj = node->node_obj;
+    free(node);
+
+    return ERR_NONE;
+}
+
+ERR_59_e find_in_skip_list_59(skip_list_59 const* const list, void const* const obj, size_t* idx, void** found)
+{
+    if (!list || !obj)
+        return ERR_INV_PARAM;
+
+    skip_list_node_59* update[SKIP_LIST_MAX_LEVEL];
+    size_t rank[SKIP_LIST_MAX_LEVEL];
+    ERR_59_e err = _seek_obj_skip_list_59(list, obj, false, update, rank);
+    if (ERR_NONE != err)
+        return err;
+
+    skip_list_node_59 const* node = update[0]->links[0].next;
+    if (!node)
+        return ERR_OBJ_NOT_FOUND;
+
+    i64 dif = 0;
+    err = compare_node_obj_59(list->type, node->node_obj, obj, &dif);
+    if (ERR_NONE != err)
+        return err;
+    if (0 != dif)
+        return ERR_OBJ_NOT_FOUND;
+
+    if (idx)
+        *idx = rank[0];
+    if (found)
+        *found = node->node_obj;
+
+    return ERR_NONE;
+}
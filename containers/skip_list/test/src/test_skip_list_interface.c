@@ -0,0 +1,304 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Unit tests for the skip list's interface.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "skip_list.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Number of objects the positional tests insert.
+ **********************************************************************************************************************/
+#define TEST_SKIP_LIST_COUNT 2000
+
+/*
+========================================================================================================================
+- - INTERNAL TEST HELPERS - -
+========================================================================================================================
+*/
+
+static u64 _xorshift(u64* state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+static u64* _new_u64(u64 const val)
+{
+    u64* obj = malloc(sizeof(u64));
+    assert(obj);
+    *obj = val;
+    return obj;
+}
+
+// Every link at every level must land on the node its span counts to, and the last link must span to the end.
+static bool _spans_are_consistent(skip_list_59 const* const list)
+{
+    skip_list_node_59** nodes = malloc(sizeof(skip_list_node_59*) * (list->size + 1));
+    assert(nodes);
+    size_t count = 0;
+    for (skip_list_node_59* node = list->head; node; node = node->links[0].next)
+        nodes[count++] = node;
+
+    bool consistent = (list->size + 1 == count);
+    for (size_t i = 0; consistent && i < list->level; i++)
+    {
+        size_t position = 0;
+        skip_list_node_59 const* node = list->head;
+        while (consistent && node->links[i].next)
+        {
+            position += node->links[i].span;
+            node = node->links[i].next;
+            consistent = (position <= list->size && nodes[position] == node);
+        }
+        consistent = consistent && (position + node->links[i].span == list->size);
+    }
+    free(nodes);
+
+    return consistent;
+}
+
+/*
+========================================================================================================================
+- - UNIT TESTS - -
+========================================================================================================================
+*/
+
+ERR_59_e test_skip_list_59_interface(void)
+{
+    ERR_59_e err = ERR_NONE;
+
+    // Init skip_list
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Initializing skip_lists...");
+
+    skip_list_59* list = (void*)0;
+    err = init_skip_list_59(&list, U64_PTR, 0);
+    printf("Assert: ERR_NONE == %d = init_skip_list()\n", err);
+    assert(ERR_NONE == err && list && 0 == list->size && 1 == list->level);
+
+    // Positional inserts against a plain array
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("insert_at_idx_skip_list()...");
+
+    u64* expected = malloc(sizeof(u64) * TEST_SKIP_LIST_COUNT);
+    assert(expected);
+    size_t expected_size = 0;
+    u64 rng = 59;
+    for (u64 i = 0; i < TEST_SKIP_LIST_COUNT; i++)
+    {
+        size_t const idx = (size_t)(_xorshift(&rng) % (expected_size + 2)); // One past the end appends.
+        err = insert_at_idx_skip_list_59(list, _new_u64(i), idx);
+        assert(ERR_NONE == err);
+
+        size_t const at = (idx < expected_size) ? idx : expected_size;
+        memmove(&expected[at + 1], &expected[at], sizeof(u64) * (expected_size - at));
+        expected[at] = i;
+        expected_size++;
+    }
+    printf("Assert: %d == %zu = size after inserting\n", TEST_SKIP_LIST_COUNT, list->size);
+    assert(TEST_SKIP_LIST_COUNT == list->size);
+    printf("Assert: 1 < %zu = levels in use\n", list->level);
+    assert(1 < list->level);
+    assert(_spans_are_consistent(list));
+
+    puts("get_at_idx_skip_list()...");
+    void* obj = (void*)0;
+    for (size_t i = 0; i < expected_size; i++)
+    {
+        err = get_at_idx_skip_list_59(list, i, &obj);
+        assert(ERR_NONE == err && expected[i] == *(u64*)obj);
+    }
+    err = get_at_idx_skip_list_59(list, expected_size - 1, &obj);
+    printf("Assert: %lu == %lu = last object\n", expected[expected_size - 1], *(u64*)obj);
+    assert(ERR_NONE == err && expected[expected_size - 1] == *(u64*)obj);
+
+    puts("remove_at_idx_skip_list()...");
+    while (expected_size > TEST_SKIP_LIST_COUNT / 4)
+    {
+        size_t const idx = (size_t)(_xorshift(&rng) % expected_size);
+        err = remove_at_idx_skip_list_59(list, idx, &obj);
+        assert(ERR_NONE == err && expected[idx] == *(u64*)obj);
+        free(obj);
+
+        memmove(&expected[idx], &expected[idx + 1], sizeof(u64) * (expected_size - idx - 1));
+        expected_size--;
+    }
+    printf("Assert: %zu == %zu = size after removing\n", expected_size, list->size);
+    assert(expected_size == list->size);
+    assert(_spans_are_consistent(list));
+    for (size_t i = 0; i < expected_size; i++)
+    {
+        err = get_at_idx_skip_list_59(list, i, &obj);
+        assert(ERR_NONE == err && expected[i] == *(u64*)obj);
+    }
+
+    while (0 != list->size)
+    {
+        err = remove_at_idx_skip_list_59(list, 0, &obj);
+        assert(ERR_NONE == err);
+        free(obj);
+    }
+    printf("Assert: 1 == %zu = levels once emptied\n", list->level);
+    assert(1 == list->level && !list->head->links[0].next);
+
+    err = insert_at_idx_skip_list_59(list, _new_u64(59), 0);
+    assert(ERR_NONE == err && _spans_are_consistent(list));
+    err = deinit_skip_list_59(&list);
+    assert(ERR_NONE == err && !list);
+    free(expected);
+
+    // Ordered inserts and search
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("insert_sorted_into_skip_list()...");
+
+    skip_list_59* sorted = (void*)0;
+    err = init_skip_list_59(&sorted, U64_PTR, 0);
+    assert(ERR_NONE == err);
+    size_t idx = 0;
+    for (u64 i = 0; i < TEST_SKIP_LIST_COUNT; i++)
+    {
+        u64* val = _new_u64(_xorshift(&rng) % 500 * 2); // Even values only, odd ones are never found.
+        err = insert_sorted_into_skip_list_59(sorted, val, &idx);
+        assert(ERR_NONE == err);
+        err = get_at_idx_skip_list_59(sorted, idx, &obj);
+        assert(ERR_NONE == err && val == obj);
+    }
+    assert(_spans_are_consistent(sorted));
+
+    u64 last = 0;
+    size_t in_order = 0;
+    for (skip_list_node_59* node = sorted->head->links[0].next; node; node = node->links[0].next)
+    {
+        in_order += (last <= *(u64*)node->node_obj);
+        last = *(u64*)node->node_obj;
+    }
+    printf("Assert: %d == %zu = objects in order\n", TEST_SKIP_LIST_COUNT, in_order);
+    assert(TEST_SKIP_LIST_COUNT == in_order);
+
+    puts("find_in_skip_list()...");
+    size_t found_count = 0;
+    for (u64 val = 0; val < 1000; val++)
+    {
+        void* found = (void*)0;
+        err = find_in_skip_list_59(sorted, &val, &idx, &found);
+        if (1 == val % 2)
+        {
+            assert(ERR_OBJ_NOT_FOUND == err);
+            continue;
+        }
+        if (ERR_OBJ_NOT_FOUND == err)
+            continue;
+
+        // The first of the equal objects is found.
+        assert(ERR_NONE == err && val == *(u64*)found);
+        if (0 != idx)
+        {
+            err = get_at_idx_skip_list_59(sorted, idx - 1, &obj);
+            assert(ERR_NONE == err && *(u64*)obj < val);
+        }
+        found_count++;
+    }
+    printf("Assert: 450 < %zu = distinct values found\n", found_count);
+    assert(450 < found_count);
+
+    u64 const past_end = 5000;
+    err = find_in_skip_list_59(sorted, &past_end, &idx, (void*)0);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = find_in_skip_list() past the end\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err);
+    err = deinit_skip_list_59(&sorted);
+    assert(ERR_NONE == err);
+
+    puts("insert_sorted_into_skip_list() with strings...");
+    skip_list_59* words = (void*)0;
+    err = init_skip_list_59(&words, STR, 0);
+    assert(ERR_NONE == err);
+    char const* const word_list[] = {"pear", "apple", "fig", "banana", "cherry", "date"};
+    for (size_t i = 0; i < sizeof(word_list) / sizeof(word_list[0]); i++)
+    {
+        char* word = malloc(strlen(word_list[i]) + 1);
+        assert(word);
+        strcpy(word, word_list[i]);
+        err = insert_sorted_into_skip_list_59(words, word, (void*)0);
+        assert(ERR_NONE == err);
+    }
+    err = find_in_skip_list_59(words, "date", &idx, (void*)0);
+    printf("Assert: 3 == %zu = index of date\n", idx);
+    assert(ERR_NONE == err && 3 == idx);
+    err = get_at_idx_skip_list_59(words, 0, &obj);
+    assert(ERR_NONE == err && 0 == strcmp("apple", obj));
+    err = deinit_skip_list_59(&words);
+    assert(ERR_NONE == err);
+
+    return err;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    puts("- - -  START OF SKIP LIST TEST  - - -");
+    puts("- - - INTERFACE TESTS - - -");
+
+    ERR_59_e err = test_skip_list_59_interface();
+    printf("ERROR CODE: %d\n", err);
+    assert(ERR_NONE == err);
+
+    puts("- - - - END OF SKIP LIST TEST - - - -");
+    return err;
+}
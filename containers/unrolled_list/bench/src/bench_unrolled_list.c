@@ -0,0 +1,251 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Benchmarks building, traversing and indexing an unrolled list against a linked list.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "llist.h"
+#include "unrolled_list.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Default number of objects in the benchmarked lists, override with the first program argument.
+ **********************************************************************************************************************/
+#define BENCH_DEFAULT_ENTRIES (1UL << 20)
+
+/***********************************************************************************************************************
+ * @brief: Number of full traversals timed per list.
+ **********************************************************************************************************************/
+#define BENCH_TRAVERSALS 10
+
+/***********************************************************************************************************************
+ * @brief: Number of timed get_at_idx calls per list.
+ **********************************************************************************************************************/
+#define BENCH_GETS 200
+
+/*
+========================================================================================================================
+- - BENCH HELPERS - -
+========================================================================================================================
+*/
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static u64 xorshift(u64* state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    size_t const entries = (1 < argc) ? strtoul(argv[1], (void*)0, 10) : BENCH_DEFAULT_ENTRIES;
+    if (2 > entries)
+        return ERR_INV_PARAM;
+
+    // Both lists point at the same objects, so only the list layouts differ. The unrolled list is left to free them.
+    u64** objs = malloc(sizeof(u64*) * entries);
+    if (!objs)
+        return ERR_NO_MEM;
+    for (size_t i = 0; i < entries; i++)
+    {
+        objs[i] = malloc(sizeof(u64));
+        if (!objs[i])
+            return ERR_NO_MEM;
+        *objs[i] = i;
+    }
+
+    llist_59* llist = (void*)0;
+    ERR_59_e err = init_llist_59(&llist, U64_PTR, 0);
+    if (ERR_NONE != err)
+        return err;
+    double start = now_ns();
+    for (size_t i = 0; i < entries; i++)
+    {
+        llist_node_59* node = (void*)0;
+        err = init_llist_node_59(&node, (void*)0, objs[i]);
+        if (ERR_NONE != err)
+            return err;
+        err = push_back_llist_59(llist, node);
+        if (ERR_NONE != err)
+            return err;
+    }
+    double const llist_push_ns = (now_ns() - start) / (double)entries;
+
+    // A fresh heap hands out the nodes above back to back. Lists that have seen churn have their nodes scattered, so a
+    // second list links its nodes in shuffled order.
+    llist_node_59** churned = malloc(sizeof(llist_node_59*) * entries);
+    if (!churned)
+        return ERR_NO_MEM;
+    for (size_t i = 0; i < entries; i++)
+    {
+        err = init_llist_node_59(&churned[i], (void*)0, objs[i]);
+        if (ERR_NONE != err)
+            return err;
+    }
+    u64 rng = 59;
+    for (size_t i = entries - 1; 0 < i; i--)
+    {
+        size_t const j = (size_t)(xorshift(&rng) % (i + 1));
+        llist_node_59* node = churned[i];
+        churned[i] = churned[j];
+        churned[j] = node;
+    }
+    for (size_t i = 0; i < entries; i++)
+    {
+        churned[i]->node_obj = objs[i];
+        churned[i]->next = (i + 1 < entries) ? churned[i + 1] : (void*)0;
+    }
+
+    unrolled_list_59* unrolled = (void*)0;
+    err = init_unrolled_list_59(&unrolled, U64_PTR, 0);
+    if (ERR_NONE != err)
+        return err;
+    start = now_ns();
+    for (size_t i = 0; i < entries; i++)
+    {
+        err = push_back_unrolled_list_59(unrolled, objs[i]);
+        if (ERR_NONE != err)
+            return err;
+    }
+    double const unrolled_push_ns = (now_ns() - start) / (double)entries;
+
+    u64 checksum = 0;
+    start = now_ns();
+    for (size_t t = 0; t < BENCH_TRAVERSALS; t++)
+    {
+        for (llist_node_59 const* node = llist->head; node; node = node->next)
+            checksum += *(u64*)node->node_obj;
+    }
+    double const llist_walk_ns = (now_ns() - start) / (double)(entries * BENCH_TRAVERSALS);
+
+    start = now_ns();
+    for (size_t t = 0; t < BENCH_TRAVERSALS; t++)
+    {
+        for (llist_node_59 const* node = churned[0]; node; node = node->next)
+            checksum += *(u64*)node->node_obj;
+    }
+    double const churned_walk_ns = (now_ns() - start) / (double)(entries * BENCH_TRAVERSALS);
+
+    start = now_ns();
+    for (size_t t = 0; t < BENCH_TRAVERSALS; t++)
+    {
+        for (unrolled_list_node_59 const* node = unrolled->head; node; node = node->next)
+        {
+            for (size_t i = 0; i < node->count; i++)
+                checksum -= *(u64*)node->node_objs[i];
+        }
+    }
+    double const unrolled_walk_ns = (now_ns() - start) / (double)(entries * BENCH_TRAVERSALS);
+
+    start = now_ns();
+    for (size_t i = 0; i < BENCH_GETS; i++)
+    {
+        llist_node_59* node = (void*)0;
+        err = get_at_idx_llist_59(llist, (size_t)(xorshift(&rng) % (entries - 1)), &node);
+        if (ERR_NONE != err)
+            return err;
+        checksum += *(u64*)node->node_obj;
+    }
+    double const llist_get_ns = (now_ns() - start) / BENCH_GETS;
+
+    start = now_ns();
+    for (size_t i = 0; i < BENCH_GETS; i++)
+    {
+        void* obj = (void*)0;
+        err = get_at_idx_unrolled_list_59(unrolled, (size_t)(xorshift(&rng) % entries), &obj);
+        if (ERR_NONE != err)
+            return err;
+        checksum += *(u64*)obj;
+    }
+    double const unrolled_get_ns = (now_ns() - start) / BENCH_GETS;
+
+    size_t nodes = 0;
+    for (unrolled_list_node_59 const* node = unrolled->head; node; node = node->next)
+        nodes++;
+
+    printf("entries: %zu\n", entries);
+    printf("llist:    %zu nodes, %zu bytes of nodes\n", entries, entries * sizeof(llist_node_59));
+    printf("unrolled: %zu nodes, %zu bytes of nodes\n", nodes, nodes * sizeof(unrolled_list_node_59));
+    printf("llist push_back:       %10.2f ns/obj\n", llist_push_ns);
+    printf("unrolled push_back:    %10.2f ns/obj\n", unrolled_push_ns);
+    printf("llist traversal:       %10.2f ns/obj\n", llist_walk_ns);
+    printf("llist traversal, churn:%10.2f ns/obj\n", churned_walk_ns);
+    printf("unrolled traversal:    %10.2f ns/obj\n", unrolled_walk_ns);
+    printf("llist get_at_idx:      %10.2f ns/op\n", llist_get_ns);
+    printf("unrolled get_at_idx:   %10.2f ns/op\n", unrolled_get_ns);
+    printf("checksum: %lu\n", checksum);
+
+    llist_node_59* node = llist->head;
+    while (node)
+    {
+        llist_node_59* next = node->next;
+        free(node);
+        node = next;
+    }
+    free(llist);
+    for (size_t i = 0; i < entries; i++)
+        free(churned[i]);
+    free(churned);
+    deinit_unrolled_list_59(&unrolled);
+    free(objs);
+
+    return ERR_NONE;
+}
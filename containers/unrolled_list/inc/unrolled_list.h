@@ -0,0 +1,236 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: This file contains all the declarations for the unrolled list, a doubly linked list of small arrays of
+ * objects.
+ **********************************************************************************************************************/
+
+#pragma once
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "containers_common.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Number of objects a node holds, chosen so a node fills 256 bytes, four cache lines.
+ **********************************************************************************************************************/
+#define UNROLLED_LIST_NODE_CAPACITY 29
+
+/***********************************************************************************************************************
+ * @brief: Fewest objects a node keeps after a removal when it has a neighbour to take objects from or merge with.
+ **********************************************************************************************************************/
+#define UNROLLED_LIST_NODE_MIN (UNROLLED_LIST_NODE_CAPACITY / 2)
+
+/*
+========================================================================================================================
+- - TYPEDEFS - -
+========================================================================================================================
+*/
+
+typedef struct unrolled_list_node_59 unrolled_list_node_59;
+typedef struct unrolled_list_59 unrolled_list_59;
+
+/*
+========================================================================================================================
+- - STRUCTS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @unrolled_list_node_59
+ * @brief: Represents a node of the unrolled list, holding up to @UNROLLED_LIST_NODE_CAPACITY objects in order.
+ *
+ * @next: pointer to the next node.
+ * @last: pointer to the last node.
+ * @count: number of objects held in @node_objs.
+ * @node_objs: pointers to the objects at the node, the first @count are in use.
+ *
+ * @see unrolled_list_59
+ **********************************************************************************************************************/
+struct unrolled_list_node_59
+{
+    unrolled_list_node_59* next;
+    unrolled_list_node_59* last;
+    size_t count;
+    void* node_objs[UNROLLED_LIST_NODE_CAPACITY];
+};
+
+/***********************************************************************************************************************
+ * @unrolled_list_59
+ * @brief: Represents an unrolled list. Objects are packed into nodes of @UNROLLED_LIST_NODE_CAPACITY, so a list of n
+ * objects takes about n / @UNROLLED_LIST_NODE_MIN allocations at worst and a traversal reads consecutive pointers
+ * instead of chasing one node per object. Full nodes split in two on insert, and nodes left under
+ * @UNROLLED_LIST_NODE_MIN by a removal take objects from, or merge with, their next node.
+ *
+ * @head: first node of the list, NULL when empty.
+ * @tail: last node of the list, NULL when empty.
+ * @size: number of objects in the list.
+ * @type: type of the list's objects, this can be any type so besure you document what you're pointing at.
+ * @type_depth: if pointing at arrays with consistent size, place the size of the arrays here, otherwise leave as 0.
+ *
+ * @note Walk the list in order by following @next from @head through the first @count objects of each node.
+ **********************************************************************************************************************/
+struct unrolled_list_59
+{
+    unrolled_list_node_59* head;
+    unrolled_list_node_59* tail;
+    size_t size;
+    TYPE_59_e type;
+    size_t type_depth;
+};
+
+/*
+========================================================================================================================
+- - MODULE FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Initializes an unrolled list, this also allocates memory to the @list pointer.
+ *
+ * @param[out] list: unrolled list pointer to initialize. @warning This must be freed when its lifetime has ended.
+ * @param[in] type: type of the list's objects.
+ * @param[in] type_depth: size of the object elements, all must be the same size, if not set as 0.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e init_unrolled_list_59(unrolled_list_59** list, TYPE_59_e const type, size_t const type_depth);
+
+/***********************************************************************************************************************
+ * @brief: Deinits the passed unrolled list, deallocating its nodes and every object in it.
+ *
+ * @param[in] list: unrolled list to deinit, set to NULL on return.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e deinit_unrolled_list_59(unrolled_list_59** list);
+
+/***********************************************************************************************************************
+ * @brief: Adds an object to the end of the unrolled list.
+ *
+ * @param[in] list: Unrolled list to add the object to.
+ * @param[in] obj: Object to add, the list takes ownership of it.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e push_back_unrolled_list_59(unrolled_list_59* const list, void* obj);
+
+/***********************************************************************************************************************
+ * @brief: Removes the object at the end of the unrolled list and provides it via the @obj parameter.
+ *
+ * @param[in] list: Unrolled list to pop the object from.
+ * @param[out] obj: Pointer to hand the object back in, the caller takes ownership of it.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e pop_back_unrolled_list_59(unrolled_list_59* const list, void** obj);
+
+/***********************************************************************************************************************
+ * @brief: Adds an object to the front of the unrolled list.
+ *
+ * @param[in] list: Unrolled list to add the object to.
+ * @param[in] obj: Object to add, the list takes ownership of it.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e push_front_unrolled_list_59(unrolled_list_59* const list, void* obj);
+
+/***********************************************************************************************************************
+ * @brief: Removes the object at the front of the unrolled list and provides it via the @obj parameter.
+ *
+ * @param[in] list: Unrolled list to pop the object from.
+ * @param[out] obj: Pointer to hand the object back in, the caller takes ownership of it.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e pop_front_unrolled_list_59(unrolled_list_59* const list, void** obj);
+
+/***********************************************************************************************************************
+ * @brief: Inserts an object into the unrolled list at the passed index, if the index is past the end of the list the
+ * object is appended to the end of the list.
+ *
+ * @param[in] list: Unrolled list to add the object to.
+ * @param[in] obj: Object to add, the list takes ownership of it.
+ * @param[in] idx: Index the object will have once inserted.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e insert_into_unrolled_list_59(unrolled_list_59* const list, void* obj, size_t const idx);
+
+/***********************************************************************************************************************
+ * @brief: Removes the object at the passed index and provides it via the @obj parameter.
+ *
+ * @param[in] list: Unrolled list to remove the object from.
+ * @param[in] idx: Index of the object to remove.
+ * @param[out] obj: Pointer to hand the object back in, the caller takes ownership of it.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e remove_at_idx_unrolled_list_59(unrolled_list_59* const list, size_t const idx, void** obj);
+
+/***********************************************************************************************************************
+ * @brief: Gets the object at the passed index, walking nodes rather than objects from whichever end is closer.
+ *
+ * @param[in] list: Unrolled list to get the object from.
+ * @param[in] idx: Index of the object.
+ * @param[out] obj: Pointer to place the object in, set to NULL when @idx is out of range.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+ERR_59_e get_at_idx_unrolled_list_59(unrolled_list_59 const* const list, size_t const idx, void** obj);
+
+/***********************************************************************************************************************
+ * @brief: Finds the first object equal to the passed one.
+ *
+ * @param[in] list: Unrolled list to search.
+ * @param[in] obj: Object to match, this matches the value not the memory address.
+ * @param[out] idx: Pointer to place the index of the match in.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ *
+ * @note Objects are matched with @compare_node_obj_59 on the list's @type, ERR_OBJ_NOT_FOUND is returned when no
+ * object matches.
+ **********************************************************************************************************************/
+ERR_59_e find_in_unrolled_list_59(unrolled_list_59 const* const list, void const* const obj, size_t* idx);
@@ -0,0 +1,410 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Contains all the definitions for the unrolled list container.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "unrolled_list.h"
+
+/*
+========================================================================================================================
+- - INTERNAL FUNCTIONS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Finds the node holding the object at the passed index, walking from whichever end of the list is closer.
+ *
+ * @param[in] list: List to search.
+ * @param[in] idx: Index of the object, must be below @size.
+ * @param[out] node: Pointer to place the node holding the object in.
+ * @param[out] offset: Pointer to place the position of the object within @node in.
+ **********************************************************************************************************************/
+static void _locate_unrolled_list_59(unrolled_list_59 const* const list,
+                                     size_t const idx,
+                                     unrolled_list_node_59** node,
+                                     size_t* offset)
+{
+    if (idx < list->size / 2)
+    {
+        size_t before = 0;
+        unrolled_list_node_59* current = list->head;
+        while (before + current->count <= idx)
+        {
+            before += current->count;
+            current = current->next;
+        }
+        *node = current;
+        *offset = idx - before;
+        return;
+    }
+
+    size_t start = list->size - list->tail->count;
+    unrolled_list_node_59* current = list->tail;
+    while (start > idx)
+    {
+        current = current->last;
+        start -= current->count;
+    }
+    *node = current;
+    *offset = idx - start;
+}
+
+/***********************************************************************************************************************
+ * @brief: Allocates an empty node and links it in after the passed node.
+ *
+ * @param[in] list: List to link the node into.
+ * @param[in] after: Node to link the new node after, NULL to make it the head.
+ * @param[out] node: Pointer to place the new node in.
+ *
+ * @retval ERR_59_e: error value encountered during the function call, ERR_NONE = all ok.
+ **********************************************************************************************************************/
+static ERR_59_e _link_new_node_unrolled_list_59(unrolled_list_59* const list,
+                                                unrolled_list_node_59* after,
+                                                unrolled_list_node_59** node)
+{
+    unrolled_list_node_59* new_node = malloc(sizeof(unrolled_list_node_59));
+    if (!new_node)
+        return ERR_NO_MEM;
+
+    new_node->count = 0;
+    new_node->last = after;
+    new_node->next = after ? after->next : list->head;
+    if (new_node->next)
+        new_node->next->last = new_node;
+    else
+        list->tail = new_node;
+    if (after)
+        after->next = new_node;
+    else
+        list->head = new_node;
+
+    *node = new_node;
+
+    return ERR_NONE;
+}
+
+/***********************************************************************************************************************
+ * @brief: Unlinks the passed node from the list and frees it, its objects must already have been moved out.
+ *
+ * @param[in] list: List to unlink the node from.
+ * @param[in] node: Node to unlink.
+ **********************************************************************************************************************/
+static void _unlink_node_unrolled_list_59(unrolled_list_59* const list, unrolled_list_node_59* const node)
+{
+    if (node->last)
+        node->last->next = node->next;
+    else
+        list->head = node->next;
+    if (node->next)
+        node->next->last = node->last;
+    else
+        list->tail = node->last;
+
+    free(node);
+}
+
+/***********************************************************************************************************************
+ * @brief: Restores the fill of a node after a removal. An empty node is unlinked, a node left under
+ * @UNROLLED_LIST_NODE_MIN merges with a neighbour when their objects fit in one node, otherwise the two share their
+ * objects evenly.
+ *
+ * @param[in] list: List holding the node.
+ * @param[in] node: Node an object was removed from.
+ **********************************************************************************************************************/
+static void _rebalance_unrolled_list_59(unrolled_list_59* const list, unrolled_list_node_59* const node)
+{
+    if (0 == node->count)
+    {
+        _unlink_node_unrolled_list_59(list, node);
+        return;
+    }
+    if (UNROLLED_LIST_NODE_MIN <= node->count || (!node->next && !node->last))
+        return;
+
+    unrolled_list_node_59* front = node->next ? node : node->last;
+    unrolled_list_node_59* back = front->next;
+    if (front->count + back->count <= UNROLLED_LIST_NODE_CAPACITY)
+    {
+        memcpy(&front->node_objs[front->count], back->node_objs, sizeof(void*) * back->count);
+        front->count += back->count;
+        _unlink_node_unrolled_list_59(list, back);
+        return;
+    }
+
+    if (front->count < back->count)
+    {
+        size_t const moved = (back->count - front->count) / 2;
+        memcpy(&front->node_objs[front->count], back->node_objs, sizeof(void*) * moved);
+        memmove(back->node_objs, &back->node_objs[moved], sizeof(void*) * (back->count - moved));
+        front->count += moved;
+        back->count -= moved;
+    }
+    else
+    {
+        size_t const moved = (front->count - back->count) / 2;
+        memmove(&back->node_objs[moved], back->node_objs, sizeof(void*) * back->count);
+        memcpy(back->node_objs, &front->node_objs[front->count - moved], sizeof(void*) * moved);
+        front->count -= moved;
+        back->count += moved;
+    }
+}
+
+/***********************************************************************************************************************
+ * @brief: Removes the object at the passed position of a node and restores the node's fill.
+ *
+ * @param[in] list: List holding the node.
+ * @param[in] node: Node holding the object.
+ * @param[in] offset: Position of the object within @node.
+ * @param[out] obj: Pointer to hand the object back in.
+ **********************************************************************************************************************/
+static void _remove_from_node_unrolled_list_59(unrolled_list_59* const list,
+                                               unrolled_list_node_59* const node,
+                                               size_t const offset,
+                                               void** obj)
+{
+    *obj = node->node_objs[offset];
+    memmove(&node->node_objs[offset], &node->node_objs[offset + 1], sizeof(void*) * (node->count - offset - 1));
+    node->count--;
+    list->size--;
+
+    _rebalance_unrolled_list_59(list, node);
+}
+
+/*
+========================================================================================================================
+- - FUNCTION DEFINITIONS - -
+========================================================================================================================
+*/
+
+ERR_59_e init_unrolled_list_59(unrolled_list_59** list, TYPE_59_e const type, size_t const type_depth)
+{
+    if (!list)
+        return ERR_INV_PARAM;
+
+    *list = malloc(sizeof(unrolled_list_59));
+    if (!(*list))
+        return ERR_NO_MEM;
+
+    (*list)->head = (void*)0;
+    (*list)->tail = (void*)0;
+    (*list)->size = 0;
+    (*list)->type = type;
+    (*list)->type_depth = type_depth;
+
+    return ERR_NONE;
+}
+
+ERR_59_e deinit_unrolled_list_59(unrolled_list_59** list)
+{
+    if (!list || !(*list))
+        return ERR_INV_PARAM;
+
+    unrolled_list_node_59* node = (*list)->head;
+    while (node)
+    {
+        unrolled_list_node_59* next = node->next;
+        for (size_t i = 0; i < node->count; i++)
+            free(node->node_objs[i]);
+        free(node);
+        node = next;
+    }
+
+    free(*list);
+    *list = (void*)0;
+
+    return ERR_NONE;
+}
+
+ERR_59_e push_back_unrolled_list_59(unrolled_list_59* const list, void* obj)
+{
+    if (!list)
+        return ERR_INV_PARAM;
+
+    return insert_into_unrolled_list_59(list, obj, list->size);
+}
+
+ERR_59_e pop_back_unrolled_list_59(unrolled_list_59* const list, void** obj)
+{
+    if (!list || !obj)
+        return ERR_INV_PARAM;
+    if (0 == list->size)
+        return ERR_CONTAINER_EMPTY;
+
+    _remove_from_node_unrolled_list_59(list, list->tail, list->tail->count - 1, obj);
+
+    return ERR_NONE;
+}
+
+ERR_59_e push_front_unrolled_list_59(unrolled_list_59* const list, void* obj)
+{
+    return insert_into_unrolled_list_59(list, obj, 0);
+}
+
+ERR_59_e pop_front_unrolled_list_59(unrolled_list_59* const list, void** obj)
+{
+    if (!list || !obj)
+        return ERR_INV_PARAM;
+    if (0 == list->size)
+        return ERR_CONTAINER_EMPTY;
+
+    _remove_from_node_unrolled_list_59(list, list->head, 0, obj);
+
+    return ERR_NONE;
+}
+
+ERR_59_e insert_into_unrolled_list_59(unrolled_list_59* const list, void* obj, size_t const idx)
+{
+    if (!list)
+        return ERR_INV_PARAM;
+
+    unrolled_list_node_59* node = (void*)0;
+    size_t offset = 0;
+    ERR_59_e err = ERR_NONE;
+    if (idx >= list->size)
+    {
+        node = list->tail;
+        if (!node || UNROLLED_LIST_NODE_CAPACITY == node->count)
+        {
+            // Appends start a fresh node rather than splitting, so lists built by pushing back fill their nodes.
+            err = _link_new_node_unrolled_list_59(list, list->tail, &node);
+            if (ERR_NONE != err)
+                return err;
+        }
+        offset = node->count;
+    }
+    else
+    {
+        _locate_unrolled_list_59(list, idx, &node, &offset);
+        if (0 == offset && node->last && UNROLLED_LIST_NODE_CAPACITY > node->last->count)
+        {
+            node = node->last;
+            offset = node->count;
+        }
+        else if (UNROLLED_LIST_NODE_CAPACITY == node->count)
+        {
+            unrolled_list_node_59* split = (void*)0;
+            err = _link_new_node_unrolled_list_59(list, node, &split);
+            if (ERR_NONE != err)
+                return err;
+
+            split->count = node->count / 2;
+            node->count -= split->count;
+            memcpy(split->node_objs, &node->node_objs[node->count], sizeof(void*) * split->count);
+            if (offset > node->count)
+            {
+                offset -= node->count;
+                node = split;
+            }
+        }
+    }
+
+    memmove(&node->node_objs[offset + 1], &node->node_objs[offset], sizeof(void*) * (node->count - offset));
+    node->node_objs[offset] = obj;
+    node->count++;
+    list->size++;
+
+    return ERR_NONE;
+}
+
+ERR_59_e remove_at_idx_unrolled_list_59(unrolled_list_59* const list, size_t const idx, void** obj)
+{
+    if (!list || !obj)
+        return ERR_INV_PARAM;
+    if (0 == list->size)
+        return ERR_CONTAINER_EMPTY;
+    if (idx >= list->size)
+        return ERR_INV_PARAM;
+
+    unrolled_list_node_59* node = (void*)0;
+    size_t offset = 0;
+    _locate_unrolled_list_59(list, idx, &node, &offset);
+    _remove_from_node_unrolled_list_59(list, node, offset, obj);
+
+    return ERR_NONE;
+}
+
+ERR_59_e get_at_idx_unrolled_list_59(unrolled_list_59 const* const list, size_t const idx, void** obj)
+{
+    if (!list || !obj)
+        return ERR_INV_PARAM;
+
+    *obj = (void*)0;
+    if (idx >= list->size)
+        return ERR_INV_PARAM;
+
+    unrolled_list_node_59* node = (void*)0;
+    size_t offset = 0;
+    _locate_unrolled_list_59(list, idx, &node, &offset);
+    *obj = node->node_objs[offset];
+
+    return ERR_NONE;
+}
+
+ERR_59_e find_in_unrolled_list_59(unrolled_list_59 const* const list, void const* const obj, size_t* idx)
+{
+    if (!list || !obj || !idx)
+        return ERR_INV_PARAM;
+
+    size_t before = 0;
+    for (unrolled_list_node_59 const* node = list->head; node; node = node->next)
+    {
+        for (size_t i = 0; i < node->count; i++)
+        {
+            if (!node->node_objs[i])
+                continue;
+
+            i64 dif = 0;
+            ERR_59_e err = compare_node_obj_59(list->type, node->node_objs[i], obj, &dif);
+            if (ERR_NONE != err)
+                return err;
+            if (0 == dif)
+            {
+                *idx = before + i;
+                return ERR_NONE;
+            }
+        }
+        before += node->count;
+    }
+
+    return ERR_OBJ_NOT_FOUND;
+}
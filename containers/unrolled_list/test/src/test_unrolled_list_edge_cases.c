@@ -0,0 +1,185 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Unit tests for the unrolled list's edge cases.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "unrolled_list.h"
+
+/*
+========================================================================================================================
+- - UNIT TESTS - -
+========================================================================================================================
+*/
+
+ERR_59_e test_unrolled_list_59_edge_cases(void)
+{
+    ERR_59_e err = ERR_NONE;
+
+    // Init unrolled_list
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Initializing unrolled_list...");
+
+    unrolled_list_59* list = (void*)0;
+    err = init_unrolled_list_59(&list, U64_PTR, 0);
+    if (ERR_NONE != err)
+        return err;
+
+    unrolled_list_59* list_dummy = (void*)0;
+    void* obj = (void*)0;
+    size_t idx = 0;
+    u64 val = 59;
+
+    // Test init_unrolled_list edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test init_unrolled_list and deinit_unrolled_list...");
+
+    err = init_unrolled_list_59((void*)0, U64_PTR, 0);
+    printf("Assert: ERR_INV_PARAM == %d = init_unrolled_list()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = deinit_unrolled_list_59(&list_dummy);
+    printf("Assert: ERR_INV_PARAM == %d = deinit_unrolled_list() null list\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    // Test empty list edge cases
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test empty unrolled_list...");
+
+    err = pop_back_unrolled_list_59(list, &obj);
+    printf("Assert: ERR_CONTAINER_EMPTY == %d = pop_back_unrolled_list() empty list\n", err);
+    assert(ERR_CONTAINER_EMPTY == err);
+
+    err = pop_front_unrolled_list_59(list, &obj);
+    printf("Assert: ERR_CONTAINER_EMPTY == %d = pop_front_unrolled_list() empty list\n", err);
+    assert(ERR_CONTAINER_EMPTY == err);
+
+    err = remove_at_idx_unrolled_list_59(list, 0, &obj);
+    printf("Assert: ERR_CONTAINER_EMPTY == %d = remove_at_idx_unrolled_list() empty list\n", err);
+    assert(ERR_CONTAINER_EMPTY == err);
+
+    err = get_at_idx_unrolled_list_59(list, 0, &obj);
+    printf("Assert: ERR_INV_PARAM == %d = get_at_idx_unrolled_list() empty list\n", err);
+    assert(ERR_INV_PARAM == err && !obj);
+
+    err = find_in_unrolled_list_59(list, &val, &idx);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = find_in_unrolled_list() empty list\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+    // Test null params
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test null params...");
+
+    err = push_back_unrolled_list_59(list_dummy, &val);
+    printf("Assert: ERR_INV_PARAM == %d = push_back_unrolled_list()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = push_front_unrolled_list_59(list_dummy, &val);
+    printf("Assert: ERR_INV_PARAM == %d = push_front_unrolled_list()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = insert_into_unrolled_list_59(list_dummy, &val, 0);
+    printf("Assert: ERR_INV_PARAM == %d = insert_into_unrolled_list()\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = pop_back_unrolled_list_59(list, (void*)0);
+    printf("Assert: ERR_INV_PARAM == %d = pop_back_unrolled_list() null out\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    err = find_in_unrolled_list_59(list, (void*)0, &idx);
+    printf("Assert: ERR_INV_PARAM == %d = find_in_unrolled_list() null obj\n", err);
+    assert(ERR_INV_PARAM == err);
+
+    // Test out of range indexes
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test out of range indexes...");
+
+    u64* first = malloc(sizeof(u64));
+    *first = 1;
+    err = insert_into_unrolled_list_59(list, first, SIZE_MAX);
+    printf("Assert: ERR_NONE == %d = insert_into_unrolled_list() past the end appends\n", err);
+    assert(ERR_NONE == err && 1 == list->size);
+
+    err = get_at_idx_unrolled_list_59(list, 1, &obj);
+    printf("Assert: ERR_INV_PARAM == %d = get_at_idx_unrolled_list() past the end\n", err);
+    assert(ERR_INV_PARAM == err && !obj);
+
+    err = remove_at_idx_unrolled_list_59(list, 1, &obj);
+    printf("Assert: ERR_INV_PARAM == %d = remove_at_idx_unrolled_list() past the end\n", err);
+    assert(ERR_INV_PARAM == err && 1 == list->size);
+
+    // NULL objects are held but never matched.
+    err = push_back_unrolled_list_59(list, (void*)0);
+    assert(ERR_NONE == err && 2 == list->size);
+    err = find_in_unrolled_list_59(list, &val, &idx);
+    printf("Assert: ERR_OBJ_NOT_FOUND == %d = find_in_unrolled_list() past a null object\n", err);
+    assert(ERR_OBJ_NOT_FOUND == err);
+
+    // Test clean up
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test clean up...");
+    err = deinit_unrolled_list_59(&list);
+
+    return err;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    puts("- - -  START OF UNROLLED LIST TEST  - - -");
+    puts("- - - UNROLLED LIST EDGE CASES - - -");
+
+    ERR_59_e err = test_unrolled_list_59_edge_cases();
+    printf("ERROR CODE: %d\n", err);
+    assert(ERR_NONE == err);
+
+    puts("- - - - END OF UNROLLED LIST TEST - - - -");
+    return err;
+}
@@ -0,0 +1,282 @@
+/***********************************************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2025 Gregory Nitch
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @date: 2026-10-19
+ * @author: Gregory Nitch
+ *
+ * @brief: Unit tests for the unrolled list's interface.
+ **********************************************************************************************************************/
+
+/*
+========================================================================================================================
+- - SYSTEM INCLUDES - -
+========================================================================================================================
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+========================================================================================================================
+- - MODULE INCLUDES - -
+========================================================================================================================
+*/
+
+#include "unrolled_list.h"
+
+/*
+========================================================================================================================
+- - MACROS - -
+========================================================================================================================
+*/
+
+/***********************************************************************************************************************
+ * @brief: Number of random operations run against the list and a plain array.
+ **********************************************************************************************************************/
+#define TEST_UNROLLED_LIST_OPS 20000
+
+/*
+========================================================================================================================
+- - INTERNAL TEST HELPERS - -
+========================================================================================================================
+*/
+
+static u64 _xorshift(u64* state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+static u64* _new_u64(u64 const val)
+{
+    u64* obj = malloc(sizeof(u64));
+    assert(obj);
+    *obj = val;
+    return obj;
+}
+
+// Nodes must be linked both ways, hold between 1 and a full node of objects, and match the expected objects in order.
+static bool _matches(unrolled_list_59 const* const list, u64 const* const expected, size_t const expected_size)
+{
+    size_t seen = 0;
+    unrolled_list_node_59 const* last = (void*)0;
+    for (unrolled_list_node_59 const* node = list->head; node; node = node->next)
+    {
+        if (node->last != last || 0 == node->count || UNROLLED_LIST_NODE_CAPACITY < node->count)
+            return false;
+        for (size_t i = 0; i < node->count; i++, seen++)
+        {
+            if (seen >= expected_size || expected[seen] != *(u64*)node->node_objs[i])
+                return false;
+        }
+        last = node;
+    }
+
+    return list->tail == last && expected_size == seen && list->size == seen;
+}
+
+/*
+========================================================================================================================
+- - UNIT TESTS - -
+========================================================================================================================
+*/
+
+ERR_59_e test_unrolled_list_59_interface(void)
+{
+    ERR_59_e err = ERR_NONE;
+
+    // Init unrolled_list
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Initializing unrolled_list...");
+
+    unrolled_list_59* list = (void*)0;
+    err = init_unrolled_list_59(&list, U64_PTR, 0);
+    printf("Assert: ERR_NONE == %d = init_unrolled_list()\n", err);
+    assert(ERR_NONE == err && list && !list->head && !list->tail && 0 == list->size);
+
+    // push_back fills nodes
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("push_back_unrolled_list()...");
+
+    u64* expected = malloc(sizeof(u64) * TEST_UNROLLED_LIST_OPS);
+    assert(expected);
+    size_t expected_size = 0;
+    for (u64 i = 0; i < 1000; i++)
+    {
+        err = push_back_unrolled_list_59(list, _new_u64(i));
+        assert(ERR_NONE == err);
+        expected[expected_size++] = i;
+    }
+    size_t nodes = 0;
+    for (unrolled_list_node_59 const* node = list->head; node; node = node->next)
+        nodes++;
+    printf("Assert: %d == %zu = nodes holding 1000 pushed objects\n",
+           (1000 + UNROLLED_LIST_NODE_CAPACITY - 1) / UNROLLED_LIST_NODE_CAPACITY, nodes);
+    assert((1000 + UNROLLED_LIST_NODE_CAPACITY - 1) / UNROLLED_LIST_NODE_CAPACITY == nodes);
+    assert(_matches(list, expected, expected_size));
+
+    puts("get_at_idx_unrolled_list()...");
+    void* obj = (void*)0;
+    for (size_t i = 0; i < expected_size; i++)
+    {
+        err = get_at_idx_unrolled_list_59(list, i, &obj);
+        assert(ERR_NONE == err && expected[i] == *(u64*)obj);
+    }
+    err = get_at_idx_unrolled_list_59(list, 999, &obj);
+    printf("Assert: 999 == %lu = last object\n", *(u64*)obj);
+    assert(ERR_NONE == err && 999 == *(u64*)obj);
+
+    puts("find_in_unrolled_list()...");
+    size_t idx = 0;
+    u64 const wanted = 640;
+    err = find_in_unrolled_list_59(list, &wanted, &idx);
+    printf("Assert: 640 == %zu = index of the found object\n", idx);
+    assert(ERR_NONE == err && 640 == idx);
+
+    // Random operations against a plain array
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Random inserts, removes, pushes and pops...");
+
+    u64 rng = 59;
+    for (u64 op = 0; op < TEST_UNROLLED_LIST_OPS; op++)
+    {
+        u64 const roll = _xorshift(&rng);
+        size_t const at = (size_t)((roll >> 8) % (expected_size + 1));
+        switch (roll % 6)
+        {
+        case 0:
+        case 1:
+            if (expected_size == TEST_UNROLLED_LIST_OPS)
+                break;
+            err = insert_into_unrolled_list_59(list, _new_u64(op), at);
+            assert(ERR_NONE == err);
+            memmove(&expected[at + 1], &expected[at], sizeof(u64) * (expected_size - at));
+            expected[at] = op;
+            expected_size++;
+            break;
+
+        case 2:
+            if (expected_size == TEST_UNROLLED_LIST_OPS)
+                break;
+            err = push_front_unrolled_list_59(list, _new_u64(op));
+            assert(ERR_NONE == err);
+            memmove(&expected[1], &expected[0], sizeof(u64) * expected_size);
+            expected[0] = op;
+            expected_size++;
+            break;
+
+        case 3:
+            if (0 == expected_size || at == expected_size)
+                break;
+            err = remove_at_idx_unrolled_list_59(list, at, &obj);
+            assert(ERR_NONE == err && expected[at] == *(u64*)obj);
+            free(obj);
+            memmove(&expected[at], &expected[at + 1], sizeof(u64) * (expected_size - at - 1));
+            expected_size--;
+            break;
+
+        case 4:
+            if (0 == expected_size)
+                break;
+            err = pop_front_unrolled_list_59(list, &obj);
+            assert(ERR_NONE == err && expected[0] == *(u64*)obj);
+            free(obj);
+            memmove(&expected[0], &expected[1], sizeof(u64) * (expected_size - 1));
+            expected_size--;
+            break;
+
+        default:
+            if (0 == expected_size)
+                break;
+            err = pop_back_unrolled_list_59(list, &obj);
+            assert(ERR_NONE == err && expected[expected_size - 1] == *(u64*)obj);
+            free(obj);
+            expected_size--;
+            break;
+        }
+        assert(0 != op % 97 || _matches(list, expected, expected_size));
+    }
+    printf("Assert: %zu == %zu = size after random operations\n", expected_size, list->size);
+    assert(_matches(list, expected, expected_size));
+
+    puts("Removes keep nodes at least half full...");
+    while (list->size > 100)
+    {
+        err = remove_at_idx_unrolled_list_59(list, list->size / 3, &obj);
+        assert(ERR_NONE == err);
+        free(obj);
+        memmove(&expected[expected_size / 3], &expected[expected_size / 3 + 1],
+                sizeof(u64) * (expected_size - expected_size / 3 - 1));
+        expected_size--;
+    }
+    assert(_matches(list, expected, expected_size));
+    nodes = 0;
+    for (unrolled_list_node_59 const* node = list->head; node; node = node->next)
+        nodes++;
+    printf("Assert: %zu <= %d = nodes holding 100 objects\n", nodes, 100 / UNROLLED_LIST_NODE_MIN + 1);
+    assert(nodes <= 100 / UNROLLED_LIST_NODE_MIN + 1);
+
+    puts("Emptying the list...");
+    while (ERR_NONE == pop_front_unrolled_list_59(list, &obj))
+        free(obj);
+    printf("Assert: 0 == %zu = size once emptied\n", list->size);
+    assert(0 == list->size && !list->head && !list->tail);
+
+    err = push_front_unrolled_list_59(list, _new_u64(59));
+    assert(ERR_NONE == err && 1 == list->size && list->head == list->tail);
+
+    // Test clean up
+    puts("- - - - - - - - - - - - - - - - -");
+    puts("Test clean up...");
+    free(expected);
+    err = deinit_unrolled_list_59(&list);
+    assert(!list);
+
+    return err;
+}
+
+/*
+========================================================================================================================
+- - MAIN - -
+========================================================================================================================
+*/
+
+int main(int argc, char const* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    puts("- - -  START OF UNROLLED LIST TEST  - - -");
+    puts("- - - INTERFACE TESTS - - -");
+
+    ERR_59_e err = test_unrolled_list_59_interface();
+    printf("ERROR CODE: %d\n", err);
+    assert(ERR_NONE == err);
+
+    puts("- - - - END OF UNROLLED LIST TEST - - - -");
+    return err;
+}